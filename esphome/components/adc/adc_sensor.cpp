@@ -5,6 +5,11 @@
 ADC_MODE(ADC_VCC)
 #endif
 
+#ifdef ARDUINO_ARCH_ESP32
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#endif
+
 namespace esphome {
 namespace adc {
 
@@ -12,6 +17,12 @@ static const char *TAG = "adc";
 
 #ifdef ARDUINO_ARCH_ESP32
 void ADCSensor::set_attenuation(adc_attenuation_t attenuation) { this->attenuation_ = attenuation; }
+
+/// Lock shared by all ADC sensors, a BlockSampler may read one of them from its own task.
+static SemaphoreHandle_t adc_lock() {
+  static SemaphoreHandle_t lock = xSemaphoreCreateMutex();
+  return lock;
+}
 #endif
 
 void ADCSensor::setup() {
@@ -58,7 +69,9 @@ void ADCSensor::update() {
 }
 float ADCSensor::sample() {
 #ifdef ARDUINO_ARCH_ESP32
+  xSemaphoreTake(adc_lock(), portMAX_DELAY);
   float value_v = analogRead(this->pin_) / 4095.0f;
+  xSemaphoreGive(adc_lock());
   switch (this->attenuation_) {
     case ADC_0db:
       value_v *= 1.1;
@@ -25,6 +25,10 @@ class ADCSensor : public sensor::Sensor, public PollingComponent, public voltage
   float get_setup_priority() const override;
   void set_pin(uint8_t pin) { this->pin_ = pin; }
   float sample() override;
+#ifdef ARDUINO_ARCH_ESP32
+  /// ADC reads are serialized by a lock on the ESP32.
+  bool is_sample_thread_safe() const override { return true; }
+#endif
 
 #ifdef ARDUINO_ARCH_ESP8266
   std::string unique_id() override;
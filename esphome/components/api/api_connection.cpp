@@ -15,6 +15,9 @@ namespace api {
 
 static const char *TAG = "api.connection";
 
+/// Send a ping request after this long without traffic, and disconnect 2.5 times that long without a response.
+static const uint32_t KEEPALIVE_INTERVAL = 60000;
+
 APIConnection::APIConnection(AsyncClient *client, APIServer *parent)
     : client_(client), parent_(parent), initial_state_iterator_(parent, this), list_entities_iterator_(parent, this) {
   this->client_->onError([](void *s, AsyncClient *c, int8_t error) { ((APIConnection *) s)->on_error_(error); }, this);
@@ -31,13 +34,21 @@ APIConnection::APIConnection(AsyncClient *client, APIServer *parent)
   this->last_traffic_ = millis();
 }
 APIConnection::~APIConnection() { delete this->client_; }
-void APIConnection::on_error_(int8_t error) { this->remove_ = true; }
-void APIConnection::on_disconnect_() { this->remove_ = true; }
+void APIConnection::on_error_(int8_t error) {
+  this->remove_ = true;
+  App.wake_loop();
+}
+void APIConnection::on_disconnect_() {
+  this->remove_ = true;
+  App.wake_loop();
+}
 void APIConnection::on_timeout_(uint32_t time) { this->on_fatal_error(); }
 void APIConnection::on_data_(uint8_t *buf, size_t len) {
   if (len == 0 || buf == nullptr)
     return;
   this->recv_buffer_.insert(this->recv_buffer_.end(), buf, buf + len);
+  // Parse the data in loop()
+  App.wake_loop();
 }
 void APIConnection::parse_recv_buffer_() {
   if (this->recv_buffer_.empty() || this->remove_)
@@ -108,28 +119,50 @@ void APIConnection::loop() {
   }
   this->parse_recv_buffer_();
 
+  if (!this->dirty_states_.empty()) {
+    if (this->state_subscription_) {
+      this->dirty_states_.flush(
+          [this](Nameable *obj, uint8_t message_type) { return this->send_dirty_state_(obj, message_type); });
+    } else {
+      this->dirty_states_.clear();
+    }
+  }
+
   this->list_entities_iterator_.advance();
   this->initial_state_iterator_.advance();
+#ifdef USE_COMPONENT_PROFILER
+  // Send one component per loop, and retry the same component if the send buffer is full
+  if (this->component_profile_at_ >= 0) {
+    auto &components = App.get_components();
+    if (this->component_profile_at_ < components.size()) {
+      if (this->send_component_profile(components[this->component_profile_at_]))
+        this->component_profile_at_++;
+    } else if (this->send_component_profile_done_response(ComponentProfileDoneResponse())) {
+      this->component_profile_at_ = -1;
+    }
+  }
+#endif
 
-  const uint32_t keepalive = 60000;
   if (this->sent_ping_) {
     // Disconnect if not responded within 2.5*keepalive
-    if (millis() - this->last_traffic_ > (keepalive * 5) / 2) {
+    if (millis() - this->last_traffic_ > (KEEPALIVE_INTERVAL * 5) / 2) {
       ESP_LOGW(TAG, "'%s' didn't respond to ping request in time. Disconnecting...", this->client_info_.c_str());
       this->disconnect_client();
     }
-  } else if (millis() - this->last_traffic_ > keepalive) {
+  } else if (millis() - this->last_traffic_ > KEEPALIVE_INTERVAL) {
     this->sent_ping_ = true;
     this->send_ping_request(PingRequest());
   }
 
 #ifdef USE_ESP32_CAMERA
   if (this->image_reader_.available()) {
+    // Image chunks are sized to the free TCP buffer space, so send any pending state updates first
+    this->flush_batch_();
     uint32_t space = this->client_->space();
     // reserve 15 bytes for metadata, and at least 64 bytes of data
     if (space >= 15 + 64) {
       uint32_t to_send = std::min(space - 15, this->image_reader_.available());
-      auto buffer = this->create_buffer();
+      auto buffer = this->create_buffer(to_send + 15);
       // fixed32 key = 1;
       buffer.encode_fixed32(1, esp32_camera::global_esp32_camera->get_object_id_hash());
       // bytes data = 2;
@@ -149,6 +182,90 @@ void APIConnection::loop() {
     }
   }
 #endif
+
+  if (!this->batch_buffer_.empty() && millis() - this->batch_start_ >= this->parent_->get_batch_delay())
+    this->flush_batch_();
+}
+uint32_t APIConnection::next_wake_in() {
+  if (this->remove_ || this->next_close_)
+    return 0;
+  // Sending entities and states is polled, it may have to wait for space in the TCP buffer
+  if (!this->dirty_states_.empty() || !this->list_entities_iterator_.is_done() ||
+      !this->initial_state_iterator_.is_done())
+    return App.get_loop_interval();
+#ifdef USE_COMPONENT_PROFILER
+  if (this->component_profile_at_ >= 0)
+    return App.get_loop_interval();
+#endif
+#ifdef USE_ESP32_CAMERA
+  if (this->image_reader_.available())
+    return App.get_loop_interval();
+#endif
+
+  // Received data wakes the loop from on_data_(), only the keepalive and the batch delay are timed
+  const uint32_t now = millis();
+  const uint32_t keepalive = this->sent_ping_ ? (KEEPALIVE_INTERVAL * 5) / 2 : KEEPALIVE_INTERVAL;
+  const uint32_t since_traffic = now - this->last_traffic_;
+  uint32_t wake = since_traffic > keepalive ? 0 : keepalive - since_traffic + 1;
+  if (!this->batch_buffer_.empty()) {
+    const uint32_t since_batch = now - this->batch_start_;
+    const uint32_t batch_delay = this->parent_->get_batch_delay();
+    wake = std::min(wake, since_batch >= batch_delay ? 0 : batch_delay - since_batch);
+  }
+  return wake;
+}
+
+bool APIConnection::track_state_(bool sent, Nameable *obj, uint8_t message_type) {
+  // State updates that didn't fit in the TCP buffer are sent again (with the then current state) once there is space
+  if (!sent && !this->remove_)
+    this->dirty_states_.mark(obj, message_type);
+  return sent;
+}
+bool APIConnection::send_dirty_state_(Nameable *obj, uint8_t message_type) {
+  switch (message_type) {
+#ifdef USE_BINARY_SENSOR
+    case BinarySensorStateResponse::MESSAGE_TYPE: {
+      auto *binary_sensor = static_cast<binary_sensor::BinarySensor *>(obj);
+      return this->send_binary_sensor_state(binary_sensor, binary_sensor->state);
+    }
+#endif
+#ifdef USE_COVER
+    case CoverStateResponse::MESSAGE_TYPE:
+      return this->send_cover_state(static_cast<cover::Cover *>(obj));
+#endif
+#ifdef USE_FAN
+    case FanStateResponse::MESSAGE_TYPE:
+      return this->send_fan_state(static_cast<fan::FanState *>(obj));
+#endif
+#ifdef USE_LIGHT
+    case LightStateResponse::MESSAGE_TYPE:
+      return this->send_light_state(static_cast<light::LightState *>(obj));
+#endif
+#ifdef USE_SENSOR
+    case SensorStateResponse::MESSAGE_TYPE: {
+      auto *sensor = static_cast<sensor::Sensor *>(obj);
+      return this->send_sensor_state(sensor, sensor->state);
+    }
+#endif
+#ifdef USE_SWITCH
+    case SwitchStateResponse::MESSAGE_TYPE: {
+      auto *a_switch = static_cast<switch_::Switch *>(obj);
+      return this->send_switch_state(a_switch, a_switch->state);
+    }
+#endif
+#ifdef USE_TEXT_SENSOR
+    case TextSensorStateResponse::MESSAGE_TYPE: {
+      auto *text_sensor = static_cast<text_sensor::TextSensor *>(obj);
+      return this->send_text_sensor_state(text_sensor, text_sensor->state);
+    }
+#endif
+#ifdef USE_CLIMATE
+    case ClimateStateResponse::MESSAGE_TYPE:
+      return this->send_climate_state(static_cast<climate::Climate *>(obj));
+#endif
+    default:
+      return true;
+  }
 }
 
 std::string get_default_unique_id(const std::string &component_type, Nameable *nameable) {
@@ -164,7 +281,8 @@ bool APIConnection::send_binary_sensor_state(binary_sensor::BinarySensor *binary
   resp.key = binary_sensor->get_object_id_hash();
   resp.state = state;
   resp.missing_state = !binary_sensor->has_state();
-  return this->send_binary_sensor_state_response(resp);
+  return this->track_state_(this->send_binary_sensor_state_response(resp), binary_sensor,
+                            BinarySensorStateResponse::MESSAGE_TYPE);
 }
 bool APIConnection::send_binary_sensor_info(binary_sensor::BinarySensor *binary_sensor) {
   ListEntitiesBinarySensorResponse msg;
@@ -192,7 +310,7 @@ bool APIConnection::send_cover_state(cover::Cover *cover) {
   if (traits.get_supports_tilt())
     resp.tilt = cover->tilt;
   resp.current_operation = static_cast<enums::CoverOperation>(cover->current_operation);
-  return this->send_cover_state_response(resp);
+  return this->track_state_(this->send_cover_state_response(resp), cover, CoverStateResponse::MESSAGE_TYPE);
 }
 bool APIConnection::send_cover_info(cover::Cover *cover) {
   auto traits = cover->get_traits();
@@ -249,7 +367,7 @@ bool APIConnection::send_fan_state(fan::FanState *fan) {
     resp.oscillating = fan->oscillating;
   if (traits.supports_speed())
     resp.speed = static_cast<enums::FanSpeed>(fan->speed);
-  return this->send_fan_state_response(resp);
+  return this->track_state_(this->send_fan_state_response(resp), fan, FanStateResponse::MESSAGE_TYPE);
 }
 bool APIConnection::send_fan_info(fan::FanState *fan) {
   auto traits = fan->get_traits();
@@ -302,7 +420,7 @@ bool APIConnection::send_light_state(light::LightState *light) {
     resp.color_temperature = values.get_color_temperature();
   if (light->supports_effects())
     resp.effect = light->get_effect_name();
-  return this->send_light_state_response(resp);
+  return this->track_state_(this->send_light_state_response(resp), light, LightStateResponse::MESSAGE_TYPE);
 }
 bool APIConnection::send_light_info(light::LightState *light) {
   auto traits = light->get_traits();
@@ -364,7 +482,7 @@ bool APIConnection::send_sensor_state(sensor::Sensor *sensor, float state) {
   resp.key = sensor->get_object_id_hash();
   resp.state = state;
   resp.missing_state = !sensor->has_state();
-  return this->send_sensor_state_response(resp);
+  return this->track_state_(this->send_sensor_state_response(resp), sensor, SensorStateResponse::MESSAGE_TYPE);
 }
 bool APIConnection::send_sensor_info(sensor::Sensor *sensor) {
   ListEntitiesSensorResponse msg;
@@ -390,7 +508,7 @@ bool APIConnection::send_switch_state(switch_::Switch *a_switch, bool state) {
   SwitchStateResponse resp{};
   resp.key = a_switch->get_object_id_hash();
   resp.state = state;
-  return this->send_switch_state_response(resp);
+  return this->track_state_(this->send_switch_state_response(resp), a_switch, SwitchStateResponse::MESSAGE_TYPE);
 }
 bool APIConnection::send_switch_info(switch_::Switch *a_switch) {
   ListEntitiesSwitchResponse msg;
@@ -423,7 +541,8 @@ bool APIConnection::send_text_sensor_state(text_sensor::TextSensor *text_sensor,
   resp.key = text_sensor->get_object_id_hash();
   resp.state = std::move(state);
   resp.missing_state = !text_sensor->has_state();
-  return this->send_text_sensor_state_response(resp);
+  return this->track_state_(this->send_text_sensor_state_response(resp), text_sensor,
+                            TextSensorStateResponse::MESSAGE_TYPE);
 }
 bool APIConnection::send_text_sensor_info(text_sensor::TextSensor *text_sensor) {
   ListEntitiesTextSensorResponse msg;
@@ -462,7 +581,7 @@ bool APIConnection::send_climate_state(climate::Climate *climate) {
     resp.fan_mode = static_cast<enums::ClimateFanMode>(climate->fan_mode);
   if (traits.get_supports_swing_modes())
     resp.swing_mode = static_cast<enums::ClimateSwingMode>(climate->swing_mode);
-  return this->send_climate_state_response(resp);
+  return this->track_state_(this->send_climate_state_response(resp), climate, ClimateStateResponse::MESSAGE_TYPE);
 }
 bool APIConnection::send_climate_info(climate::Climate *climate) {
   auto traits = climate->get_traits();
@@ -520,6 +639,25 @@ void APIConnection::climate_command(const ClimateCommandRequest &msg) {
 }
 #endif
 
+#ifdef USE_COMPONENT_PROFILER
+static void fill_timing_stats(ComponentTimingStats &msg, const esphome::ComponentTimingStats &stats) {
+  msg.count = stats.count;
+  msg.total_us = stats.total_us;
+  msg.max_us = stats.max_us;
+  msg.ewma_us = stats.ewma_us;
+}
+bool APIConnection::send_component_profile(Component *component) {
+  auto &profile = component->get_profile();
+  ComponentProfileResponse msg;
+  msg.source = component->get_component_source();
+  fill_timing_stats(msg.setup, profile.setup);
+  fill_timing_stats(msg.loop, profile.loop);
+  fill_timing_stats(msg.scheduler, profile.scheduler);
+  fill_timing_stats(msg.update, profile.update);
+  return this->send_component_profile_response(msg);
+}
+#endif
+
 #ifdef USE_ESP32_CAMERA
 void APIConnection::send_camera_state(std::shared_ptr<esp32_camera::CameraImage> image) {
   if (!this->state_subscription_)
@@ -561,17 +699,18 @@ bool APIConnection::send_log_message(int level, const char *tag, const char *lin
   this->set_nodelay(false);
 
   // Send raw so that we don't copy too much
-  auto buffer = this->create_buffer();
+  const size_t line_length = strlen(line);
+  auto buffer = this->create_buffer(line_length + 16);
   // LogLevel level = 1;
   buffer.encode_uint32(1, static_cast<uint32_t>(level));
   // string tag = 2;
   // buffer.encode_string(2, tag, strlen(tag));
   // string message = 3;
-  buffer.encode_string(3, line, strlen(line));
+  buffer.encode_string(3, line, line_length);
   // SubscribeLogsResponse - 29
   bool success = this->send_buffer(buffer, 29);
   if (!success) {
-    buffer = this->create_buffer();
+    buffer = this->create_buffer(2);
     // bool send_failed = 4;
     buffer.encode_bool(4, true);
     return this->send_buffer(buffer, 29);
@@ -655,30 +794,58 @@ bool APIConnection::send_buffer(ProtoWriteBuffer buffer, uint32_t message_type)
   if (this->remove_)
     return false;
 
-  std::vector<uint8_t> header;
-  header.push_back(0x00);
-  ProtoVarInt(buffer.get_buffer()->size()).encode(header);
-  ProtoVarInt(message_type).encode(header);
-
-  size_t needed_space = buffer.get_buffer()->size() + header.size();
-
-  if (needed_space > this->client_->space()) {
-    delay(0);
+  // Write the header in place, right in front of the message
+  std::vector<uint8_t> &data = *buffer.get_buffer();
+  const uint32_t msg_size = data.size() - API_HEADER_PADDING;
+  const uint8_t header_size = 1 + ProtoSize::varint(msg_size) + ProtoSize::varint(message_type);
+  uint8_t *header = &data[API_HEADER_PADDING - header_size];
+  header[0] = 0x00;
+  uint8_t pos = 1;
+  pos += ProtoVarInt(msg_size).encode_to(header + pos);
+  ProtoVarInt(message_type).encode_to(header + pos);
+
+  size_t needed_space = msg_size + header_size;
+
+  if (this->batch_buffer_.size() + needed_space > this->client_->space()) {
+    // Make room by sending what has been batched so far
+    this->flush_batch_();
     if (needed_space > this->client_->space()) {
-      // SubscribeLogsResponse
-      if (message_type != 29) {
-        ESP_LOGV(TAG, "Cannot send message because of TCP buffer space");
-      }
       delay(0);
-      return false;
+      if (needed_space > this->client_->space()) {
+        // SubscribeLogsResponse
+        if (message_type != 29) {
+          ESP_LOGV(TAG, "Cannot send message because of TCP buffer space");
+        }
+        delay(0);
+        return false;
+      }
     }
   }
 
-  this->client_->add(reinterpret_cast<char *>(header.data()), header.size());
-  this->client_->add(reinterpret_cast<char *>(buffer.get_buffer()->data()), buffer.get_buffer()->size());
+  if (this->parent_->is_batching() && is_state_update_message(message_type)) {
+    // Never batch more than fits in the TCP buffer (checked above), so that the flush can't fail
+    if (this->batch_buffer_.empty())
+      this->batch_start_ = millis();
+    this->batch_buffer_.insert(this->batch_buffer_.end(), header, header + needed_space);
+    return true;
+  }
+
+  // Anything else is sent right away, together with all state updates batched before it to keep the order
+  if (!this->batch_buffer_.empty()) {
+    this->client_->add(reinterpret_cast<char *>(this->batch_buffer_.data()), this->batch_buffer_.size());
+    this->batch_buffer_.clear();
+  }
+  this->client_->add(reinterpret_cast<char *>(header), needed_space);
   bool ret = this->client_->send();
   return ret;
 }
+void APIConnection::flush_batch_() {
+  if (this->batch_buffer_.empty())
+    return;
+  this->client_->add(reinterpret_cast<char *>(this->batch_buffer_.data()), this->batch_buffer_.size());
+  this->batch_buffer_.clear();
+  this->client_->send();
+}
 void APIConnection::on_unauthenticated_access() {
   ESP_LOGD(TAG, "'%s' tried to access without authentication.", this->client_info_.c_str());
   this->on_fatal_error();
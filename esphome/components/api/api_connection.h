@@ -9,6 +9,9 @@
 namespace esphome {
 namespace api {
 
+/// Maximum size of the frame header: preamble, message size varint (up to 5 bytes) and message type varint.
+static const uint8_t API_HEADER_PADDING = 1 + 5 + 2;
+
 class APIConnection : public APIServerConnection {
  public:
   APIConnection(AsyncClient *client, APIServer *parent);
@@ -16,6 +19,8 @@ class APIConnection : public APIServerConnection {
 
   void disconnect_client();
   void loop();
+  /// How long loop() can be skipped, see Component::next_wake_in().
+  uint32_t next_wake_in();
 
   bool send_list_info_done() {
     ListEntitiesDoneResponse resp;
@@ -62,6 +67,10 @@ class APIConnection : public APIServerConnection {
   bool send_climate_state(climate::Climate *climate);
   bool send_climate_info(climate::Climate *climate);
   void climate_command(const ClimateCommandRequest &msg) override;
+#endif
+#ifdef USE_COMPONENT_PROFILER
+  bool send_component_profile(Component *component);
+  void component_profile(const ComponentProfileRequest &msg) override { this->component_profile_at_ = 0; }
 #endif
   bool send_log_message(int level, const char *tag, const char *line);
   void send_homeassistant_service_call(const HomeassistantServiceResponse &call) {
@@ -124,8 +133,11 @@ class APIConnection : public APIServerConnection {
   void on_fatal_error() override;
   void on_unauthenticated_access() override;
   void on_no_setup_connection() override;
-  ProtoWriteBuffer create_buffer() override {
+  ProtoWriteBuffer create_buffer(uint32_t reserve_size) override {
+    // Leave room for the header in front of the message, send_buffer() writes it in place
     this->send_buffer_.clear();
+    this->send_buffer_.reserve(API_HEADER_PADDING + reserve_size);
+    this->send_buffer_.resize(API_HEADER_PADDING);
     return {&this->send_buffer_};
   }
   bool send_buffer(ProtoWriteBuffer buffer, uint32_t message_type) override;
@@ -138,6 +150,9 @@ class APIConnection : public APIServerConnection {
   void on_timeout_(uint32_t time);
   void on_data_(uint8_t *buf, size_t len);
   void parse_recv_buffer_();
+  void flush_batch_();
+  bool track_state_(bool sent, Nameable *obj, uint8_t message_type);
+  bool send_dirty_state_(Nameable *obj, uint8_t message_type);
   void set_nodelay(bool nodelay) override {
     if (nodelay == this->current_nodelay_)
       return;
@@ -155,6 +170,11 @@ class APIConnection : public APIServerConnection {
 
   std::vector<uint8_t> send_buffer_;
   std::vector<uint8_t> recv_buffer_;
+  /// Framed state updates waiting to be sent in one write (see APIServer::set_batch_delay()).
+  std::vector<uint8_t> batch_buffer_;
+  uint32_t batch_start_{0};
+  /// Entities whose state update couldn't be sent, tagged with the state response message type.
+  DirtySet<Nameable> dirty_states_;
 
   std::string client_info_;
 #ifdef USE_ESP32_CAMERA
@@ -172,6 +192,9 @@ class APIConnection : public APIServerConnection {
   APIServer *parent_;
   InitialStateIterator initial_state_iterator_;
   ListEntitiesIterator list_entities_iterator_;
+#ifdef USE_COMPONENT_PROFILER
+  int component_profile_at_{-1};
+#endif
 };
 
 }  // namespace api
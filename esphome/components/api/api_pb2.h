@@ -85,8 +85,10 @@ enum ClimateAction : uint32_t {
 
 class HelloRequest : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 1;
   std::string client_info{};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -94,10 +96,12 @@ class HelloRequest : public ProtoMessage {
 };
 class HelloResponse : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 2;
   uint32_t api_version_major{0};  // NOLINT
   uint32_t api_version_minor{0};  // NOLINT
   std::string server_info{};      // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -106,8 +110,10 @@ class HelloResponse : public ProtoMessage {
 };
 class ConnectRequest : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 3;
   std::string password{};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -115,8 +121,10 @@ class ConnectRequest : public ProtoMessage {
 };
 class ConnectResponse : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 4;
   bool invalid_password{false};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -124,41 +132,52 @@ class ConnectResponse : public ProtoMessage {
 };
 class DisconnectRequest : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 5;
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
 };
 class DisconnectResponse : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 6;
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
 };
 class PingRequest : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 7;
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
 };
 class PingResponse : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 8;
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
 };
 class DeviceInfoRequest : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 9;
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
 };
 class DeviceInfoResponse : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 10;
   bool uses_password{false};       // NOLINT
   std::string name{};              // NOLINT
   std::string mac_address{};       // NOLINT
@@ -167,6 +186,7 @@ class DeviceInfoResponse : public ProtoMessage {
   std::string model{};             // NOLINT
   bool has_deep_sleep{false};      // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -175,27 +195,34 @@ class DeviceInfoResponse : public ProtoMessage {
 };
 class ListEntitiesRequest : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 11;
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
 };
 class ListEntitiesDoneResponse : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 19;
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
 };
 class SubscribeStatesRequest : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 20;
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
 };
 class ListEntitiesBinarySensorResponse : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 12;
   std::string object_id{};              // NOLINT
   uint32_t key{0};                      // NOLINT
   std::string name{};                   // NOLINT
@@ -203,6 +230,7 @@ class ListEntitiesBinarySensorResponse : public ProtoMessage {
   std::string device_class{};           // NOLINT
   bool is_status_binary_sensor{false};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -212,10 +240,12 @@ class ListEntitiesBinarySensorResponse : public ProtoMessage {
 };
 class BinarySensorStateResponse : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 21;
   uint32_t key{0};            // NOLINT
   bool state{false};          // NOLINT
   bool missing_state{false};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -224,6 +254,7 @@ class BinarySensorStateResponse : public ProtoMessage {
 };
 class ListEntitiesCoverResponse : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 13;
   std::string object_id{};        // NOLINT
   uint32_t key{0};                // NOLINT
   std::string name{};             // NOLINT
@@ -233,6 +264,7 @@ class ListEntitiesCoverResponse : public ProtoMessage {
   bool supports_tilt{false};      // NOLINT
   std::string device_class{};     // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -242,12 +274,14 @@ class ListEntitiesCoverResponse : public ProtoMessage {
 };
 class CoverStateResponse : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 22;
   uint32_t key{0};                            // NOLINT
   enums::LegacyCoverState legacy_state{};     // NOLINT
   float position{0.0f};                       // NOLINT
   float tilt{0.0f};                           // NOLINT
   enums::CoverOperation current_operation{};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -256,6 +290,7 @@ class CoverStateResponse : public ProtoMessage {
 };
 class CoverCommandRequest : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 30;
   uint32_t key{0};                             // NOLINT
   bool has_legacy_command{false};              // NOLINT
   enums::LegacyCoverCommand legacy_command{};  // NOLINT
@@ -265,6 +300,7 @@ class CoverCommandRequest : public ProtoMessage {
   float tilt{0.0f};                            // NOLINT
   bool stop{false};                            // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -273,6 +309,7 @@ class CoverCommandRequest : public ProtoMessage {
 };
 class ListEntitiesFanResponse : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 14;
   std::string object_id{};           // NOLINT
   uint32_t key{0};                   // NOLINT
   std::string name{};                // NOLINT
@@ -280,6 +317,7 @@ class ListEntitiesFanResponse : public ProtoMessage {
   bool supports_oscillation{false};  // NOLINT
   bool supports_speed{false};        // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -289,11 +327,13 @@ class ListEntitiesFanResponse : public ProtoMessage {
 };
 class FanStateResponse : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 23;
   uint32_t key{0};          // NOLINT
   bool state{false};        // NOLINT
   bool oscillating{false};  // NOLINT
   enums::FanSpeed speed{};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -302,6 +342,7 @@ class FanStateResponse : public ProtoMessage {
 };
 class FanCommandRequest : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 31;
   uint32_t key{0};              // NOLINT
   bool has_state{false};        // NOLINT
   bool state{false};            // NOLINT
@@ -310,6 +351,7 @@ class FanCommandRequest : public ProtoMessage {
   bool has_oscillating{false};  // NOLINT
   bool oscillating{false};      // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -318,6 +360,7 @@ class FanCommandRequest : public ProtoMessage {
 };
 class ListEntitiesLightResponse : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 15;
   std::string object_id{};                 // NOLINT
   uint32_t key{0};                         // NOLINT
   std::string name{};                      // NOLINT
@@ -330,6 +373,7 @@ class ListEntitiesLightResponse : public ProtoMessage {
   float max_mireds{0.0f};                  // NOLINT
   std::vector<std::string> effects{};      // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -339,6 +383,7 @@ class ListEntitiesLightResponse : public ProtoMessage {
 };
 class LightStateResponse : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 24;
   uint32_t key{0};                // NOLINT
   bool state{false};              // NOLINT
   float brightness{0.0f};         // NOLINT
@@ -349,6 +394,7 @@ class LightStateResponse : public ProtoMessage {
   float color_temperature{0.0f};  // NOLINT
   std::string effect{};           // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -358,6 +404,7 @@ class LightStateResponse : public ProtoMessage {
 };
 class LightCommandRequest : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 32;
   uint32_t key{0};                    // NOLINT
   bool has_state{false};              // NOLINT
   bool state{false};                  // NOLINT
@@ -378,6 +425,7 @@ class LightCommandRequest : public ProtoMessage {
   bool has_effect{false};             // NOLINT
   std::string effect{};               // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -387,6 +435,7 @@ class LightCommandRequest : public ProtoMessage {
 };
 class ListEntitiesSensorResponse : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 16;
   std::string object_id{};            // NOLINT
   uint32_t key{0};                    // NOLINT
   std::string name{};                 // NOLINT
@@ -396,6 +445,7 @@ class ListEntitiesSensorResponse : public ProtoMessage {
   int32_t accuracy_decimals{0};       // NOLINT
   bool force_update{false};           // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -405,10 +455,12 @@ class ListEntitiesSensorResponse : public ProtoMessage {
 };
 class SensorStateResponse : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 25;
   uint32_t key{0};            // NOLINT
   float state{0.0f};          // NOLINT
   bool missing_state{false};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -417,6 +469,7 @@ class SensorStateResponse : public ProtoMessage {
 };
 class ListEntitiesSwitchResponse : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 17;
   std::string object_id{};    // NOLINT
   uint32_t key{0};            // NOLINT
   std::string name{};         // NOLINT
@@ -424,6 +477,7 @@ class ListEntitiesSwitchResponse : public ProtoMessage {
   std::string icon{};         // NOLINT
   bool assumed_state{false};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -433,9 +487,11 @@ class ListEntitiesSwitchResponse : public ProtoMessage {
 };
 class SwitchStateResponse : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 26;
   uint32_t key{0};    // NOLINT
   bool state{false};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -444,9 +500,11 @@ class SwitchStateResponse : public ProtoMessage {
 };
 class SwitchCommandRequest : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 33;
   uint32_t key{0};    // NOLINT
   bool state{false};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -455,12 +513,14 @@ class SwitchCommandRequest : public ProtoMessage {
 };
 class ListEntitiesTextSensorResponse : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 18;
   std::string object_id{};  // NOLINT
   uint32_t key{0};          // NOLINT
   std::string name{};       // NOLINT
   std::string unique_id{};  // NOLINT
   std::string icon{};       // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -469,10 +529,12 @@ class ListEntitiesTextSensorResponse : public ProtoMessage {
 };
 class TextSensorStateResponse : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 27;
   uint32_t key{0};            // NOLINT
   std::string state{};        // NOLINT
   bool missing_state{false};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -482,9 +544,11 @@ class TextSensorStateResponse : public ProtoMessage {
 };
 class SubscribeLogsRequest : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 28;
   enums::LogLevel level{};  // NOLINT
   bool dump_config{false};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -492,11 +556,13 @@ class SubscribeLogsRequest : public ProtoMessage {
 };
 class SubscribeLogsResponse : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 29;
   enums::LogLevel level{};  // NOLINT
   std::string tag{};        // NOLINT
   std::string message{};    // NOLINT
   bool send_failed{false};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -505,7 +571,9 @@ class SubscribeLogsResponse : public ProtoMessage {
 };
 class SubscribeHomeassistantServicesRequest : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 34;
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -515,6 +583,7 @@ class HomeassistantServiceMap : public ProtoMessage {
   std::string key{};    // NOLINT
   std::string value{};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -522,12 +591,14 @@ class HomeassistantServiceMap : public ProtoMessage {
 };
 class HomeassistantServiceResponse : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 35;
   std::string service{};                                 // NOLINT
   std::vector<HomeassistantServiceMap> data{};           // NOLINT
   std::vector<HomeassistantServiceMap> data_template{};  // NOLINT
   std::vector<HomeassistantServiceMap> variables{};      // NOLINT
   bool is_event{false};                                  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -536,15 +607,19 @@ class HomeassistantServiceResponse : public ProtoMessage {
 };
 class SubscribeHomeAssistantStatesRequest : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 38;
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
 };
 class SubscribeHomeAssistantStateResponse : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 39;
   std::string entity_id{};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -552,9 +627,11 @@ class SubscribeHomeAssistantStateResponse : public ProtoMessage {
 };
 class HomeAssistantStateResponse : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 40;
   std::string entity_id{};  // NOLINT
   std::string state{};      // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -562,15 +639,19 @@ class HomeAssistantStateResponse : public ProtoMessage {
 };
 class GetTimeRequest : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 36;
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
 };
 class GetTimeResponse : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 37;
   uint32_t epoch_seconds{0};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -581,6 +662,7 @@ class ListEntitiesServicesArgument : public ProtoMessage {
   std::string name{};            // NOLINT
   enums::ServiceArgType type{};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -589,10 +671,12 @@ class ListEntitiesServicesArgument : public ProtoMessage {
 };
 class ListEntitiesServicesResponse : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 41;
   std::string name{};                                // NOLINT
   uint32_t key{0};                                   // NOLINT
   std::vector<ListEntitiesServicesArgument> args{};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -611,6 +695,7 @@ class ExecuteServiceArgument : public ProtoMessage {
   std::vector<float> float_array{};         // NOLINT
   std::vector<std::string> string_array{};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -620,9 +705,11 @@ class ExecuteServiceArgument : public ProtoMessage {
 };
 class ExecuteServiceRequest : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 42;
   uint32_t key{0};                             // NOLINT
   std::vector<ExecuteServiceArgument> args{};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -631,11 +718,13 @@ class ExecuteServiceRequest : public ProtoMessage {
 };
 class ListEntitiesCameraResponse : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 43;
   std::string object_id{};  // NOLINT
   uint32_t key{0};          // NOLINT
   std::string name{};       // NOLINT
   std::string unique_id{};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -644,10 +733,12 @@ class ListEntitiesCameraResponse : public ProtoMessage {
 };
 class CameraImageResponse : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 44;
   uint32_t key{0};     // NOLINT
   std::string data{};  // NOLINT
   bool done{false};    // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -657,9 +748,11 @@ class CameraImageResponse : public ProtoMessage {
 };
 class CameraImageRequest : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 45;
   bool single{false};  // NOLINT
   bool stream{false};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -667,6 +760,7 @@ class CameraImageRequest : public ProtoMessage {
 };
 class ListEntitiesClimateResponse : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 46;
   std::string object_id{};                                       // NOLINT
   uint32_t key{0};                                               // NOLINT
   std::string name{};                                            // NOLINT
@@ -682,6 +776,7 @@ class ListEntitiesClimateResponse : public ProtoMessage {
   std::vector<enums::ClimateFanMode> supported_fan_modes{};      // NOLINT
   std::vector<enums::ClimateSwingMode> supported_swing_modes{};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -691,6 +786,7 @@ class ListEntitiesClimateResponse : public ProtoMessage {
 };
 class ClimateStateResponse : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 47;
   uint32_t key{0};                       // NOLINT
   enums::ClimateMode mode{};             // NOLINT
   float current_temperature{0.0f};       // NOLINT
@@ -702,6 +798,7 @@ class ClimateStateResponse : public ProtoMessage {
   enums::ClimateFanMode fan_mode{};      // NOLINT
   enums::ClimateSwingMode swing_mode{};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -710,6 +807,7 @@ class ClimateStateResponse : public ProtoMessage {
 };
 class ClimateCommandRequest : public ProtoMessage {
  public:
+  static constexpr uint32_t MESSAGE_TYPE = 48;
   uint32_t key{0};                          // NOLINT
   bool has_mode{false};                     // NOLINT
   enums::ClimateMode mode{};                // NOLINT
@@ -726,12 +824,61 @@ class ClimateCommandRequest : public ProtoMessage {
   bool has_swing_mode{false};               // NOLINT
   enums::ClimateSwingMode swing_mode{};     // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
   void dump_to(std::string &out) const override;
 
  protected:
   bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
+class ComponentProfileRequest : public ProtoMessage {
+ public:
+  static constexpr uint32_t MESSAGE_TYPE = 49;
+  void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
+  void dump_to(std::string &out) const override;
+
+ protected:
+};
+class ComponentTimingStats : public ProtoMessage {
+ public:
+  uint32_t count{0};     // NOLINT
+  uint64_t total_us{0};  // NOLINT
+  uint32_t max_us{0};    // NOLINT
+  uint32_t ewma_us{0};   // NOLINT
+  void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
+  void dump_to(std::string &out) const override;
+
+ protected:
+  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+};
+class ComponentProfileResponse : public ProtoMessage {
+ public:
+  static constexpr uint32_t MESSAGE_TYPE = 50;
+  std::string source{};              // NOLINT
+  ComponentTimingStats setup{};      // NOLINT
+  ComponentTimingStats loop{};       // NOLINT
+  ComponentTimingStats scheduler{};  // NOLINT
+  ComponentTimingStats update{};     // NOLINT
+  void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
+  void dump_to(std::string &out) const override;
+
+ protected:
+  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
+};
+class ComponentProfileDoneResponse : public ProtoMessage {
+ public:
+  static constexpr uint32_t MESSAGE_TYPE = 51;
+  void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total) const override;
+  void dump_to(std::string &out) const override;
+
+ protected:
+};
+/// Whether the message type is a state update of an entity (the messages with the state_update option).
+bool is_state_update_message(uint32_t message_type);
 
 }  // namespace api
 }  // namespace esphome
@@ -216,6 +216,22 @@ bool APIServerConnectionBase::send_climate_state_response(const ClimateStateResp
 #endif
 #ifdef USE_CLIMATE
 #endif
+#ifdef USE_COMPONENT_PROFILER
+#endif
+#ifdef USE_COMPONENT_PROFILER
+bool APIServerConnectionBase::send_component_profile_response(const ComponentProfileResponse &msg) {
+  ESP_LOGVV(TAG, "send_component_profile_response: %s", msg.dump().c_str());
+  this->set_nodelay(false);
+  return this->send_message_<ComponentProfileResponse>(msg, 50);
+}
+#endif
+#ifdef USE_COMPONENT_PROFILER
+bool APIServerConnectionBase::send_component_profile_done_response(const ComponentProfileDoneResponse &msg) {
+  ESP_LOGVV(TAG, "send_component_profile_done_response: %s", msg.dump().c_str());
+  this->set_nodelay(false);
+  return this->send_message_<ComponentProfileDoneResponse>(msg, 51);
+}
+#endif
 bool APIServerConnectionBase::read_message(uint32_t msg_size, uint32_t msg_type, uint8_t *msg_data) {
   switch (msg_type) {
     case 1: {
@@ -381,6 +397,15 @@ bool APIServerConnectionBase::read_message(uint32_t msg_size, uint32_t msg_type,
       msg.decode(msg_data, msg_size);
       ESP_LOGVV(TAG, "on_climate_command_request: %s", msg.dump().c_str());
       this->on_climate_command_request(msg);
+#endif
+      break;
+    }
+    case 49: {
+#ifdef USE_COMPONENT_PROFILER
+      ComponentProfileRequest msg;
+      msg.decode(msg_data, msg_size);
+      ESP_LOGVV(TAG, "on_component_profile_request: %s", msg.dump().c_str());
+      this->on_component_profile_request(msg);
 #endif
       break;
     }
@@ -579,6 +604,19 @@ void APIServerConnection::on_climate_command_request(const ClimateCommandRequest
   this->climate_command(msg);
 }
 #endif
+#ifdef USE_COMPONENT_PROFILER
+void APIServerConnection::on_component_profile_request(const ComponentProfileRequest &msg) {
+  if (!this->is_connection_setup()) {
+    this->on_no_setup_connection();
+    return;
+  }
+  if (!this->is_authenticated()) {
+    this->on_unauthenticated_access();
+    return;
+  }
+  this->component_profile(msg);
+}
+#endif
 
 }  // namespace api
 }  // namespace esphome
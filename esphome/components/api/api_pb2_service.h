@@ -111,6 +111,15 @@ class APIServerConnectionBase : public ProtoService {
 #endif
 #ifdef USE_CLIMATE
   virtual void on_climate_command_request(const ClimateCommandRequest &value){};
+#endif
+#ifdef USE_COMPONENT_PROFILER
+  virtual void on_component_profile_request(const ComponentProfileRequest &value){};
+#endif
+#ifdef USE_COMPONENT_PROFILER
+  bool send_component_profile_response(const ComponentProfileResponse &msg);
+#endif
+#ifdef USE_COMPONENT_PROFILER
+  bool send_component_profile_done_response(const ComponentProfileDoneResponse &msg);
 #endif
  protected:
   bool read_message(uint32_t msg_size, uint32_t msg_type, uint8_t *msg_data) override;
@@ -147,6 +156,9 @@ class APIServerConnection : public APIServerConnectionBase {
 #endif
 #ifdef USE_CLIMATE
   virtual void climate_command(const ClimateCommandRequest &msg) = 0;
+#endif
+#ifdef USE_COMPONENT_PROFILER
+  virtual void component_profile(const ComponentProfileRequest &msg) = 0;
 #endif
  protected:
   void on_hello_request(const HelloRequest &msg) override;
@@ -179,6 +191,9 @@ class APIServerConnection : public APIServerConnectionBase {
 #ifdef USE_CLIMATE
   void on_climate_command_request(const ClimateCommandRequest &msg) override;
 #endif
+#ifdef USE_COMPONENT_PROFILER
+  void on_component_profile_request(const ComponentProfileRequest &msg) override;
+#endif
 };
 
 }  // namespace api
@@ -33,6 +33,7 @@ void APIServer::setup() {
         // ESP_LOGD(TAG, "New client connected from %s", client->remoteIP().toString().c_str());
         auto *a_this = (APIServer *) s;
         a_this->clients_.push_back(new APIConnection(client, a_this));
+        App.wake_loop();
       },
       this);
 #ifdef USE_LOGGER
@@ -91,9 +92,22 @@ void APIServer::loop() {
     }
   }
 }
+uint32_t APIServer::next_wake_in() {
+  uint32_t wake = UINT32_MAX;
+  for (auto *client : this->clients_)
+    wake = std::min(wake, client->next_wake_in());
+  if (this->reboot_timeout_ != 0 && !this->is_connected()) {
+    const uint32_t since_connected = millis() - this->last_connected_;
+    wake = std::min(wake, since_connected > this->reboot_timeout_ ? 0 : this->reboot_timeout_ - since_connected + 1);
+  }
+  return wake;
+}
 void APIServer::dump_config() {
   ESP_LOGCONFIG(TAG, "API Server:");
   ESP_LOGCONFIG(TAG, "  Address: %s:%u", network_get_address().c_str(), this->port_);
+  if (this->batching_) {
+    ESP_LOGCONFIG(TAG, "  Batch Delay: %u ms", this->batch_delay_);
+  }
 }
 bool APIServer::uses_password() const { return !this->password_.empty(); }
 bool APIServer::check_password(const std::string &password) const {
@@ -219,6 +233,10 @@ const std::vector<APIServer::HomeAssistantStateSubscription> &APIServer::get_sta
 }
 uint16_t APIServer::get_port() const { return this->port_; }
 void APIServer::set_reboot_timeout(uint32_t reboot_timeout) { this->reboot_timeout_ = reboot_timeout; }
+void APIServer::set_batch_delay(uint32_t batch_delay) {
+  this->batching_ = true;
+  this->batch_delay_ = batch_delay;
+}
 #ifdef USE_HOMEASSISTANT_TIME
 void APIServer::request_time() {
   for (auto *client : this->clients_) {
@@ -29,6 +29,7 @@ class APIServer : public Component, public Controller {
   uint16_t get_port() const;
   float get_setup_priority() const override;
   void loop() override;
+  uint32_t next_wake_in() override;
   void dump_config() override;
   void on_shutdown() override;
   bool check_password(const std::string &password) const;
@@ -36,6 +37,14 @@ class APIServer : public Component, public Controller {
   void set_port(uint16_t port);
   void set_password(const std::string &password);
   void set_reboot_timeout(uint32_t reboot_timeout);
+  /** Enable batching of state updates.
+   *
+   * State updates are then collected per connection and sent in one write once per loop iteration, or at most
+   * batch_delay ms after the first update was queued.
+   */
+  void set_batch_delay(uint32_t batch_delay);
+  bool is_batching() const { return this->batching_; }
+  uint32_t get_batch_delay() const { return this->batch_delay_; }
   void handle_disconnect(APIConnection *conn);
 #ifdef USE_BINARY_SENSOR
   void on_binary_sensor_update(binary_sensor::BinarySensor *obj, bool state) override;
@@ -82,6 +91,8 @@ class APIServer : public Component, public Controller {
   AsyncServer server_{0};
   uint16_t port_{6053};
   uint32_t reboot_timeout_{300000};
+  bool batching_{false};
+  uint32_t batch_delay_{0};
   uint32_t last_connected_{0};
   std::vector<APIConnection *> clients_;
   std::string password_;
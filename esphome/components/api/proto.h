@@ -63,20 +63,31 @@ class ProtoVarInt {
       return static_cast<int64_t>(this->value_ >> 1);
   }
   void encode(std::vector<uint8_t> &out) {
-    uint32_t val = this->value_;
+    uint64_t val = this->value_;
     if (val <= 0x7F) {
       out.push_back(val);
       return;
     }
-    while (val) {
-      uint8_t temp = val & 0x7F;
+    // Encode into a local buffer first, so that the output is appended in one go
+    uint8_t data[10];
+    uint8_t len = 0;
+    while (val > 0x7F) {
+      data[len++] = (val & 0x7F) | 0x80;
+      val >>= 7;
+    }
+    data[len++] = val;
+    out.insert(out.end(), data, data + len);
+  }
+  /// Encode into a buffer that is known to have enough space (see ProtoSize::varint()), returns the encoded length.
+  uint8_t encode_to(uint8_t *out) const {
+    uint64_t val = this->value_;
+    uint8_t len = 0;
+    while (val > 0x7F) {
+      out[len++] = (val & 0x7F) | 0x80;
       val >>= 7;
-      if (val) {
-        out.push_back(temp | 0x80);
-      } else {
-        out.push_back(temp);
-      }
     }
+    out[len++] = val;
+    return len;
   }
 
  protected:
@@ -151,11 +162,10 @@ class ProtoWriteBuffer {
     this->encode_field_raw(field_id, 2);
     this->encode_varint_raw(len);
     auto *data = reinterpret_cast<const uint8_t *>(string);
-    for (size_t i = 0; i < len; i++)
-      this->write(data[i]);
+    this->buffer_->insert(this->buffer_->end(), data, data + len);
   }
   void encode_string(uint32_t field_id, const std::string &value, bool force = false) {
-    this->encode_string(field_id, value.data(), value.size());
+    this->encode_string(field_id, value.data(), value.size(), force);
   }
   void encode_bytes(uint32_t field_id, const uint8_t *data, size_t len, bool force = false) {
     this->encode_string(field_id, reinterpret_cast<const char *>(data), len, force);
@@ -183,10 +193,8 @@ class ProtoWriteBuffer {
       return;
 
     this->encode_field_raw(field_id, 5);
-    this->write((value >> 0) & 0xFF);
-    this->write((value >> 8) & 0xFF);
-    this->write((value >> 16) & 0xFF);
-    this->write((value >> 24) & 0xFF);
+    const uint8_t data[4] = {uint8_t(value >> 0), uint8_t(value >> 8), uint8_t(value >> 16), uint8_t(value >> 24)};
+    this->buffer_->insert(this->buffer_->end(), data, data + 4);
   }
   template<typename T> void encode_enum(uint32_t field_id, T value, bool force = false) {
     this->encode_uint32(field_id, static_cast<uint32_t>(value), force);
@@ -200,7 +208,7 @@ class ProtoWriteBuffer {
       uint32_t raw;
     } val{};
     val.value = value;
-    this->encode_fixed32(field_id, val.raw);
+    this->encode_fixed32(field_id, val.raw, force);
   }
   void encode_int32(uint32_t field_id, int32_t value, bool force = false) {
     if (value < 0) {
@@ -223,15 +231,11 @@ class ProtoWriteBuffer {
   }
   template<class C> void encode_message(uint32_t field_id, const C &value, bool force = false) {
     this->encode_field_raw(field_id, 2);
-    size_t begin = this->buffer_->size();
-
+    // Write the length up front instead of shifting the nested message afterwards
+    uint32_t nested_length = 0;
+    value.calculate_size(nested_length);
+    this->encode_varint_raw(nested_length);
     value.encode(*this);
-
-    const uint32_t nested_length = this->buffer_->size() - begin;
-    // add size varint
-    std::vector<uint8_t> var;
-    ProtoVarInt(nested_length).encode(var);
-    this->buffer_->insert(this->buffer_->begin() + begin, var.begin(), var.end());
   }
   std::vector<uint8_t> *get_buffer() const { return buffer_; }
 
@@ -239,9 +243,126 @@ class ProtoWriteBuffer {
   std::vector<uint8_t> *buffer_;
 };
 
+/** Helpers to calculate the encoded size of messages, used by the generated calculate_size() methods.
+ *
+ * Each add_*_field() method mirrors the ProtoWriteBuffer::encode_*() method of the same type, including
+ * the rules for when a field is omitted.
+ */
+class ProtoSize {
+ public:
+  static uint32_t varint(uint32_t value) {
+    if (value < (1UL << 7))
+      return 1;
+    if (value < (1UL << 14))
+      return 2;
+    if (value < (1UL << 21))
+      return 3;
+    if (value < (1UL << 28))
+      return 4;
+    return 5;
+  }
+  static uint32_t varint(uint64_t value) {
+    if (value <= UINT32_MAX)
+      return varint(uint32_t(value));
+    uint32_t size = 5;
+    value >>= 35;
+    while (value != 0) {
+      size++;
+      value >>= 7;
+    }
+    return size;
+  }
+  static uint32_t field(uint32_t field_id, uint32_t type) { return varint(uint32_t((field_id << 3) | type)); }
+
+  static void add_uint32_field(uint32_t &total, uint32_t field_id, uint32_t value, bool force = false) {
+    if (value == 0 && !force)
+      return;
+    total += field(field_id, 0) + varint(value);
+  }
+  static void add_uint64_field(uint32_t &total, uint32_t field_id, uint64_t value, bool force = false) {
+    if (value == 0 && !force)
+      return;
+    total += field(field_id, 0) + varint(value);
+  }
+  static void add_int32_field(uint32_t &total, uint32_t field_id, int32_t value, bool force = false) {
+    if (value < 0) {
+      // negative int32 is always 10 byte long
+      add_int64_field(total, field_id, value, force);
+      return;
+    }
+    add_uint32_field(total, field_id, static_cast<uint32_t>(value), force);
+  }
+  static void add_int64_field(uint32_t &total, uint32_t field_id, int64_t value, bool force = false) {
+    add_uint64_field(total, field_id, static_cast<uint64_t>(value), force);
+  }
+  static void add_sint32_field(uint32_t &total, uint32_t field_id, int32_t value, bool force = false) {
+    uint32_t uvalue;
+    if (value < 0)
+      uvalue = ~(value << 1);
+    else
+      uvalue = value << 1;
+    add_uint32_field(total, field_id, uvalue, force);
+  }
+  static void add_sint64_field(uint32_t &total, uint32_t field_id, int64_t value, bool force = false) {
+    uint64_t uvalue;
+    if (value < 0)
+      uvalue = ~(static_cast<uint64_t>(value) << 1);
+    else
+      uvalue = static_cast<uint64_t>(value) << 1;
+    add_uint64_field(total, field_id, uvalue, force);
+  }
+  static void add_bool_field(uint32_t &total, uint32_t field_id, bool value, bool force = false) {
+    if (!value && !force)
+      return;
+    total += field(field_id, 0) + 1;
+  }
+  static void add_fixed32_field(uint32_t &total, uint32_t field_id, uint32_t value, bool force = false) {
+    if (value == 0 && !force)
+      return;
+    total += field(field_id, 5) + 4;
+  }
+  static void add_sfixed32_field(uint32_t &total, uint32_t field_id, int32_t value, bool force = false) {
+    add_fixed32_field(total, field_id, static_cast<uint32_t>(value), force);
+  }
+  static void add_fixed64_field(uint32_t &total, uint32_t field_id, uint64_t value, bool force = false) {
+    if (value == 0 && !force)
+      return;
+    total += field(field_id, 1) + 8;
+  }
+  static void add_sfixed64_field(uint32_t &total, uint32_t field_id, int64_t value, bool force = false) {
+    add_fixed64_field(total, field_id, static_cast<uint64_t>(value), force);
+  }
+  static void add_float_field(uint32_t &total, uint32_t field_id, float value, bool force = false) {
+    if (value == 0.0f && !force)
+      return;
+    total += field(field_id, 5) + 4;
+  }
+  static void add_double_field(uint32_t &total, uint32_t field_id, double value, bool force = false) {
+    if (value == 0.0 && !force)
+      return;
+    total += field(field_id, 1) + 8;
+  }
+  template<typename T> static void add_enum_field(uint32_t &total, uint32_t field_id, T value, bool force = false) {
+    add_uint32_field(total, field_id, static_cast<uint32_t>(value), force);
+  }
+  static void add_string_field(uint32_t &total, uint32_t field_id, const std::string &value, bool force = false) {
+    if (value.empty() && !force)
+      return;
+    total += field(field_id, 2) + varint(uint32_t(value.size())) + value.size();
+  }
+  template<class C>
+  static void add_message_field(uint32_t &total, uint32_t field_id, const C &value, bool force = false) {
+    uint32_t nested_length = 0;
+    value.calculate_size(nested_length);
+    total += field(field_id, 2) + varint(nested_length) + nested_length;
+  }
+};
+
 class ProtoMessage {
  public:
   virtual void encode(ProtoWriteBuffer buffer) const = 0;
+  /// Add the encoded size of this message (without the frame header) to total.
+  virtual void calculate_size(uint32_t &total) const = 0;
   void decode(const uint8_t *buffer, size_t length);
   std::string dump() const;
   virtual void dump_to(std::string &out) const = 0;
@@ -263,13 +384,20 @@ class ProtoService {
   virtual void on_fatal_error() = 0;
   virtual void on_unauthenticated_access() = 0;
   virtual void on_no_setup_connection() = 0;
-  virtual ProtoWriteBuffer create_buffer() = 0;
+  /** Create a buffer to encode the next message into.
+   *
+   * @param reserve_size The (expected) encoded size of the message, so that the buffer doesn't need to grow
+   *                     while encoding.
+   */
+  virtual ProtoWriteBuffer create_buffer(uint32_t reserve_size) = 0;
   virtual bool send_buffer(ProtoWriteBuffer buffer, uint32_t message_type) = 0;
   virtual bool read_message(uint32_t msg_size, uint32_t msg_type, uint8_t *msg_data) = 0;
   virtual void set_nodelay(bool nodelay) = 0;
 
   template<class C> bool send_message_(const C &msg, uint32_t message_type) {
-    auto buffer = this->create_buffer();
+    uint32_t msg_size = 0;
+    msg.calculate_size(msg_size);
+    auto buffer = this->create_buffer(msg_size);
     msg.encode(buffer);
     return this->send_buffer(buffer, message_type);
   }
@@ -19,6 +19,8 @@ class ComponentIterator {
 
   void begin();
   void advance();
+  /// Whether all entities have been visited (or begin() wasn't called yet).
+  bool is_done() const { return this->state_ == IteratorState::NONE; }
   virtual bool on_begin();
 #ifdef USE_BINARY_SENSOR
   virtual bool on_binary_sensor(binary_sensor::BinarySensor *binary_sensor) = 0;
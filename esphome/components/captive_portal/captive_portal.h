@@ -24,6 +24,12 @@ class CaptivePortal : public AsyncWebHandler, public Component {
     if (this->dns_server_ != nullptr)
       this->dns_server_->processNextRequest();
   }
+  uint32_t next_wake_in() override {
+    // The DNS server is polled while the portal is active
+    if (this->dns_server_ != nullptr)
+      return Component::next_wake_in();
+    return UINT32_MAX;
+  }
   float get_setup_priority() const override;
   void start();
   bool is_active() const { return this->active_; }
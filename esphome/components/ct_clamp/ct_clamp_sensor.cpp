@@ -1,6 +1,8 @@
 #include "ct_clamp_sensor.h"
 
+#include "esphome/components/voltage_sampler/dsp.h"
 #include "esphome/core/log.h"
+#include <algorithm>
 #include <cmath>
 
 namespace esphome {
@@ -10,9 +12,20 @@ static const char *TAG = "ct_clamp";
 
 void CTClampSensor::setup() {
   this->is_calibrating_offset_ = true;
-  this->high_freq_.start();
+  if (this->block_sampler_ != nullptr) {
+    // Blocks with gaps are used as well, the RMS value only needs samples spread over the signal period, not evenly
+    // spaced ones.
+    this->block_sampler_->add_on_block_callback(
+        [this](const float *samples, size_t count, bool gaps) { this->on_block_(samples, count); });
+    this->block_sampler_->start();
+  } else {
+    this->high_freq_.start();
+  }
   this->set_timeout("calibrate_offset", this->sample_duration_, [this]() {
-    this->high_freq_.stop();
+    if (this->block_sampler_ != nullptr)
+      this->block_sampler_->stop();
+    else
+      this->high_freq_.stop();
     this->is_calibrating_offset_ = false;
     if (this->num_samples_ != 0) {
       this->offset_ = this->sample_sum_ / this->num_samples_;
@@ -23,6 +36,9 @@ void CTClampSensor::setup() {
 void CTClampSensor::dump_config() {
   LOG_SENSOR("", "CT Clamp Sensor", this);
   ESP_LOGCONFIG(TAG, "  Sample Duration: %.2fs", this->sample_duration_ / 1e3f);
+  if (this->block_sampler_ != nullptr) {
+    ESP_LOGCONFIG(TAG, "  Sample Rate: %u Hz", this->block_sampler_->get_sample_rate());
+  }
   LOG_UPDATE_INTERVAL(this);
 }
 
@@ -32,13 +48,19 @@ void CTClampSensor::update() {
 
   // Update only starts the sampling phase, in loop() the actual sampling is happening.
 
-  // Request a high loop() execution interval during sampling phase.
-  this->high_freq_.start();
+  // Request a high loop() execution interval (or block sampling) during sampling phase.
+  if (this->block_sampler_ != nullptr)
+    this->block_sampler_->start();
+  else
+    this->high_freq_.start();
 
   // Set timeout for ending sampling phase
   this->set_timeout("read", this->sample_duration_, [this]() {
     this->is_sampling_ = false;
-    this->high_freq_.stop();
+    if (this->block_sampler_ != nullptr)
+      this->block_sampler_->stop();
+    else
+      this->high_freq_.stop();
 
     if (this->num_samples_ == 0) {
       // Shouldn't happen, but let's not crash if it does.
@@ -59,11 +81,43 @@ void CTClampSensor::update() {
 }
 
 void CTClampSensor::loop() {
+  if (this->block_sampler_ != nullptr)
+    return;
   if (!this->is_sampling_ && !this->is_calibrating_offset_)
     return;
 
   // Perform a single sample
-  float value = this->source_->sample();
+  this->process_sample_(this->source_->sample());
+}
+
+void CTClampSensor::on_block_(const float *samples, size_t count) {
+  if (count == 0 || (!this->is_sampling_ && !this->is_calibrating_offset_))
+    return;
+
+  const float mean = voltage_sampler::block_mean(samples, count);
+  if (isnan(mean)) {
+    // Some samples failed, skip those one by one
+    for (size_t i = 0; i < count; i++)
+      this->process_sample_(samples[i]);
+    return;
+  }
+
+  if (this->is_calibrating_offset_) {
+    this->sample_sum_ += mean * count;
+    this->num_samples_ += count;
+    return;
+  }
+
+  // Same low pass filter as in process_sample_(), but the offset is only adjusted once per block. A block is much
+  // shorter than the time constant of the filter (1000 samples), so this tracks the offset just as well.
+  const float alpha = std::min(0.001f * count, 1.0f);
+  this->offset_ = this->offset_ * (1 - alpha) + mean * alpha;
+
+  this->sample_sum_ += voltage_sampler::block_sum_squares(samples, count, this->offset_);
+  this->num_samples_ += count;
+}
+
+void CTClampSensor::process_sample_(float value) {
   if (isnan(value))
     return;
 
@@ -4,6 +4,7 @@
 #include "esphome/core/esphal.h"
 #include "esphome/components/sensor/sensor.h"
 #include "esphome/components/voltage_sampler/voltage_sampler.h"
+#include "esphome/components/voltage_sampler/block_sampler.h"
 
 namespace esphome {
 namespace ct_clamp {
@@ -21,8 +22,13 @@ class CTClampSensor : public sensor::Sensor, public PollingComponent {
 
   void set_sample_duration(uint32_t sample_duration) { sample_duration_ = sample_duration; }
   void set_source(voltage_sampler::VoltageSampler *source) { source_ = source; }
+  /// Take the samples from a block sampler at a fixed rate instead of sampling in loop().
+  void set_block_sampler(voltage_sampler::BlockSampler *block_sampler) { block_sampler_ = block_sampler; }
 
  protected:
+  void process_sample_(float value);
+  void on_block_(const float *samples, size_t count);
+
   /// High Frequency loop() requester used during sampling phase.
   HighFrequencyLoopRequester high_freq_;
 
@@ -30,6 +36,7 @@ class CTClampSensor : public sensor::Sensor, public PollingComponent {
   uint32_t sample_duration_;
   /// The sampling source to read values from.
   voltage_sampler::VoltageSampler *source_;
+  voltage_sampler::BlockSampler *block_sampler_{nullptr};
 
   /** The DC offset of the circuit.
    *
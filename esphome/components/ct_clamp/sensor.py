@@ -5,7 +5,10 @@ from esphome.const import CONF_SENSOR, CONF_ID, ICON_FLASH, UNIT_AMPERE
 
 AUTO_LOAD = ['voltage_sampler']
 
+CONF_BLOCK_SAMPLER_ID = 'block_sampler_id'
+CONF_BLOCK_SIZE = 'block_size'
 CONF_SAMPLE_DURATION = 'sample_duration'
+CONF_SAMPLE_RATE = 'sample_rate'
 
 ct_clamp_ns = cg.esphome_ns.namespace('ct_clamp')
 CTClampSensor = ct_clamp_ns.class_('CTClampSensor', sensor.Sensor, cg.PollingComponent)
@@ -14,9 +17,25 @@ CONFIG_SCHEMA = sensor.sensor_schema(UNIT_AMPERE, ICON_FLASH, 2).extend({
     cv.GenerateID(): cv.declare_id(CTClampSensor),
     cv.Required(CONF_SENSOR): cv.use_id(voltage_sampler.VoltageSampler),
     cv.Optional(CONF_SAMPLE_DURATION, default='200ms'): cv.positive_time_period_milliseconds,
+    cv.Optional(CONF_SAMPLE_RATE): cv.All(cv.frequency, cv.Range(min=100.0, max=20000.0)),
+    cv.Optional(CONF_BLOCK_SIZE, default=64): cv.int_range(min=8, max=1024),
+    cv.GenerateID(CONF_BLOCK_SAMPLER_ID): cv.declare_id(voltage_sampler.BlockSampler),
 }).extend(cv.polling_component_schema('60s'))
 
 
+def validate_block_duration(config):
+    if CONF_SAMPLE_RATE not in config:
+        return config
+    block_duration = config[CONF_BLOCK_SIZE] / config[CONF_SAMPLE_RATE]
+    if block_duration * 1000 > config[CONF_SAMPLE_DURATION].total_milliseconds:
+        raise cv.Invalid("One block of {} samples at {}Hz takes longer than sample_duration, please "
+                         "reduce block_size.".format(config[CONF_BLOCK_SIZE], config[CONF_SAMPLE_RATE]))
+    return config
+
+
+CONFIG_SCHEMA = cv.All(CONFIG_SCHEMA, validate_block_duration)
+
+
 def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
     yield cg.register_component(var, config)
@@ -25,3 +44,9 @@ def to_code(config):
     sens = yield cg.get_variable(config[CONF_SENSOR])
     cg.add(var.set_source(sens))
     cg.add(var.set_sample_duration(config[CONF_SAMPLE_DURATION]))
+
+    if CONF_SAMPLE_RATE in config:
+        sampler = cg.new_Pvariable(config[CONF_BLOCK_SAMPLER_ID], sens,
+                                   int(config[CONF_SAMPLE_RATE]), config[CONF_BLOCK_SIZE])
+        yield cg.register_component(sampler, {})
+        cg.add(var.set_block_sampler(sampler))
@@ -1,5 +1,6 @@
 #include "debug_component.h"
 #include "esphome/core/log.h"
+#include "esphome/core/application.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/defines.h"
 #include "esphome/core/version.h"
@@ -13,6 +14,9 @@ namespace debug {
 
 static const char *TAG = "debug";
 
+/// How often the main loop wakeup rate is measured and logged.
+static const uint32_t WAKEUP_REPORT_INTERVAL = 60000;
+
 void DebugComponent::dump_config() {
 #ifndef ESPHOME_LOG_HAS_DEBUG
   ESP_LOGE(TAG, "Debug Component requires debug log level!");
@@ -23,6 +27,12 @@ void DebugComponent::dump_config() {
   ESP_LOGD(TAG, "ESPHome version %s", ESPHOME_VERSION);
   this->free_heap_ = ESP.getFreeHeap();
   ESP_LOGD(TAG, "Free Heap Size: %u bytes", this->free_heap_);
+  ESP_LOGD(TAG, "Tickless Idle: %s", YESNO(App.is_tickless()));
+#ifdef USE_SENSOR
+  LOG_SENSOR("", "Main Loop Wakeups", this->wakeups_sensor_);
+#endif
+  this->last_loop_count_ = App.get_loop_count();
+  this->last_wakeup_report_ = millis();
 
   const char *flash_mode;
   switch (ESP.getFlashChipMode()) {
@@ -196,7 +206,30 @@ void DebugComponent::dump_config() {
   ESP_LOGD(TAG, "Reset Reason: %s", ESP.getResetReason().c_str());
   ESP_LOGD(TAG, "Reset Info: %s", ESP.getResetInfo().c_str());
 #endif
+
+#ifdef USE_COMPONENT_PROFILER
+  this->dump_component_profile_();
+#endif
+}
+#ifdef USE_COMPONENT_PROFILER
+static void dump_timing_stats(const char *kind, const ComponentTimingStats &stats) {
+  if (stats.count == 0)
+    return;
+  ESP_LOGD(TAG, "    %s: %u calls, avg=%uus max=%uus ewma=%uus", kind, stats.count,
+           uint32_t(stats.total_us / stats.count), stats.max_us, stats.ewma_us);
 }
+void DebugComponent::dump_component_profile_() {
+  ESP_LOGD(TAG, "Component Profile:");
+  for (auto *component : App.get_components()) {
+    auto &profile = component->get_profile();
+    ESP_LOGD(TAG, "  %s:", component->get_component_source());
+    dump_timing_stats("setup", profile.setup);
+    dump_timing_stats("loop", profile.loop);
+    dump_timing_stats("scheduler", profile.scheduler);
+    dump_timing_stats("update", profile.update);
+  }
+}
+#endif
 void DebugComponent::loop() {
   uint32_t new_free_heap = ESP.getFreeHeap();
   if (new_free_heap < this->free_heap_ / 2) {
@@ -204,7 +237,21 @@ void DebugComponent::loop() {
     ESP_LOGD(TAG, "Free Heap Size: %u bytes", this->free_heap_);
     this->status_momentary_warning("heap", 1000);
   }
+
+  const uint32_t now = millis();
+  if (now - this->last_wakeup_report_ >= WAKEUP_REPORT_INTERVAL) {
+    const uint32_t loop_count = App.get_loop_count();
+    this->wakeups_per_second_ = (loop_count - this->last_loop_count_) * 1000.0f / (now - this->last_wakeup_report_);
+    this->last_loop_count_ = loop_count;
+    this->last_wakeup_report_ = now;
+    ESP_LOGD(TAG, "Main Loop Wakeups: %.1f/s", this->wakeups_per_second_);
+#ifdef USE_SENSOR
+    if (this->wakeups_sensor_ != nullptr)
+      this->wakeups_sensor_->publish_state(this->wakeups_per_second_);
+#endif
+  }
 }
+uint32_t DebugComponent::next_wake_in() { return 1000; }
 float DebugComponent::get_setup_priority() const { return setup_priority::LATE; }
 
 }  // namespace debug
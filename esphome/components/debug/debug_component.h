@@ -1,6 +1,11 @@
 #pragma once
 
 #include "esphome/core/component.h"
+#include "esphome/core/defines.h"
+
+#ifdef USE_SENSOR
+#include "esphome/components/sensor/sensor.h"
+#endif
 
 namespace esphome {
 namespace debug {
@@ -8,11 +13,29 @@ namespace debug {
 class DebugComponent : public Component {
  public:
   void loop() override;
+  uint32_t next_wake_in() override;
   float get_setup_priority() const override;
   void dump_config() override;
 
+  /// Main loop iterations per second, averaged over the last minute.
+  float get_wakeups_per_second() const { return this->wakeups_per_second_; }
+#ifdef USE_SENSOR
+  /// Publish the main loop wakeups per second to this sensor every minute.
+  void set_wakeups_sensor(sensor::Sensor *wakeups_sensor) { this->wakeups_sensor_ = wakeups_sensor; }
+#endif
+
  protected:
+#ifdef USE_COMPONENT_PROFILER
+  void dump_component_profile_();
+#endif
+
   uint32_t free_heap_{};
+  uint32_t last_loop_count_{0};
+  uint32_t last_wakeup_report_{0};
+  float wakeups_per_second_{NAN};
+#ifdef USE_SENSOR
+  sensor::Sensor *wakeups_sensor_{nullptr};
+#endif
 };
 
 }  // namespace debug
@@ -0,0 +1,23 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.components import sensor
+from esphome.const import CONF_ID, ICON_TIMER
+from . import DebugComponent
+
+DEPENDENCIES = ['debug']
+
+CONF_DEBUG_ID = 'debug_id'
+UNIT_WAKEUPS_PER_SECOND = 'wakeups/s'
+
+CONFIG_SCHEMA = sensor.sensor_schema(UNIT_WAKEUPS_PER_SECOND, ICON_TIMER, 1).extend({
+    cv.GenerateID(): cv.declare_id(sensor.Sensor),
+    cv.GenerateID(CONF_DEBUG_ID): cv.use_id(DebugComponent),
+})
+
+
+def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    yield sensor.register_sensor(var, config)
+
+    debug = yield cg.get_variable(config[CONF_DEBUG_ID])
+    cg.add(debug.set_wakeups_sensor(var))
@@ -9,6 +9,77 @@ static const char *TAG = "display";
 
 const uint8_t COLOR_OFF = 0;
 const uint8_t COLOR_ON = 1;
+const int COLOR_RGB = 0x1000000;
+
+int rgb(uint8_t red, uint8_t green, uint8_t blue) { return COLOR_RGB | (red << 16) | (green << 8) | blue; }
+int gray(uint8_t level) { return rgb(level, level, level); }
+
+static bool swaps_axes(DisplayRotation rotation) {
+  return rotation == DISPLAY_ROTATION_90_DEGREES || rotation == DISPLAY_ROTATION_270_DEGREES;
+}
+/** Convert a rectangle from rotated to unrotated coordinates, for a buffer with the given unrotated size.
+ *
+ * Same transformation as in DisplayBuffer::draw_pixel_at(), applied to the corners.
+ */
+static void unrotate_rect(DisplayRotation rotation, int buffer_width, int buffer_height, int *x, int *y, int *width,
+                          int *height) {
+  const int x1 = *x, y1 = *y, w = *width, h = *height;
+  switch (rotation) {
+    case DISPLAY_ROTATION_0_DEGREES:
+      break;
+    case DISPLAY_ROTATION_90_DEGREES:
+      *x = buffer_width - y1 - h;
+      *y = x1;
+      *width = h;
+      *height = w;
+      break;
+    case DISPLAY_ROTATION_180_DEGREES:
+      *x = buffer_width - x1 - w;
+      *y = buffer_height - y1 - h;
+      break;
+    case DISPLAY_ROTATION_270_DEGREES:
+      *x = y1;
+      *y = buffer_height - x1 - w;
+      *width = h;
+      *height = w;
+      break;
+  }
+}
+/// The inverse of unrotate_rect().
+static void rotate_rect(DisplayRotation rotation, int buffer_width, int buffer_height, int *x, int *y, int *width,
+                        int *height) {
+  const int x1 = *x, y1 = *y, w = *width, h = *height;
+  switch (rotation) {
+    case DISPLAY_ROTATION_0_DEGREES:
+      break;
+    case DISPLAY_ROTATION_90_DEGREES:
+      *x = y1;
+      *y = buffer_width - x1 - w;
+      *width = h;
+      *height = w;
+      break;
+    case DISPLAY_ROTATION_180_DEGREES:
+      *x = buffer_width - x1 - w;
+      *y = buffer_height - y1 - h;
+      break;
+    case DISPLAY_ROTATION_270_DEGREES:
+      *x = buffer_height - y1 - h;
+      *y = x1;
+      *width = h;
+      *height = w;
+      break;
+  }
+}
+/// Whether pixel [x,y] of a width x height image stored for rotation is set, data is not run length encoded.
+static bool get_bitmap_pixel(const uint8_t *data, DisplayRotation rotation, int width, int height, int x, int y) {
+  int stored_width = width, stored_height = height, pixel_width = 1, pixel_height = 1;
+  if (swaps_axes(rotation))
+    std::swap(stored_width, stored_height);
+  unrotate_rect(rotation, stored_width, stored_height, &x, &y, &pixel_width, &pixel_height);
+  const uint32_t width_8 = ((stored_width + 7u) / 8u) * 8u;
+  const uint32_t pos = x + y * width_8;
+  return pgm_read_byte(data + (pos / 8u)) & (0x80 >> (pos % 8u));
+}
 
 void DisplayBuffer::init_internal_(uint32_t buffer_length) {
   this->buffer_ = new uint8_t[buffer_length];
@@ -16,7 +87,16 @@ void DisplayBuffer::init_internal_(uint32_t buffer_length) {
     ESP_LOGE(TAG, "Could not allocate buffer for display!");
     return;
   }
+  const size_t bands = (this->get_height_internal() + DIRTY_BAND_HEIGHT - 1) / DIRTY_BAND_HEIGHT;
+  this->drawn_.resize(bands);
+  this->dirty_.resize(bands);
+  for (auto &span : this->dirty_)
+    span.clear();
+  for (auto &span : this->drawn_)
+    span.clear();
   this->clear();
+  // the display contents are unknown, send everything on the first update
+  this->mark_dirty_(0, 0, this->get_width_internal() - 1, this->get_height_internal() - 1);
 }
 void DisplayBuffer::fill(int color) { this->filled_rectangle(0, 0, this->get_width(), this->get_height(), color); }
 void DisplayBuffer::clear() { this->fill(COLOR_OFF); }
@@ -60,7 +140,13 @@ void HOT DisplayBuffer::draw_pixel_at(int x, int y, int color) {
       y = this->get_height_internal() - y - 1;
       break;
   }
-  this->draw_absolute_pixel_internal(x, y, color);
+  this->draw_absolute_pixel_internal(x, y, this->native_color_(color));
+  // pixels off the display are clipped by the driver, they must not widen the span of their band
+  if (x >= 0 && y >= 0 && x < this->get_width_internal() && y < this->get_height_internal()) {
+    const uint32_t band = y / DIRTY_BAND_HEIGHT;
+    if (band < this->drawn_.size())
+      this->drawn_[band].add(x, x);
+  }
   App.feed_wdt();
 }
 void HOT DisplayBuffer::line(int x1, int y1, int x2, int y2, int color) {
@@ -83,16 +169,8 @@ void HOT DisplayBuffer::line(int x1, int y1, int x2, int y2, int color) {
     }
   }
 }
-void HOT DisplayBuffer::horizontal_line(int x, int y, int width, int color) {
-  // Future: Could be made more efficient by manipulating buffer directly in certain rotations.
-  for (int i = x; i < x + width; i++)
-    this->draw_pixel_at(i, y, color);
-}
-void HOT DisplayBuffer::vertical_line(int x, int y, int height, int color) {
-  // Future: Could be made more efficient by manipulating buffer directly in certain rotations.
-  for (int i = y; i < y + height; i++)
-    this->draw_pixel_at(x, i, color);
-}
+void HOT DisplayBuffer::horizontal_line(int x, int y, int width, int color) { this->fill_rect_(x, y, width, 1, color); }
+void HOT DisplayBuffer::vertical_line(int x, int y, int height, int color) { this->fill_rect_(x, y, 1, height, color); }
 void DisplayBuffer::rectangle(int x1, int y1, int width, int height, int color) {
   this->horizontal_line(x1, y1, width, color);
   this->horizontal_line(x1, y1 + height - 1, width, color);
@@ -100,9 +178,178 @@ void DisplayBuffer::rectangle(int x1, int y1, int width, int height, int color)
   this->vertical_line(x1 + width - 1, y1, height, color);
 }
 void DisplayBuffer::filled_rectangle(int x1, int y1, int width, int height, int color) {
-  // Future: Use vertical_line and horizontal_line methods depending on rotation to reduce memory accesses.
-  for (int i = y1; i < y1 + height; i++) {
-    this->horizontal_line(x1, i, width, color);
+  this->fill_rect_(x1, y1, width, height, color);
+}
+void DisplayBuffer::unrotate_rect_(int *x, int *y, int *width, int *height) {
+  unrotate_rect(this->rotation_, this->get_width_internal(), this->get_height_internal(), x, y, width, height);
+}
+void HOT DisplayBuffer::fill_rect_(int x, int y, int width, int height, int color) {
+  if (width <= 0 || height <= 0)
+    return;
+  this->unrotate_rect_(&x, &y, &width, &height);
+  const int x2 = std::min(x + width, this->get_width_internal());
+  const int y2 = std::min(y + height, this->get_height_internal());
+  x = std::max(x, 0);
+  y = std::max(y, 0);
+  if (x >= x2 || y >= y2)
+    return;
+  this->mark_dirty_(x, y, x2 - 1, y2 - 1);
+  this->fill_rect_internal(x, y, x2 - x, y2 - y, this->native_color_(color));
+  App.feed_wdt();
+}
+void HOT DisplayBuffer::blit_1bpp_(int x, int y, int width, int height, const uint8_t *data,
+                                   DisplayRotation data_rotation, int color, bool opaque) {
+  if (width <= 0 || height <= 0)
+    return;
+  int stored_width = width, stored_height = height;
+  if (swaps_axes(data_rotation))
+    std::swap(stored_width, stored_height);
+  const int stride = (stored_width + 7) / 8;
+  color = this->native_color_(color);
+  // the bitmap in unrotated coordinates, it has the same orientation as the data if the rotations match
+  int dst_x = x, dst_y = y, dst_width = width, dst_height = height;
+  this->unrotate_rect_(&dst_x, &dst_y, &dst_width, &dst_height);
+
+  if (data_rotation != this->rotation_) {
+    this->mark_dirty_(dst_x, dst_y, dst_x + dst_width - 1, dst_y + dst_height - 1);
+    // The data has to be rotated pixel by pixel, the driver clips them
+    for (int src_y = 0; src_y < stored_height; src_y++) {
+      const uint8_t *row = data + src_y * stride;
+      for (int src_x = 0; src_x < stored_width; src_x++) {
+        const bool on = pgm_read_byte(row + src_x / 8) & (0x80 >> (src_x % 8));
+        if (!on && !opaque)
+          continue;
+        int pixel_x = src_x, pixel_y = src_y, pixel_width = 1, pixel_height = 1;
+        rotate_rect(data_rotation, stored_width, stored_height, &pixel_x, &pixel_y, &pixel_width, &pixel_height);
+        pixel_x += x;
+        pixel_y += y;
+        this->unrotate_rect_(&pixel_x, &pixel_y, &pixel_width, &pixel_height);
+        this->draw_absolute_pixel_internal(pixel_x, pixel_y, on ? color : COLOR_OFF);
+      }
+    }
+    App.feed_wdt();
+    return;
+  }
+
+  const int x1 = std::max(dst_x, 0), y1 = std::max(dst_y, 0);
+  const int x2 = std::min(dst_x + dst_width, this->get_width_internal());
+  const int y2 = std::min(dst_y + dst_height, this->get_height_internal());
+  if (x1 >= x2 || y1 >= y2)
+    return;
+  this->mark_dirty_(x1, y1, x2 - 1, y2 - 1);
+  this->blit_1bpp_internal(x1, y1, x2 - x1, y2 - y1, data, stride, x1 - dst_x, y1 - dst_y, color, opaque);
+  App.feed_wdt();
+}
+void HOT DisplayBuffer::blit_alpha_4bpp_(int x, int y, int width, int height, const uint8_t *data,
+                                        DisplayRotation data_rotation, int color) {
+  if (width <= 0 || height <= 0)
+    return;
+  int stored_width = width, stored_height = height;
+  if (swaps_axes(data_rotation))
+    std::swap(stored_width, stored_height);
+  const int stride = (stored_width + 1) / 2;
+  const int display_width = this->get_width_internal(), display_height = this->get_height_internal();
+  const bool mono = this->pixel_format_ == PIXEL_FORMAT_MONO;
+  color = this->native_color_(color);
+  int dst_x = x, dst_y = y, dst_width = width, dst_height = height;
+  this->unrotate_rect_(&dst_x, &dst_y, &dst_width, &dst_height);
+  this->mark_dirty_(dst_x, dst_y, dst_x + dst_width - 1, dst_y + dst_height - 1);
+
+  for (int src_y = 0; src_y < stored_height; src_y++) {
+    const uint8_t *row = data + src_y * stride;
+    for (int src_x = 0; src_x < stored_width; src_x++) {
+      const uint8_t byte = pgm_read_byte(row + src_x / 2);
+      const uint8_t alpha = src_x % 2 ? byte & 0x0F : byte >> 4;
+      // monochrome displays can't blend, draw the pixels that are at least half covered
+      if (alpha == 0 || (mono && alpha < 8))
+        continue;
+      int pixel_x = dst_x + src_x, pixel_y = dst_y + src_y;
+      if (data_rotation != this->rotation_) {
+        int pixel_width = 1, pixel_height = 1;
+        pixel_x = src_x;
+        pixel_y = src_y;
+        rotate_rect(data_rotation, stored_width, stored_height, &pixel_x, &pixel_y, &pixel_width, &pixel_height);
+        pixel_x += x;
+        pixel_y += y;
+        this->unrotate_rect_(&pixel_x, &pixel_y, &pixel_width, &pixel_height);
+      }
+      if (pixel_x < 0 || pixel_x >= display_width || pixel_y < 0 || pixel_y >= display_height)
+        continue;
+      int pixel_color = color;
+      if (!mono && alpha != 0x0F)
+        pixel_color = this->blend_native_(this->get_absolute_pixel_internal(pixel_x, pixel_y), color, alpha);
+      this->draw_absolute_pixel_internal(pixel_x, pixel_y, pixel_color);
+    }
+  }
+  App.feed_wdt();
+}
+void DisplayBuffer::image_rle_(int x, int y, Image *image) {
+  int stored_width = image->width_, stored_height = image->height_;
+  if (swaps_axes(image->rotation_))
+    std::swap(stored_width, stored_height);
+  const uint8_t *data = image->data_start_;
+  const int total = stored_width * stored_height;
+  int pos = 0;
+  while (pos < total) {
+    const uint8_t run = pgm_read_byte(data++);
+    const int color = run & 0x80 ? COLOR_ON : COLOR_OFF;
+    int length = (run & 0x7F) + 1;
+    // runs continue on the next row, draw them as one span per row
+    while (length > 0 && pos < total) {
+      int span_x = pos % stored_width, span_y = pos / stored_width;
+      int span_width = std::min(length, stored_width - span_x), span_height = 1;
+      pos += span_width;
+      length -= span_width;
+      rotate_rect(image->rotation_, stored_width, stored_height, &span_x, &span_y, &span_width, &span_height);
+      this->fill_rect_(x + span_x, y + span_y, span_width, span_height, color);
+    }
+  }
+}
+void DisplayBuffer::image_grayscale_(int x, int y, Image *image) {
+  int stored_width = image->width_, stored_height = image->height_;
+  if (swaps_axes(image->rotation_))
+    std::swap(stored_width, stored_height);
+  const int display_width = this->get_width_internal(), display_height = this->get_height_internal();
+  int dst_x = x, dst_y = y, dst_width = image->width_, dst_height = image->height_;
+  this->unrotate_rect_(&dst_x, &dst_y, &dst_width, &dst_height);
+  this->mark_dirty_(dst_x, dst_y, dst_x + dst_width - 1, dst_y + dst_height - 1);
+
+  const uint8_t *data = image->data_start_;
+  for (int src_y = 0; src_y < stored_height; src_y++) {
+    for (int src_x = 0; src_x < stored_width; src_x++) {
+      const uint8_t level = pgm_read_byte(data++);
+      int pixel_x = src_x, pixel_y = src_y, pixel_width = 1, pixel_height = 1;
+      rotate_rect(image->rotation_, stored_width, stored_height, &pixel_x, &pixel_y, &pixel_width, &pixel_height);
+      pixel_x += x;
+      pixel_y += y;
+      this->unrotate_rect_(&pixel_x, &pixel_y, &pixel_width, &pixel_height);
+      if (pixel_x < 0 || pixel_x >= display_width || pixel_y < 0 || pixel_y >= display_height)
+        continue;
+      this->draw_absolute_pixel_internal(pixel_x, pixel_y, this->native_color_(gray(level)));
+    }
+  }
+  App.feed_wdt();
+}
+int DisplayBuffer::get_absolute_pixel_internal(int x, int y) { return 0; }
+void HOT DisplayBuffer::fill_span_internal(int x, int y, int width, int color) {
+  for (int i = x; i < x + width; i++)
+    this->draw_absolute_pixel_internal(i, y, color);
+}
+void HOT DisplayBuffer::fill_rect_internal(int x, int y, int width, int height, int color) {
+  for (int i = y; i < y + height; i++)
+    this->fill_span_internal(x, i, width, color);
+}
+void HOT DisplayBuffer::blit_1bpp_internal(int x, int y, int width, int height, const uint8_t *data, int stride,
+                                           int src_x, int src_y, int color, bool opaque) {
+  for (int row = 0; row < height; row++) {
+    const uint8_t *src = data + (src_y + row) * stride;
+    for (int col = 0; col < width; col++) {
+      const int bit = src_x + col;
+      if (pgm_read_byte(src + bit / 8) & (0x80 >> (bit % 8)))
+        this->draw_absolute_pixel_internal(x + col, y + row, color);
+      else if (opaque)
+        this->draw_absolute_pixel_internal(x + col, y + row, COLOR_OFF);
+    }
   }
 }
 void HOT DisplayBuffer::circle(int center_x, int center_xy, int radius, int color) {
@@ -170,9 +417,7 @@ void DisplayBuffer::print(int x, int y, Font *font, int color, TextAlign align,
       ESP_LOGW(TAG, "Encountered character without representation in font: '%c'", text[i]);
       if (!font->get_glyphs().empty()) {
         uint8_t glyph_width = font->get_glyphs()[0].width_;
-        for (int glyph_x = 0; glyph_x < glyph_width; glyph_x++)
-          for (int glyph_y = 0; glyph_y < height; glyph_y++)
-            this->draw_pixel_at(glyph_x + x_at, glyph_y + y_start, color);
+        this->fill_rect_(x_at, y_start, glyph_width, height, color);
         x_at += glyph_width;
       }
 
@@ -181,15 +426,12 @@ void DisplayBuffer::print(int x, int y, Font *font, int color, TextAlign align,
     }
 
     const Glyph &glyph = font->get_glyphs()[glyph_n];
-    int scan_x1, scan_y1, scan_width, scan_height;
-    glyph.scan_area(&scan_x1, &scan_y1, &scan_width, &scan_height);
-
-    for (int glyph_x = scan_x1; glyph_x < scan_x1 + scan_width; glyph_x++) {
-      for (int glyph_y = scan_y1; glyph_y < scan_y1 + scan_height; glyph_y++) {
-        if (glyph.get_pixel(glyph_x, glyph_y)) {
-          this->draw_pixel_at(glyph_x + x_at, glyph_y + y_start, color);
-        }
-      }
+    if (glyph.bpp_ == 4) {
+      this->blit_alpha_4bpp_(x_at + glyph.offset_x_, y_start + glyph.offset_y_, glyph.width_, glyph.height_,
+                             glyph.data_, glyph.rotation_, color);
+    } else {
+      this->blit_1bpp_(x_at + glyph.offset_x_, y_start + glyph.offset_y_, glyph.width_, glyph.height_, glyph.data_,
+                       glyph.rotation_, color, false);
     }
 
     x_at += glyph.width_ + glyph.offset_x_;
@@ -204,11 +446,18 @@ void DisplayBuffer::vprintf_(int x, int y, Font *font, int color, TextAlign alig
     this->print(x, y, font, color, align, buffer);
 }
 void DisplayBuffer::image(int x, int y, Image *image) {
-  for (int img_x = 0; img_x < image->get_width(); img_x++) {
-    for (int img_y = 0; img_y < image->get_height(); img_y++) {
-      this->draw_pixel_at(x + img_x, y + img_y, image->get_pixel(img_x, img_y) ? COLOR_ON : COLOR_OFF);
-    }
+  switch (image->type_) {
+    case IMAGE_TYPE_BINARY_RLE:
+      this->image_rle_(x, y, image);
+      return;
+    case IMAGE_TYPE_GRAYSCALE:
+      this->image_grayscale_(x, y, image);
+      return;
+    case IMAGE_TYPE_BINARY:
+    default:
+      break;
   }
+  this->blit_1bpp_(x, y, image->width_, image->height_, image->data_start_, image->rotation_, COLOR_ON, true);
 }
 void DisplayBuffer::get_text_bounds(int x, int y, const char *text, Font *font, TextAlign align, int *x1, int *y1,
                                     int *width, int *height) {
@@ -297,8 +546,179 @@ void DisplayBuffer::set_pages(std::vector<DisplayPage *> pages) {
 void DisplayBuffer::show_page(DisplayPage *page) { this->page_ = page; }
 void DisplayBuffer::show_next_page() { this->page_->show_next(); }
 void DisplayBuffer::show_prev_page() { this->page_->show_prev(); }
+int DisplayBuffer::convert_color_(int color) {
+  uint8_t red, green, blue;
+  if (color & COLOR_RGB) {
+    red = color >> 16;
+    green = color >> 8;
+    blue = color;
+  } else {
+    red = green = blue = color ? 255 : 0;
+  }
+  // BT.601 luma with 8 fractional bits, the weights add up to 256
+  const uint8_t luma = (red * 77 + green * 150 + blue * 29) >> 8;
+  switch (this->pixel_format_) {
+    case PIXEL_FORMAT_GRAY4:
+      return luma >> 4;
+    case PIXEL_FORMAT_GRAY8:
+      return luma;
+    case PIXEL_FORMAT_RGB565:
+      return ((red & 0xF8) << 8) | ((green & 0xFC) << 3) | (blue >> 3);
+    case PIXEL_FORMAT_MONO:
+    default:
+      return luma >= 128 ? COLOR_ON : COLOR_OFF;
+  }
+}
+int DisplayBuffer::blend_native_(int bg, int fg, uint8_t alpha) {
+  switch (this->pixel_format_) {
+    case PIXEL_FORMAT_GRAY4:
+    case PIXEL_FORMAT_GRAY8:
+      return bg + (fg - bg) * alpha / 15;
+    case PIXEL_FORMAT_RGB565: {
+      const int red = (bg >> 11) + ((fg >> 11) - (bg >> 11)) * alpha / 15;
+      const int green = ((bg >> 5) & 0x3F) + (((fg >> 5) & 0x3F) - ((bg >> 5) & 0x3F)) * alpha / 15;
+      const int blue = (bg & 0x1F) + ((fg & 0x1F) - (bg & 0x1F)) * alpha / 15;
+      return (red << 11) | (green << 5) | blue;
+    }
+    case PIXEL_FORMAT_MONO:
+    default:
+      return alpha >= 8 ? fg : bg;
+  }
+}
+size_t DisplayBuffer::get_packed_buffer_length_() {
+  const size_t stride = (size_t(this->get_width_internal()) * this->pixel_format_ + 7u) / 8u;
+  return stride * size_t(this->get_height_internal());
+}
+void HOT DisplayBuffer::set_packed_pixel_(int x, int y, int color) {
+  const uint32_t stride = (uint32_t(this->get_width_internal()) * this->pixel_format_ + 7u) / 8u;
+  uint8_t *row = this->buffer_ + y * stride;
+  switch (this->pixel_format_) {
+    case PIXEL_FORMAT_MONO:
+      if (color)
+        row[x / 8] |= 0x80 >> (x % 8);
+      else
+        row[x / 8] &= ~(0x80 >> (x % 8));
+      break;
+    case PIXEL_FORMAT_GRAY4:
+      if (x % 2)
+        row[x / 2] = (row[x / 2] & 0xF0) | (color & 0x0F);
+      else
+        row[x / 2] = (row[x / 2] & 0x0F) | (color << 4);
+      break;
+    case PIXEL_FORMAT_GRAY8:
+      row[x] = color;
+      break;
+    case PIXEL_FORMAT_RGB565:
+      row[x * 2] = color >> 8;
+      row[x * 2 + 1] = color;
+      break;
+  }
+}
+int HOT DisplayBuffer::get_packed_pixel_(int x, int y) {
+  const uint32_t stride = (uint32_t(this->get_width_internal()) * this->pixel_format_ + 7u) / 8u;
+  const uint8_t *row = this->buffer_ + y * stride;
+  switch (this->pixel_format_) {
+    case PIXEL_FORMAT_GRAY4:
+      return x % 2 ? row[x / 2] & 0x0F : row[x / 2] >> 4;
+    case PIXEL_FORMAT_GRAY8:
+      return row[x];
+    case PIXEL_FORMAT_RGB565:
+      return (row[x * 2] << 8) | row[x * 2 + 1];
+    case PIXEL_FORMAT_MONO:
+    default:
+      return (row[x / 8] & (0x80 >> (x % 8))) ? COLOR_ON : COLOR_OFF;
+  }
+}
+void HOT DisplayBuffer::fill_packed_span_(int x, int y, int width, int color) {
+  const uint32_t stride = (uint32_t(this->get_width_internal()) * this->pixel_format_ + 7u) / 8u;
+  uint8_t *row = this->buffer_ + y * stride;
+  int x2 = x + width;
+  switch (this->pixel_format_) {
+    case PIXEL_FORMAT_GRAY4:
+      // odd first and last pixels share their byte with a neighbour
+      if (x % 2)
+        this->set_packed_pixel_(x++, y, color);
+      if (x < x2 && x2 % 2)
+        this->set_packed_pixel_(--x2, y, color);
+      if (x < x2)
+        memset(row + x / 2, (color << 4) | (color & 0x0F), (x2 - x) / 2);
+      return;
+    case PIXEL_FORMAT_GRAY8:
+      memset(row + x, color, width);
+      return;
+    case PIXEL_FORMAT_RGB565:
+      for (int i = x; i < x2; i++) {
+        row[i * 2] = color >> 8;
+        row[i * 2 + 1] = color;
+      }
+      return;
+    case PIXEL_FORMAT_MONO:
+    default:
+      while (x < x2 && x % 8)
+        this->set_packed_pixel_(x++, y, color);
+      while (x < x2 && x2 % 8)
+        this->set_packed_pixel_(--x2, y, color);
+      if (x < x2)
+        memset(row + x / 8, color ? 0xFF : 0x00, (x2 - x) / 8);
+      return;
+  }
+}
+void DisplayBuffer::mark_dirty_(int x1, int y1, int x2, int y2) {
+  x1 = std::max(x1, 0);
+  x2 = std::min(x2, this->get_width_internal() - 1);
+  y1 = std::max(y1, 0);
+  y2 = std::min(y2, this->get_height_internal() - 1);
+  if (x1 > x2 || y1 > y2)
+    return;
+  for (int band = y1 / DIRTY_BAND_HEIGHT; band <= y2 / DIRTY_BAND_HEIGHT && band < int(this->drawn_.size()); band++)
+    this->drawn_[band].add(x1, x2);
+}
+bool DisplayBuffer::get_dirty_span_(int band, int *x1, int *x2) {
+  if (band < 0 || band >= int(this->dirty_.size()))
+    return false;
+  DirtySpan span = this->dirty_[band];
+  const DirtySpan &drawn = this->drawn_[band];
+  if (!drawn.empty())
+    span.add(drawn.x1, drawn.x2);
+  if (span.empty())
+    return false;
+  *x1 = span.x1;
+  *x2 = std::min<int>(span.x2, this->get_width_internal() - 1);
+  return *x1 <= *x2;
+}
+bool DisplayBuffer::get_dirty_region_(int *x1, int *y1, int *x2, int *y2) {
+  bool any = false;
+  for (int band = 0; band < int(this->dirty_.size()); band++) {
+    int span_x1, span_x2;
+    if (!this->get_dirty_span_(band, &span_x1, &span_x2))
+      continue;
+    if (!any) {
+      *x1 = span_x1;
+      *x2 = span_x2;
+      *y1 = band * DIRTY_BAND_HEIGHT;
+      any = true;
+    }
+    *x1 = std::min(*x1, span_x1);
+    *x2 = std::max(*x2, span_x2);
+    *y2 = std::min(band * DIRTY_BAND_HEIGHT + DIRTY_BAND_HEIGHT, this->get_height_internal()) - 1;
+  }
+  return any;
+}
+void DisplayBuffer::clear_dirty_() {
+  for (auto &span : this->dirty_)
+    span.clear();
+}
 void DisplayBuffer::do_update_() {
+  // Everything drawn in the last frame may be cleared by this one, so it has to be sent again.
+  for (size_t band = 0; band < this->drawn_.size(); band++) {
+    const DirtySpan &drawn = this->drawn_[band];
+    if (!drawn.empty())
+      this->dirty_[band].add(drawn.x1, drawn.x2);
+  }
   this->clear();
+  // only what is drawn on top of the cleared buffer counts for this frame
+  for (auto &span : this->drawn_)
+    span.clear();
   if (this->page_ != nullptr) {
     this->page_->get_writer()(*this);
   } else if (this->writer_.has_value()) {
@@ -325,21 +745,30 @@ void DisplayBuffer::strftime(int x, int y, Font *font, const char *format, time:
 #endif
 
 Glyph::Glyph(const char *a_char, const uint8_t *data_start, uint32_t offset, int offset_x, int offset_y, int width,
-             int height)
+             int height, DisplayRotation rotation, uint8_t bpp)
     : char_(a_char),
       data_(data_start + offset),
       offset_x_(offset_x),
       offset_y_(offset_y),
       width_(width),
-      height_(height) {}
+      height_(height),
+      rotation_(rotation),
+      bpp_(bpp) {}
 bool Glyph::get_pixel(int x, int y) const {
-  const int x_data = x - this->offset_x_;
-  const int y_data = y - this->offset_y_;
+  int x_data = x - this->offset_x_;
+  int y_data = y - this->offset_y_;
   if (x_data < 0 || x_data >= this->width_ || y_data < 0 || y_data >= this->height_)
     return false;
-  const uint32_t width_8 = ((this->width_ + 7u) / 8u) * 8u;
-  const uint32_t pos = x_data + y_data * width_8;
-  return pgm_read_byte(this->data_ + (pos / 8u)) & (0x80 >> (pos % 8u));
+  if (this->bpp_ == 1)
+    return get_bitmap_pixel(this->data_, this->rotation_, this->width_, this->height_, x_data, y_data);
+
+  // anti-aliased, the pixel is set if it's at least half covered
+  int stored_width = this->width_, stored_height = this->height_, pixel_width = 1, pixel_height = 1;
+  if (swaps_axes(this->rotation_))
+    std::swap(stored_width, stored_height);
+  unrotate_rect(this->rotation_, stored_width, stored_height, &x_data, &y_data, &pixel_width, &pixel_height);
+  const uint8_t byte = pgm_read_byte(this->data_ + y_data * ((stored_width + 1) / 2) + x_data / 2);
+  return (x_data % 2 ? byte & 0x0F : byte >> 4) >= 8;
 }
 const char *Glyph::get_char() const { return this->char_; }
 bool Glyph::compare_to(const char *str) const {
@@ -427,14 +856,29 @@ Font::Font(std::vector<Glyph> &&glyphs, int baseline, int bottom)
 bool Image::get_pixel(int x, int y) const {
   if (x < 0 || x >= this->width_ || y < 0 || y >= this->height_)
     return false;
-  const uint32_t width_8 = ((this->width_ + 7u) / 8u) * 8u;
-  const uint32_t pos = x + y * width_8;
-  return pgm_read_byte(this->data_start_ + (pos / 8u)) & (0x80 >> (pos % 8u));
+  if (this->type_ == IMAGE_TYPE_BINARY)
+    return get_bitmap_pixel(this->data_start_, this->rotation_, this->width_, this->height_, x, y);
+
+  int stored_width = this->width_, stored_height = this->height_, pixel_width = 1, pixel_height = 1;
+  if (swaps_axes(this->rotation_))
+    std::swap(stored_width, stored_height);
+  unrotate_rect(this->rotation_, stored_width, stored_height, &x, &y, &pixel_width, &pixel_height);
+  if (this->type_ == IMAGE_TYPE_GRAYSCALE)
+    return pgm_read_byte(this->data_start_ + x + y * stored_width) >= 128;
+
+  const int target = x + y * stored_width;
+  const uint8_t *data = this->data_start_;
+  for (int pos = 0;;) {
+    const uint8_t run = pgm_read_byte(data++);
+    pos += (run & 0x7F) + 1;
+    if (pos > target)
+      return run & 0x80;
+  }
 }
 int Image::get_width() const { return this->width_; }
 int Image::get_height() const { return this->height_; }
-Image::Image(const uint8_t *data_start, int width, int height)
-    : width_(width), height_(height), data_start_(data_start) {}
+Image::Image(const uint8_t *data_start, int width, int height, DisplayRotation rotation, ImageType type)
+    : width_(width), height_(height), data_start_(data_start), rotation_(rotation), type_(type) {}
 
 DisplayPage::DisplayPage(const display_writer_t &writer) : writer_(writer) {}
 void DisplayPage::show() { this->parent_->show_page(this); }
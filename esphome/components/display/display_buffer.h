@@ -4,6 +4,10 @@
 #include "esphome/core/defines.h"
 #include "esphome/core/automation.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
 #ifdef USE_TIME
 #include "esphome/components/time/real_time_clock.h"
 #endif
@@ -66,6 +70,31 @@ enum class TextAlign {
 extern const uint8_t COLOR_OFF;
 /// Turn the pixel ON.
 extern const uint8_t COLOR_ON;
+/// Set in colors created with rgb() or gray(), all other colors are treated as COLOR_OFF (0) or COLOR_ON (non-zero).
+extern const int COLOR_RGB;
+
+/** Create a color from 8-bit red, green and blue values.
+ *
+ * Colors are converted to the pixel format of the display when drawing, monochrome displays turn the pixel on if the
+ * color is brighter than 50% gray.
+ */
+int rgb(uint8_t red, uint8_t green, uint8_t blue);
+/// Create a gray color from its brightness (0 is black, 255 white), see rgb().
+int gray(uint8_t level);
+
+/** The native pixel format of a display, the value is the number of bits per pixel.
+ *
+ * Colors passed to the *_internal() methods of DisplayBuffer are already converted to this format: 0/1 for
+ * monochrome, the gray level or the RGB565 value.
+ */
+enum PixelFormat {
+  PIXEL_FORMAT_MONO = 1,
+  /// 16 gray levels, packed buffers store the left pixel in the high nibble.
+  PIXEL_FORMAT_GRAY4 = 4,
+  PIXEL_FORMAT_GRAY8 = 8,
+  /// 5 bits red, 6 bits green, 5 bits blue, packed buffers store it big endian like the controllers expect it.
+  PIXEL_FORMAT_RGB565 = 16,
+};
 
 enum DisplayRotation {
   DISPLAY_ROTATION_0_DEGREES = 0,
@@ -289,20 +318,129 @@ class DisplayBuffer {
   /// Internal method to set the display rotation with.
   void set_rotation(DisplayRotation rotation);
 
+  PixelFormat get_pixel_format() const { return this->pixel_format_; }
+
  protected:
   void vprintf_(int x, int y, Font *font, int color, TextAlign align, const char *format, va_list arg);
 
   virtual void draw_absolute_pixel_internal(int x, int y, int color) = 0;
 
+  /** Get the color of the pixel at [x,y] (unrotated coordinates, always within the display) in the native format.
+   *
+   * Used to blend anti-aliased text into the background, drivers for displays with more than one bit per pixel
+   * should override this. The default assumes a black background.
+   */
+  virtual int get_absolute_pixel_internal(int x, int y);
+
+  /** Fill width pixels from [x,y] to the right (unrotated coordinates, always within the display).
+   *
+   * Drivers can override this and the following methods with writes in their native buffer layout, the default
+   * implementations go through draw_absolute_pixel_internal().
+   */
+  virtual void fill_span_internal(int x, int y, int width, int color);
+  /// Fill the rectangle with the top left at [x,y] (unrotated coordinates, always within the display).
+  virtual void fill_rect_internal(int x, int y, int width, int height, int color);
+  /** Draw a width x height part of a 1 bit per pixel bitmap with the top left at [x,y] (unrotated coordinates,
+   * always within the display).
+   *
+   * @param data The bitmap in PROGMEM, rows of stride bytes with the most significant bit first.
+   * @param src_x The column of the bitmap to start at.
+   * @param src_y The row of the bitmap to start at.
+   * @param color The color for set bits.
+   * @param opaque Whether to draw unset bits with COLOR_OFF, otherwise they're left unchanged.
+   */
+  virtual void blit_1bpp_internal(int x, int y, int width, int height, const uint8_t *data, int stride, int src_x,
+                                  int src_y, int color, bool opaque);
+
+  /// Fill a rectangle given in rotated coordinates, clipped to the display.
+  void fill_rect_(int x, int y, int width, int height, int color);
+  /** Draw a width x height 1 bit per pixel bitmap (see blit_1bpp_internal()) given in rotated coordinates, clipped to
+   * the display. The data is laid out for a display with data_rotation, and blitted directly if that's this one's.
+   */
+  void blit_1bpp_(int x, int y, int width, int height, const uint8_t *data, DisplayRotation data_rotation, int color,
+                  bool opaque);
+  /** Draw a width x height 4 bit per pixel alpha mask (rows of whole bytes, high nibble first) given in rotated
+   * coordinates, blended into the background with color.
+   */
+  void blit_alpha_4bpp_(int x, int y, int width, int height, const uint8_t *data, DisplayRotation data_rotation,
+                        int color);
+  /// Draw a run length encoded image, see Image.
+  void image_rle_(int x, int y, Image *image);
+  /// Draw an 8 bit per pixel grayscale image, see Image.
+  void image_grayscale_(int x, int y, Image *image);
+  /// Convert the rectangle from rotated to unrotated coordinates.
+  void unrotate_rect_(int *x, int *y, int *width, int *height);
+
   virtual int get_height_internal() = 0;
 
   virtual int get_width_internal() = 0;
 
   void init_internal_(uint32_t buffer_length);
 
+  /// Convert a color to pixel_format_, COLOR_OFF/COLOR_ON are passed through unchanged for monochrome displays.
+  int native_color_(int color) {
+    if (this->pixel_format_ == PIXEL_FORMAT_MONO && !(color & COLOR_RGB))
+      return color;
+    return this->convert_color_(color);
+  }
+  int convert_color_(int color);
+  /// Blend the native color fg over bg with the alpha (0 is bg, 15 is fg).
+  int blend_native_(int bg, int fg, uint8_t alpha);
+
+  /** Helpers for drivers that keep buffer_ as rows of whole bytes in pixel_format_, pixels are packed most
+   * significant bits first. Coordinates are unrotated and must be within the display.
+   */
+  size_t get_packed_buffer_length_();
+  void set_packed_pixel_(int x, int y, int color);
+  int get_packed_pixel_(int x, int y);
+  void fill_packed_span_(int x, int y, int width, int color);
+
   void do_update_();
 
+  /** Mark the rectangle [x1,y1] to [x2,y2] (inclusive, unrotated coordinates) as drawn.
+   *
+   * draw_pixel_at() does this for every pixel, drivers only have to call this when they write to buffer_ directly,
+   * for example in an overridden fill().
+   */
+  void mark_dirty_(int x1, int y1, int x2, int y2);
+  /** Get the columns of the band (DIRTY_BAND_HEIGHT rows starting at band * DIRTY_BAND_HEIGHT) that have to be
+   * transmitted, in unrotated coordinates. Returns false if the whole band is unchanged.
+   */
+  bool get_dirty_span_(int band, int *x1, int *x2);
+  /// Get the bounding box of all dirty bands (inclusive, unrotated coordinates), false if nothing has to be sent.
+  bool get_dirty_region_(int *x1, int *y1, int *x2, int *y2);
+  /// Call after transmitting the dirty region to the display.
+  void clear_dirty_();
+
+  /// Rows per dirty band, matches the 8-pixel pages of monochrome OLED/LCD controllers.
+  static const uint8_t DIRTY_BAND_HEIGHT = 8;
+
+  /// Column range of a band, empty if x1 > x2.
+  struct DirtySpan {
+    int16_t x1;
+    int16_t x2;
+
+    bool empty() const { return this->x1 > this->x2; }
+    void clear() {
+      this->x1 = INT16_MAX;
+      this->x2 = INT16_MIN;
+    }
+    void add(int16_t a_x1, int16_t a_x2) {
+      this->x1 = std::min(this->x1, a_x1);
+      this->x2 = std::max(this->x2, a_x2);
+    }
+  };
+
   uint8_t *buffer_{nullptr};
+  /// Drivers with more than one bit per pixel set this before calling init_internal_().
+  PixelFormat pixel_format_{PIXEL_FORMAT_MONO};
+  /** Drawn pixels are tracked per band: drawn_ holds everything drawn since the last do_update_(), dirty_ what
+   * still has to be transmitted from earlier frames. Every frame starts with clear(), so the pixels that changed
+   * since the last transmission are all within the union of both: they were either drawn now or in the frame that
+   * was last sent. This needs no copy of the previous frame and is cheap enough to do for every pixel.
+   */
+  std::vector<DirtySpan> drawn_;
+  std::vector<DirtySpan> dirty_;
   DisplayRotation rotation_{DISPLAY_ROTATION_0_DEGREES};
   optional<display_writer_t> writer_{};
   DisplayPage *page_{nullptr};
@@ -328,8 +466,16 @@ class DisplayPage {
 
 class Glyph {
  public:
+  /** Construct a glyph.
+   *
+   * The data is stored in the orientation of rotation (like the buffer of a display with that rotation), text
+   * is drawn without rotating each pixel on displays with the same rotation.
+   *
+   * With 4 bits per pixel the data is an anti-aliased alpha mask (high nibble first), blended into the background
+   * on displays with gray levels or colors.
+   */
   Glyph(const char *a_char, const uint8_t *data_start, uint32_t offset, int offset_x, int offset_y, int width,
-        int height);
+        int height, DisplayRotation rotation = DISPLAY_ROTATION_0_DEGREES, uint8_t bpp = 1);
 
   bool get_pixel(int x, int y) const;
 
@@ -351,6 +497,8 @@ class Glyph {
   int offset_y_;
   int width_;
   int height_;
+  DisplayRotation rotation_;
+  uint8_t bpp_;
 };
 
 class Font {
@@ -375,17 +523,42 @@ class Font {
   int bottom_;
 };
 
+enum ImageType {
+  /// 1 bit per pixel.
+  IMAGE_TYPE_BINARY = 0,
+  /** 1 bit per pixel, run length encoded: every byte is a run of (byte & 0x7F) + 1 pixels, set if the highest bit
+   * is set. Pixels are drawn a run at a time, but get_pixel() has to scan the data.
+   */
+  IMAGE_TYPE_BINARY_RLE,
+  /// 8 bits per pixel gray levels.
+  IMAGE_TYPE_GRAYSCALE,
+};
+
 class Image {
  public:
-  Image(const uint8_t *data_start, int width, int height);
+  /** Construct an image.
+   *
+   * @param data_start The data in PROGMEM, rows of whole bytes stored in the orientation of rotation.
+   * @param width The width of the (unrotated) image.
+   * @param height The height of the (unrotated) image.
+   * @param rotation The rotation of the display the data is laid out for.
+   * @param type The format of the data.
+   */
+  Image(const uint8_t *data_start, int width, int height, DisplayRotation rotation = DISPLAY_ROTATION_0_DEGREES,
+        ImageType type = IMAGE_TYPE_BINARY);
+  /// Whether the pixel is set, grayscale pixels are set if they're brighter than 50% gray.
   bool get_pixel(int x, int y) const;
   int get_width() const;
   int get_height() const;
 
  protected:
+  friend DisplayBuffer;
+
   int width_;
   int height_;
   const uint8_t *data_start_;
+  DisplayRotation rotation_;
+  ImageType type_;
 };
 
 template<typename... Ts> class DisplayPageShowAction : public Action<Ts...> {
@@ -62,6 +62,10 @@ void EthernetComponent::loop() {
 
   network_tick_mdns();
 }
+uint32_t EthernetComponent::next_wake_in() {
+  // Connection changes are recorded by the event handler, checking them once a second is enough
+  return 1000;
+}
 void EthernetComponent::dump_config() {
   ESP_LOGCONFIG(TAG, "Ethernet:");
   this->dump_connect_params_();
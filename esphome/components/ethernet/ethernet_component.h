@@ -31,6 +31,7 @@ class EthernetComponent : public Component {
   EthernetComponent();
   void setup() override;
   void loop() override;
+  uint32_t next_wake_in() override;
   void dump_config() override;
   float get_setup_priority() const override;
   bool can_proceed() override;
@@ -6,14 +6,24 @@ namespace fastled_base {
 
 static const char *TAG = "fastled";
 
+#ifdef ARDUINO_ARCH_ESP32
+/// FastLED expects the controllers to be shown one after the other, serialize the show tasks of all lights.
+static SemaphoreHandle_t show_lock = nullptr;  // NOLINT
+#endif
+
 void FastLEDLightOutput::setup() {
   ESP_LOGCONFIG(TAG, "Setting up FastLED light...");
   this->controller_->init();
   this->controller_->setLeds(this->leds_, this->num_leds_);
-  this->effect_data_ = new uint8_t[this->num_leds_];
   if (!this->max_refresh_rate_.has_value()) {
     this->set_max_refresh_rate(this->controller_->getMaxRefreshRate());
   }
+#ifdef ARDUINO_ARCH_ESP32
+  if (show_lock == nullptr)
+    show_lock = xSemaphoreCreateMutex();
+  // The main loop runs on the APP CPU, send on the other one.
+  xTaskCreatePinnedToCore(FastLEDLightOutput::show_task_, "fastled", 4096, this, 1, &this->show_task_handle_, 0);
+#endif
 }
 void FastLEDLightOutput::dump_config() {
   ESP_LOGCONFIG(TAG, "FastLED light:");
@@ -29,12 +39,35 @@ void FastLEDLightOutput::loop() {
   if (*this->max_refresh_rate_ != 0 && (now - this->last_refresh_) < *this->max_refresh_rate_) {
     return;
   }
+#ifdef ARDUINO_ARCH_ESP32
+  // the show task still sends the previous frame from leds_
+  if (this->showing_.load(std::memory_order_acquire))
+    return;
+#endif
   this->last_refresh_ = now;
   this->mark_shown_();
 
   ESP_LOGVV(TAG, "Writing RGB values to bus...");
+#ifdef ARDUINO_ARCH_ESP32
+  this->showing_.store(true, std::memory_order_release);
+  xTaskNotifyGive(this->show_task_handle_);
+#else
   this->controller_->showLeds();
+#endif
+}
+
+#ifdef ARDUINO_ARCH_ESP32
+void FastLEDLightOutput::show_task_(void *param) {
+  auto *light = reinterpret_cast<FastLEDLightOutput *>(param);
+  while (true) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    xSemaphoreTake(show_lock, portMAX_DELAY);
+    light->controller_->showLeds();
+    xSemaphoreGive(show_lock);
+    light->showing_.store(false, std::memory_order_release);
+  }
 }
+#endif
 
 }  // namespace fastled_base
 }  // namespace esphome
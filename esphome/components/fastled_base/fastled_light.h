@@ -13,9 +13,22 @@
 
 #include "FastLED.h"
 
+#ifdef ARDUINO_ARCH_ESP32
+#include <atomic>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+#endif
+
 namespace esphome {
 namespace fastled_base {
 
+/** FastLED light output.
+ *
+ * Effects render into the frame buffer of AddressableLight, which is the back buffer, and showing writes it to leds_,
+ * the front buffer. On the ESP32 the front buffer is then sent by a separate task on the PRO CPU, so that the transfer
+ * (about 30us per LED) doesn't block loop(). No new frames are rendered while the previous one is still being sent.
+ */
 class FastLEDLightOutput : public light::AddressableLight {
  public:
   /// Only for custom effects: Get the internal controller.
@@ -217,21 +230,24 @@ class FastLEDLightOutput : public light::AddressableLight {
   void loop() override;
   float get_setup_priority() const override { return setup_priority::HARDWARE; }
 
-  void clear_effect_data() override {
-    for (int i = 0; i < this->size(); i++)
-      this->effect_data_[i] = 0;
-  }
-
  protected:
-  light::ESPColorView get_view_internal(int32_t index) const override {
-    return {&this->leds_[index].r,      &this->leds_[index].g, &this->leds_[index].b, nullptr,
-            &this->effect_data_[index], &this->correction_};
+  void write_frame_internal() override {
+    static const uint8_t OFFSETS[3] = {0, 1, 2};
+    this->write_frame_(reinterpret_cast<uint8_t *>(this->leds_), sizeof(CRGB), OFFSETS);
   }
 
+#ifdef ARDUINO_ARCH_ESP32
+  static void show_task_(void *param);
+#endif
+
   CLEDController *controller_{nullptr};
   CRGB *leds_{nullptr};
-  uint8_t *effect_data_{nullptr};
   int num_leds_{0};
+#ifdef ARDUINO_ARCH_ESP32
+  TaskHandle_t show_task_handle_{nullptr};
+  /// Set by loop() when leds_ holds a new frame, cleared by the show task when it has been sent.
+  std::atomic<bool> showing_{false};
+#endif
   uint32_t last_refresh_{0};
   optional<uint32_t> max_refresh_rate_{};
 };
@@ -4,7 +4,7 @@ from esphome import core
 from esphome.components import display
 import esphome.config_validation as cv
 import esphome.codegen as cg
-from esphome.const import CONF_FILE, CONF_GLYPHS, CONF_ID, CONF_SIZE
+from esphome.const import CONF_FILE, CONF_GLYPHS, CONF_ID, CONF_ROTATION, CONF_SIZE
 from esphome.core import CORE, HexInt
 
 DEPENDENCIES = ['display']
@@ -63,14 +63,63 @@ def validate_truetype_file(value):
     return cv.file_(value)
 
 
+def rotate_bitmap(width, height, get_pixel, rotation):
+    """Get the pixels of a width x height bitmap in the orientation of a display with the given rotation.
+
+    Uses the same transformation as DisplayBuffer::draw_pixel_at(), returns the stored width, height and
+    the pixels row by row.
+    """
+    stored_width, stored_height = (height, width) if rotation in (90, 270) else (width, height)
+    pixels = [0] * (stored_width * stored_height)
+    for y in range(height):
+        for x in range(width):
+            if rotation == 90:
+                stored_x, stored_y = height - y - 1, x
+            elif rotation == 180:
+                stored_x, stored_y = width - x - 1, height - y - 1
+            elif rotation == 270:
+                stored_x, stored_y = y, width - x - 1
+            else:
+                stored_x, stored_y = x, y
+            pixels[stored_x + stored_y * stored_width] = get_pixel(x, y)
+    return stored_width, stored_height, pixels
+
+
+def pack_bitmap(width, height, pixels):
+    """Pack the pixels into rows of whole bytes, most significant bit first."""
+    width8 = ((width + 7) // 8) * 8
+    data = [0 for _ in range(height * width8 // 8)]
+    for y in range(height):
+        for x in range(width):
+            if not pixels[x + y * width]:
+                continue
+            pos = x + y * width8
+            data[pos // 8] |= 0x80 >> (pos % 8)
+    return data
+
+
+def pack_bitmap_4bpp(width, height, pixels):
+    """Pack the 4-bit pixels into rows of whole bytes, the left pixel in the high nibble."""
+    stride = (width + 1) // 2
+    data = [0 for _ in range(height * stride)]
+    for y in range(height):
+        for x in range(width):
+            data[y * stride + x // 2] |= pixels[x + y * width] << (0 if x % 2 else 4)
+    return data
+
+
 DEFAULT_GLYPHS = ' !"%()+,-.:0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ_abcdefghijklmnopqrstuvwxyz°'
 CONF_RAW_DATA_ID = 'raw_data_id'
+CONF_BPP = 'bpp'
 
 FONT_SCHEMA = cv.Schema({
     cv.Required(CONF_ID): cv.declare_id(Font),
     cv.Required(CONF_FILE): validate_truetype_file,
     cv.Optional(CONF_GLYPHS, default=DEFAULT_GLYPHS): validate_glyphs,
     cv.Optional(CONF_SIZE, default=20): cv.int_range(min=1),
+    cv.Optional(CONF_ROTATION): display.validate_rotation,
+    # 4 bits per pixel fonts are anti-aliased, and take four times the flash
+    cv.Optional(CONF_BPP, default=1): cv.one_of(1, 4, int=True),
     cv.GenerateID(CONF_RAW_DATA_ID): cv.declare_id(cg.uint8),
 })
 
@@ -88,21 +137,29 @@ def to_code(config):
 
     ascent, descent = font.getmetrics()
 
+    rotation = config.get(CONF_ROTATION, 0)
+    bpp = config[CONF_BPP]
     glyph_args = {}
     data = []
     for glyph in config[CONF_GLYPHS]:
-        mask = font.getmask(glyph, mode='1')
         _, (offset_x, offset_y) = font.font.getsize(glyph)
-        width, height = mask.size
-        width8 = ((width + 7) // 8) * 8
-        glyph_data = [0 for _ in range(height * width8 // 8)]  # noqa: F812
-        for y in range(height):
-            for x in range(width):
-                if not mask.getpixel((x, y)):
-                    continue
-                pos = x + y * width8
-                glyph_data[pos // 8] |= 0x80 >> (pos % 8)
+        if bpp == 4:
+            mask = font.getmask(glyph, mode='L')
+            width, height = mask.size
+            stored_width, stored_height, pixels = rotate_bitmap(
+                width, height, lambda x, y: mask.getpixel((x, y)) >> 4, rotation)
+            glyph_data = pack_bitmap_4bpp(stored_width, stored_height, pixels)
+        else:
+            mask = font.getmask(glyph, mode='1')
+            width, height = mask.size
+            stored_width, stored_height, pixels = rotate_bitmap(
+                width, height, lambda x, y: mask.getpixel((x, y)) != 0, rotation)
+            glyph_data = pack_bitmap(stored_width, stored_height, pixels)
         glyph_args[glyph] = (len(data), offset_x, offset_y, width, height)
+        if CONF_ROTATION in config or bpp != 1:
+            glyph_args[glyph] += (display.DISPLAY_ROTATIONS[rotation],)
+        if bpp != 1:
+            glyph_args[glyph] += (bpp,)
         data += glyph_data
 
     rhs = [HexInt(x) for x in data]
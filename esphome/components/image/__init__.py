@@ -4,7 +4,7 @@ from esphome import core
 from esphome.components import display, font
 import esphome.config_validation as cv
 import esphome.codegen as cg
-from esphome.const import CONF_FILE, CONF_ID, CONF_RESIZE
+from esphome.const import CONF_FILE, CONF_ID, CONF_RESIZE, CONF_ROTATION, CONF_TYPE
 from esphome.core import CORE, HexInt
 _LOGGER = logging.getLogger(__name__)
 
@@ -12,6 +12,12 @@ DEPENDENCIES = ['display']
 MULTI_CONF = True
 
 Image_ = display.display_ns.class_('Image')
+ImageType = display.display_ns.enum('ImageType')
+
+IMAGE_TYPE = {
+    'BINARY': ImageType.IMAGE_TYPE_BINARY,
+    'GRAYSCALE': ImageType.IMAGE_TYPE_GRAYSCALE,
+}
 
 CONF_RAW_DATA_ID = 'raw_data_id'
 
@@ -19,12 +25,28 @@ IMAGE_SCHEMA = cv.Schema({
     cv.Required(CONF_ID): cv.declare_id(Image_),
     cv.Required(CONF_FILE): cv.file_,
     cv.Optional(CONF_RESIZE): cv.dimensions,
+    cv.Optional(CONF_ROTATION): display.validate_rotation,
+    # grayscale images take one byte per pixel
+    cv.Optional(CONF_TYPE, default='BINARY'): cv.enum(IMAGE_TYPE, upper=True),
     cv.GenerateID(CONF_RAW_DATA_ID): cv.declare_id(cg.uint8),
 })
 
 CONFIG_SCHEMA = cv.All(font.validate_pillow_installed, IMAGE_SCHEMA)
 
 
+def rle_encode(pixels):
+    """Run length encode the pixels, every byte is a run of (byte & 0x7F) + 1 pixels, set if the MSB is set."""
+    data = []
+    i = 0
+    while i < len(pixels):
+        run = 1
+        while run < 128 and i + run < len(pixels) and pixels[i + run] == pixels[i]:
+            run += 1
+        data.append((0x80 if pixels[i] else 0x00) | (run - 1))
+        i += run
+    return data
+
+
 def to_code(config):
     from PIL import Image
 
@@ -37,20 +59,33 @@ def to_code(config):
     if CONF_RESIZE in config:
         image.thumbnail(config[CONF_RESIZE])
 
-    image = image.convert('1', dither=Image.NONE)
+    grayscale = config[CONF_TYPE] == 'GRAYSCALE'
+    image = image.convert('L' if grayscale else '1', dither=Image.NONE)
     width, height = image.size
     if width > 500 or height > 500:
         _LOGGER.warning("The image you requested is very big. Please consider using the resize "
                         "parameter")
-    width8 = ((width + 7) // 8) * 8
-    data = [0 for _ in range(height * width8 // 8)]
-    for y in range(height):
-        for x in range(width):
-            if image.getpixel((x, y)):
-                continue
-            pos = x + y * width8
-            data[pos // 8] |= 0x80 >> (pos % 8)
+    rotation = config.get(CONF_ROTATION, 0)
+    rle = False
+    if grayscale:
+        _, _, data = font.rotate_bitmap(width, height, lambda x, y: image.getpixel((x, y)), rotation)
+    else:
+        stored_width, stored_height, pixels = font.rotate_bitmap(
+            width, height, lambda x, y: not image.getpixel((x, y)), rotation)
+        data = font.pack_bitmap(stored_width, stored_height, pixels)
+        # Large images with uniform areas are much smaller run length encoded, and are drawn a run at a time
+        rle_data = rle_encode(pixels)
+        rle = len(rle_data) < len(data)
+        if rle:
+            data = rle_data
 
     rhs = [HexInt(x) for x in data]
     prog_arr = cg.progmem_array(config[CONF_RAW_DATA_ID], rhs)
-    cg.new_Pvariable(config[CONF_ID], prog_arr, width, height)
+    args = [prog_arr, width, height]
+    if CONF_ROTATION in config or rle or grayscale:
+        args.append(display.DISPLAY_ROTATIONS[rotation])
+    if rle:
+        args.append(ImageType.IMAGE_TYPE_BINARY_RLE)
+    elif grayscale:
+        args.append(IMAGE_TYPE[config[CONF_TYPE]])
+    cg.new_Pvariable(config[CONF_ID], *args)
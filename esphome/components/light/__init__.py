@@ -13,6 +13,9 @@ from .types import (  # noqa
 
 IS_PLATFORM_COMPONENT = True
 
+CONF_FIXED_POINT = 'fixed_point'
+CONF_MAX_FRAMERATE = 'max_framerate'
+
 LightRestoreMode = light_ns.enum('LightRestoreMode')
 RESTORE_MODES = {
     'RESTORE_DEFAULT_OFF': LightRestoreMode.LIGHT_RESTORE_DEFAULT_OFF,
@@ -34,6 +37,7 @@ BINARY_LIGHT_SCHEMA = LIGHT_SCHEMA.extend({
 
 BRIGHTNESS_ONLY_LIGHT_SCHEMA = LIGHT_SCHEMA.extend({
     cv.Optional(CONF_GAMMA_CORRECT, default=2.8): cv.positive_float,
+    cv.Optional(CONF_FIXED_POINT): cv.boolean,
     cv.Optional(CONF_DEFAULT_TRANSITION_LENGTH, default='1s'): cv.positive_time_period_milliseconds,
     cv.Optional(CONF_EFFECTS): validate_effects(MONOCHROMATIC_EFFECTS),
 })
@@ -47,6 +51,7 @@ ADDRESSABLE_LIGHT_SCHEMA = RGB_LIGHT_SCHEMA.extend({
     cv.Optional(CONF_EFFECTS): validate_effects(ADDRESSABLE_EFFECTS),
     cv.Optional(CONF_COLOR_CORRECT): cv.All([cv.percentage], cv.Length(min=3, max=4)),
     cv.Optional(CONF_POWER_SUPPLY): cv.use_id(power_supply.PowerSupply),
+    cv.Optional(CONF_MAX_FRAMERATE): cv.All(cv.framerate, cv.Range(min=0, min_included=False)),
 })
 
 
@@ -59,12 +64,17 @@ def setup_light_core_(light_var, output_var, config):
         cg.add(light_var.set_default_transition_length(config[CONF_DEFAULT_TRANSITION_LENGTH]))
     if CONF_GAMMA_CORRECT in config:
         cg.add(light_var.set_gamma_correct(config[CONF_GAMMA_CORRECT]))
+    if CONF_FIXED_POINT in config:
+        cg.add(light_var.set_fixed_point(config[CONF_FIXED_POINT]))
     effects = yield cg.build_registry_list(EFFECTS_REGISTRY, config.get(CONF_EFFECTS, []))
     cg.add(light_var.add_effects(effects))
 
     if CONF_COLOR_CORRECT in config:
         cg.add(output_var.set_correction(*config[CONF_COLOR_CORRECT]))
 
+    if CONF_MAX_FRAMERATE in config:
+        cg.add(output_var.set_max_framerate(config[CONF_MAX_FRAMERATE]))
+
     if CONF_POWER_SUPPLY in config:
         var_ = yield cg.get_variable(config[CONF_POWER_SUPPLY])
         cg.add(output_var.set_power_supply(var_))
@@ -77,9 +77,8 @@ ESPColor ESPHSVColor::to_rgb() const {
 }
 
 void ESPRangeView::set(const ESPColor &color) {
-  for (int32_t i = this->begin_; i < this->end_; i++) {
-    (*this->parent_)[i] = color;
-  }
+  ESPColor *frame = this->parent_->get_frame_buffer();
+  std::fill(frame + this->begin_, frame + this->end_, color);
 }
 ESPColorView ESPRangeView::operator[](int32_t index) const {
   index = interpret_index(index, this->size()) + this->begin_;
@@ -88,40 +87,48 @@ ESPColorView ESPRangeView::operator[](int32_t index) const {
 ESPRangeIterator ESPRangeView::begin() { return {*this, this->begin_}; }
 ESPRangeIterator ESPRangeView::end() { return {*this, this->end_}; }
 void ESPRangeView::set_red(uint8_t red) {
-  for (auto c : *this)
-    c.set_red(red);
+  ESPColor *frame = this->parent_->get_frame_buffer();
+  for (int32_t i = this->begin_; i < this->end_; i++)
+    frame[i].r = red;
 }
 void ESPRangeView::set_green(uint8_t green) {
-  for (auto c : *this)
-    c.set_green(green);
+  ESPColor *frame = this->parent_->get_frame_buffer();
+  for (int32_t i = this->begin_; i < this->end_; i++)
+    frame[i].g = green;
 }
 void ESPRangeView::set_blue(uint8_t blue) {
-  for (auto c : *this)
-    c.set_blue(blue);
+  ESPColor *frame = this->parent_->get_frame_buffer();
+  for (int32_t i = this->begin_; i < this->end_; i++)
+    frame[i].b = blue;
 }
 void ESPRangeView::set_white(uint8_t white) {
-  for (auto c : *this)
-    c.set_white(white);
+  ESPColor *frame = this->parent_->get_frame_buffer();
+  for (int32_t i = this->begin_; i < this->end_; i++)
+    frame[i].w = white;
 }
 void ESPRangeView::set_effect_data(uint8_t effect_data) {
-  for (auto c : *this)
-    c.set_effect_data(effect_data);
+  uint8_t *data = this->parent_->get_effect_data();
+  memset(data + this->begin_, effect_data, this->size());
 }
 void ESPRangeView::fade_to_white(uint8_t amnt) {
-  for (auto c : *this)
-    c.fade_to_white(amnt);
+  ESPColor *frame = this->parent_->get_frame_buffer();
+  for (int32_t i = this->begin_; i < this->end_; i++)
+    frame[i] = frame[i].fade_to_white(amnt);
 }
 void ESPRangeView::fade_to_black(uint8_t amnt) {
-  for (auto c : *this)
-    c.fade_to_black(amnt);
+  ESPColor *frame = this->parent_->get_frame_buffer();
+  for (int32_t i = this->begin_; i < this->end_; i++)
+    frame[i] *= amnt;
 }
 void ESPRangeView::lighten(uint8_t delta) {
-  for (auto c : *this)
-    c.lighten(delta);
+  ESPColor *frame = this->parent_->get_frame_buffer();
+  for (int32_t i = this->begin_; i < this->end_; i++)
+    frame[i] += delta;
 }
 void ESPRangeView::darken(uint8_t delta) {
-  for (auto c : *this)
-    c.darken(delta);
+  ESPColor *frame = this->parent_->get_frame_buffer();
+  for (int32_t i = this->begin_; i < this->end_; i++)
+    frame[i] -= delta;
 }
 ESPRangeView &ESPRangeView::operator=(const ESPRangeView &rhs) {
   // If size doesn't match, error (todo warning)
@@ -134,22 +141,7 @@ ESPRangeView &ESPRangeView::operator=(const ESPRangeView &rhs) {
     return *this;
   }
 
-  // If both equal, already done
-  if (rhs.begin_ == this->begin_)
-    return *this;
-
-  if (rhs.begin_ > this->begin_) {
-    // Copy from left
-    for (int32_t i = 0; i < this->size(); i++) {
-      (*this)[i].set(rhs[i].get());
-    }
-  } else {
-    // Copy from right
-    for (int32_t i = this->size() - 1; i >= 0; i--) {
-      (*this)[i].set(rhs[i].get());
-    }
-  }
-
+  this->parent_->copy_range(this->begin_, rhs.begin_, this->size());
   return *this;
 }
 
@@ -162,8 +154,24 @@ int32_t HOT interpret_index(int32_t index, int32_t size) {
 }
 
 void AddressableLight::call_setup() {
+  // effects may already run when the light state is set up, before setup() of this component
+  this->init_frame_();
   this->setup();
 
+#ifdef ESPHOME_LOG_HAS_VERBOSE
+  this->set_interval(10000, [this]() {
+    const uint32_t shown = this->frames_shown_ - this->logged_frames_shown_;
+    const uint32_t dropped = this->dropped_frames_ - this->logged_dropped_frames_;
+    if (shown == 0 && dropped == 0)
+      return;
+    this->logged_frames_shown_ = this->frames_shown_;
+    this->logged_dropped_frames_ = this->dropped_frames_;
+    const char *name = this->state_parent_ == nullptr ? "" : this->state_parent_->get_name().c_str();
+    ESP_LOGV(TAG, "Addressable Light '%s': %.1f fps, %u frames shown and %u dropped in the last 10s", name,
+             this->get_fps(), shown, dropped);
+  });
+#endif
+
 #ifdef ESPHOME_LOG_HAS_VERY_VERBOSE
   this->set_interval(5000, [this]() {
     const char *name = this->state_parent_ == nullptr ? "" : this->state_parent_->get_name().c_str();
@@ -179,6 +187,109 @@ void AddressableLight::call_setup() {
 #endif
 }
 
+void AddressableLight::init_frame_() {
+  if (this->frame_ != nullptr)
+    return;
+  const int32_t size = this->size();
+  this->frame_ = new ESPColor[size];  // NOLINT
+  std::fill(this->frame_, this->frame_ + size, ESPColor::BLACK);
+  this->effect_data_ = new uint8_t[size];  // NOLINT
+  memset(this->effect_data_, 0, size);
+}
+
+float AddressableLight::get_fps() const {
+  if (millis() - this->fps_window_start_ > 2000)
+    return 0.0f;
+  return this->fps_;
+}
+
+void AddressableLight::clear_effect_data() { memset(this->effect_data_, 0, this->size()); }
+
+void AddressableLight::fill(const ESPColor &color) { std::fill(this->frame_, this->frame_ + this->size(), color); }
+void AddressableLight::fade_all(uint8_t scale) {
+  ESPColor *frame = this->frame_;
+  for (int32_t i = 0, size = this->size(); i < size; i++)
+    frame[i] *= scale;
+}
+void AddressableLight::blend(const ESPColor &color, uint8_t alpha) {
+  if (alpha == 0)
+    return;
+  const uint8_t inv_alpha = 255 - alpha;
+  const ESPColor add = color * alpha;
+  ESPColor *frame = this->frame_;
+  for (int32_t i = 0, size = this->size(); i < size; i++)
+    frame[i] = add + frame[i] * inv_alpha;
+}
+void AddressableLight::copy_range(int32_t dst, int32_t src, int32_t count) {
+  const int32_t size = this->size();
+  if (dst < 0 || src < 0 || dst >= size || src >= size || dst == src)
+    return;
+  count = std::min(count, std::min(size - dst, size - src));
+  if (count <= 0)
+    return;
+  if (dst < src) {
+    std::copy(this->frame_ + src, this->frame_ + src + count, this->frame_ + dst);
+  } else {
+    std::copy_backward(this->frame_ + src, this->frame_ + src + count, this->frame_ + dst + count);
+  }
+  memmove(this->effect_data_ + dst, this->effect_data_ + src, count);
+}
+
+void AddressableLight::set_range_correction(int32_t from, int32_t to, const ESPColorCorrection *correction) {
+  // keep the ranges sorted so that write_frame_() can walk them in order
+  auto it = this->range_corrections_.begin();
+  while (it != this->range_corrections_.end() && it->from < from)
+    it++;
+  if (it != this->range_corrections_.end() && it->from == from) {
+    // set again for every frame the range is written
+    it->to = to;
+    it->correction = correction;
+    return;
+  }
+  this->range_corrections_.insert(it, RangeCorrection{from, to, correction});
+}
+
+void HOT AddressableLight::write_frame_(uint8_t *out, uint8_t stride, const uint8_t *offsets) {
+  const int32_t size = this->size();
+  int32_t i = 0;
+  // the range corrections are sorted, show the gaps between them with our own correction
+  for (auto &range : this->range_corrections_) {
+    const int32_t from = std::min(range.from, size);
+    const int32_t to = std::min(range.to, size);
+    if (from > i)
+      this->correction_.correct_frame(this->frame_ + i, from - i, out + i * stride, stride, offsets);
+    if (to > from)
+      range.correction->correct_frame(this->frame_ + from, to - from, out + from * stride, stride, offsets);
+    i = std::max(i, to);
+  }
+  if (size > i)
+    this->correction_.correct_frame(this->frame_ + i, size - i, out + i * stride, stride, offsets);
+}
+
+void AddressableLight::mark_shown_() {
+  this->next_show_ = false;
+  this->frames_shown_++;
+  this->fps_window_frames_++;
+  const uint32_t now = millis();
+  const uint32_t elapsed = now - this->fps_window_start_;
+  if (elapsed >= 1000) {
+    this->fps_ = this->fps_window_frames_ * 1000.0f / elapsed;
+    this->fps_window_start_ = now;
+    this->fps_window_frames_ = 0;
+  }
+#ifdef USE_POWER_SUPPLY
+  bool is_on = false;
+  for (int32_t i = 0, size = this->size(); i < size && !is_on; i++)
+    is_on = this->correction_.color_correct(this->frame_[i]).is_on();
+  if (is_on) {
+    this->power_.request();
+  } else {
+    this->power_.unrequest();
+  }
+#endif
+  this->write_frame_internal();
+}
+
 ESPColor esp_color_from_light_color_values(LightColorValues val) {
   auto r = static_cast<uint8_t>(roundf(val.get_red() * 255.0f));
   auto g = static_cast<uint8_t>(roundf(val.get_green() * 255.0f));
@@ -190,73 +301,130 @@ ESPColor esp_color_from_light_color_values(LightColorValues val) {
 void AddressableLight::write_state(LightState *state) {
   auto val = state->current_values;
   auto max_brightness = static_cast<uint8_t>(roundf(val.get_brightness() * val.get_state() * 255.0f));
-  this->correction_.set_local_brightness(max_brightness);
 
-  this->last_transition_progress_ = 0.0f;
-  this->accumulated_alpha_ = 0.0f;
+  // don't use LightState helper, gamma correction+brightness is applied to the whole frame when it's shown
 
-  if (this->is_effect_active())
+  if (this->is_effect_active() || state->transformer_ == nullptr || !state->transformer_->is_transition()) {
+    // no transformer active or non-transition one
+    this->correction_.set_local_brightness(max_brightness);
+    this->end_transition_();
+    if (this->is_effect_active())
+      return;
+    this->clear_range_corrections_();
+    this->fill(esp_color_from_light_color_values(val));
+    this->schedule_show();
     return;
+  }
 
-  // don't use LightState helper, gamma correction+brightness is handled by ESPColorView
-
-  if (state->transformer_ == nullptr || !state->transformer_->is_transition()) {
-    // no transformer active or non-transition one
-    this->all() = esp_color_from_light_color_values(val);
-  } else {
-    // transition transformer active, activate specialized transition for addressable effects
-    // instead of using a unified transition for all LEDs, we use the current state each LED as the
-    // start. Warning: ugly
-
-    // We can't use a direct lerp smoothing here though - that would require creating a copy of the original
-    // state of each LED at the start of the transition
-    // Instead, we "fake" the look of the LERP by using an exponential average over time and using
-    // dynamically-calculated alpha values to match the look of the
-
-    float new_progress = state->transformer_->get_progress();
-    float prev_smoothed = LightTransitionTransformer::smoothed_progress(last_transition_progress_);
-    float new_smoothed = LightTransitionTransformer::smoothed_progress(new_progress);
-    this->last_transition_progress_ = new_progress;
-
-    auto end_values = state->transformer_->get_end_values();
-    ESPColor target_color = esp_color_from_light_color_values(end_values);
-
-    // our transition will handle brightness, disable brightness in correction.
-    this->correction_.set_local_brightness(255);
-    uint8_t orig_w = target_color.w;
-    target_color *= static_cast<uint8_t>(roundf(end_values.get_brightness() * end_values.get_state() * 255.0f));
-    // w is not scaled by brightness
-    target_color.w = orig_w;
-
-    float denom = (1.0f - new_smoothed);
-    float alpha = denom == 0.0f ? 0.0f : (new_smoothed - prev_smoothed) / denom;
-
-    // We need to use a low-resolution alpha here which makes the transition set in only after ~half of the length
-    // We solve this by accumulating the fractional part of the alpha over time.
-    float alpha255 = alpha * 255.0f;
-    float alpha255int = floorf(alpha255);
-    float alpha255remainder = alpha255 - alpha255int;
-
-    this->accumulated_alpha_ += alpha255remainder;
-    float alpha_add = floorf(this->accumulated_alpha_);
-    this->accumulated_alpha_ -= alpha_add;
-
-    alpha255 += alpha_add;
-    alpha255 = clamp(alpha255, 0.0f, 255.0f);
-    auto alpha8 = static_cast<uint8_t>(alpha255);
-
-    if (alpha8 != 0) {
-      uint8_t inv_alpha8 = 255 - alpha8;
-      ESPColor add = target_color * alpha8;
-
-      for (auto led : *this)
-        led = add + led.get() * inv_alpha8;
+  // transition transformer active, activate specialized transition for addressable effects
+  // instead of using a unified transition for all LEDs, we use the current color of each LED as the
+  // start and interpolate from there to the target color.
+  const int32_t size = this->size();
+  const float progress = state->transformer_->get_progress();
+  if (!this->transition_active_ || progress < this->last_transition_progress_) {
+    // a new transition, our transition will handle brightness so apply the current brightness to the start colors
+    if (this->transition_start_ == nullptr)
+      this->transition_start_ = new ESPColor[size];  // NOLINT
+    if (!this->transition_active_) {
+      // frames weren't paced since the last transition or effect, possibly for longer than micros() takes to wrap
+      this->next_frame_us_ = micros();
+    }
+    this->transition_active_ = true;
+    const uint8_t brightness = this->correction_.get_local_brightness();
+    for (int32_t i = 0; i < size; i++) {
+      const ESPColor &color = this->frame_[i];
+      // w is not scaled by brightness
+      this->transition_start_[i] = ESPColor(esp_scale8(color.r, brightness), esp_scale8(color.g, brightness),
+                                            esp_scale8(color.b, brightness), color.w);
     }
   }
+  this->last_transition_progress_ = progress;
+  // disable brightness in correction.
+  this->correction_.set_local_brightness(255);
+
+  if (!this->begin_frame_())
+    return;
+
+  auto end_values = state->transformer_->get_end_values();
+  ESPColor target_color = esp_color_from_light_color_values(end_values);
+  uint8_t orig_w = target_color.w;
+  target_color *= static_cast<uint8_t>(roundf(end_values.get_brightness() * end_values.get_state() * 255.0f));
+  // w is not scaled by brightness
+  target_color.w = orig_w;
+
+  const float smoothed = LightTransitionTransformer::smoothed_progress(progress);
+  const auto alpha = static_cast<uint8_t>(roundf(smoothed * 255.0f));
+  const uint8_t inv_alpha = 255 - alpha;
+  const ESPColor add = target_color * alpha;
+  for (int32_t i = 0; i < size; i++)
+    this->frame_[i] = this->transition_start_[i] * inv_alpha + add;
 
   this->schedule_show();
 }
 
+void AddressableLight::end_transition_() {
+  // keep transition_start_, transitions are frequent and reallocating it would fragment the heap
+  this->transition_active_ = false;
+  this->last_transition_progress_ = 0.0f;
+}
+
+bool AddressableLight::begin_frame_() {
+  const uint32_t now = micros();
+  const uint32_t period = this->frame_period_us_;
+  if (period != 0 && int32_t(now - this->next_frame_us_) < 0)
+    return false;
+
+  if (this->next_show_) {
+    // the LEDs are still busy with the previous frame, skip this one. Without a frame rate limit the frame is only
+    // deferred to the next loop, that's not a dropped frame.
+    if (period != 0) {
+      this->dropped_frames_++;
+      this->next_frame_us_ += period;
+    }
+    return false;
+  }
+
+  if (period != 0) {
+    const uint32_t late = now - this->next_frame_us_;
+    if (late >= period) {
+      // the loop is overloaded, skip the frames we missed instead of rendering them in a burst. Longer gaps are
+      // pauses without effects or transitions, not overload.
+      if (late < 1000000)
+        this->dropped_frames_ += late / period;
+      this->next_frame_us_ = now;
+    }
+    this->next_frame_us_ += period;
+  }
+
+  this->clear_range_corrections_();
+  const uint32_t now_ms = millis();
+  this->frame_delta_ = now_ms - this->frame_time_;
+  this->frame_time_ = now_ms;
+  return true;
+}
+
+void HOT ESPColorCorrection::correct_frame(const ESPColor *colors, int32_t count, uint8_t *out, uint8_t stride,
+                                          const uint8_t *offsets) const {
+  const uint8_t r_off = offsets[0], g_off = offsets[1], b_off = offsets[2];
+  if (stride >= 4) {
+    const uint8_t w_off = offsets[3];
+    for (int32_t i = 0; i < count; i++, out += stride) {
+      const ESPColor &color = colors[i];
+      out[r_off] = this->color_correct_red(color.r);
+      out[g_off] = this->color_correct_green(color.g);
+      out[b_off] = this->color_correct_blue(color.b);
+      out[w_off] = this->color_correct_white(color.w);
+    }
+    return;
+  }
+  for (int32_t i = 0; i < count; i++, out += stride) {
+    const ESPColor &color = colors[i];
+    out[r_off] = this->color_correct_red(color.r);
+    out[g_off] = this->color_correct_green(color.g);
+    out[b_off] = this->color_correct_blue(color.b);
+  }
+}
+
 void ESPColorCorrection::calculate_gamma_table(float gamma) {
   for (uint16_t i = 0; i < 256; i++) {
     // corrected = val ^ gamma
@@ -189,6 +189,7 @@ class ESPColorCorrection {
   ESPColorCorrection() : max_brightness_(255, 255, 255, 255) {}
   void set_max_brightness(const ESPColor &max_brightness) { this->max_brightness_ = max_brightness; }
   void set_local_brightness(uint8_t local_brightness) { this->local_brightness_ = local_brightness; }
+  uint8_t get_local_brightness() const { return this->local_brightness_; }
   void calculate_gamma_table(float gamma);
   inline ESPColor color_correct(ESPColor color) const ALWAYS_INLINE {
     // corrected = (uncorrected * max_brightness * local_brightness) ^ gamma
@@ -212,6 +213,11 @@ class ESPColorCorrection {
     uint8_t res = esp_scale8(white, this->max_brightness_.white);
     return this->gamma_table_[res];
   }
+  /** Correct count colors and write them to out, every LED takes stride bytes with the red, green, blue (and white
+   * if stride is 4) channels at offsets. Used to write a whole frame buffer in one pass.
+   */
+  void correct_frame(const ESPColor *colors, int32_t count, uint8_t *out, uint8_t stride,
+                     const uint8_t *offsets) const;
   inline ESPColor color_uncorrect(ESPColor color) const ALWAYS_INLINE {
     // uncorrected = corrected^(1/gamma) / (max_brightness * local_brightness)
     return ESPColor(this->color_uncorrect_red(color.red), this->color_uncorrect_green(color.green),
@@ -281,6 +287,10 @@ class ESPColorSettable {
   }
 };
 
+/** A reference to the color of an LED.
+ *
+ * If color_correction is nullptr the color is stored uncorrected, like in the frame buffer of AddressableLight.
+ */
 class ESPColorView : public ESPColorSettable {
  public:
   ESPColorView(uint8_t *red, uint8_t *green, uint8_t *blue, uint8_t *white, uint8_t *effect_data,
@@ -300,13 +310,19 @@ class ESPColorView : public ESPColorSettable {
     return *this;
   }
   void set(const ESPColor &color) override { this->set_rgbw(color.r, color.g, color.b, color.w); }
-  void set_red(uint8_t red) override { *this->red_ = this->color_correction_->color_correct_red(red); }
-  void set_green(uint8_t green) override { *this->green_ = this->color_correction_->color_correct_green(green); }
-  void set_blue(uint8_t blue) override { *this->blue_ = this->color_correction_->color_correct_blue(blue); }
+  void set_red(uint8_t red) override {
+    *this->red_ = this->color_correction_ == nullptr ? red : this->color_correction_->color_correct_red(red);
+  }
+  void set_green(uint8_t green) override {
+    *this->green_ = this->color_correction_ == nullptr ? green : this->color_correction_->color_correct_green(green);
+  }
+  void set_blue(uint8_t blue) override {
+    *this->blue_ = this->color_correction_ == nullptr ? blue : this->color_correction_->color_correct_blue(blue);
+  }
   void set_white(uint8_t white) override {
     if (this->white_ == nullptr)
       return;
-    *this->white_ = this->color_correction_->color_correct_white(white);
+    *this->white_ = this->color_correction_ == nullptr ? white : this->color_correction_->color_correct_white(white);
   }
   void set_effect_data(uint8_t effect_data) override {
     if (this->effect_data_ == nullptr)
@@ -318,15 +334,29 @@ class ESPColorView : public ESPColorSettable {
   void lighten(uint8_t delta) override { this->set(this->get().lighten(delta)); }
   void darken(uint8_t delta) override { this->set(this->get().darken(delta)); }
   ESPColor get() const { return ESPColor(this->get_red(), this->get_green(), this->get_blue(), this->get_white()); }
-  uint8_t get_red() const { return this->color_correction_->color_uncorrect_red(*this->red_); }
+  uint8_t get_red() const {
+    if (this->color_correction_ == nullptr)
+      return *this->red_;
+    return this->color_correction_->color_uncorrect_red(*this->red_);
+  }
   uint8_t get_red_raw() const { return *this->red_; }
-  uint8_t get_green() const { return this->color_correction_->color_uncorrect_green(*this->green_); }
+  uint8_t get_green() const {
+    if (this->color_correction_ == nullptr)
+      return *this->green_;
+    return this->color_correction_->color_uncorrect_green(*this->green_);
+  }
   uint8_t get_green_raw() const { return *this->green_; }
-  uint8_t get_blue() const { return this->color_correction_->color_uncorrect_blue(*this->blue_); }
+  uint8_t get_blue() const {
+    if (this->color_correction_ == nullptr)
+      return *this->blue_;
+    return this->color_correction_->color_uncorrect_blue(*this->blue_);
+  }
   uint8_t get_blue_raw() const { return *this->blue_; }
   uint8_t get_white() const {
     if (this->white_ == nullptr)
       return 0;
+    if (this->color_correction_ == nullptr)
+      return *this->white_;
     return this->color_correction_->color_uncorrect_white(*this->white_);
   }
   uint8_t get_white_raw() const {
@@ -418,12 +448,14 @@ class ESPRangeIterator {
   int32_t i_;
 };
 
+class AddressableLightEffect;
+
 class AddressableLight : public LightOutput, public Component {
  public:
   virtual int32_t size() const = 0;
-  ESPColorView operator[](int32_t index) const { return this->get_view_internal(interpret_index(index, this->size())); }
-  ESPColorView get(int32_t index) { return this->get_view_internal(interpret_index(index, this->size())); }
-  virtual void clear_effect_data() = 0;
+  ESPColorView operator[](int32_t index) const { return this->get_frame_view_(interpret_index(index, this->size())); }
+  ESPColorView get(int32_t index) { return this->get_frame_view_(interpret_index(index, this->size())); }
+  virtual void clear_effect_data();
   ESPRangeView range(int32_t from, int32_t to) {
     from = interpret_index(from, this->size());
     to = interpret_index(to, this->size());
@@ -432,6 +464,24 @@ class AddressableLight : public LightOutput, public Component {
   ESPRangeView all() { return ESPRangeView(this, 0, this->size()); }
   ESPRangeIterator begin() { return this->all().begin(); }
   ESPRangeIterator end() { return this->all().end(); }
+
+  /** The colors of all LEDs as one contiguous array of size() colors, without color correction.
+   *
+   * Effects can work on this directly: gamma, brightness and the maximum brightness of every channel are applied in
+   * one pass when the LEDs are shown.
+   */
+  ESPColor *get_frame_buffer() const { return this->frame_; }
+  /// The effect data of all LEDs as one contiguous array of size() bytes.
+  uint8_t *get_effect_data() const { return this->effect_data_; }
+
+  /// Set all LEDs to color.
+  void fill(const ESPColor &color);
+  /// Scale all LEDs by scale / 255, like ESPColor::fade_to_black().
+  void fade_all(uint8_t scale);
+  /// Blend all LEDs towards color, 0 leaves them unchanged and 255 sets them to color.
+  void blend(const ESPColor &color, uint8_t alpha);
+  /// Copy the colors of count LEDs starting at src to dst, the ranges may overlap.
+  void copy_range(int32_t dst, int32_t src, int32_t count);
   void shift_left(int32_t amnt) {
     if (amnt < 0) {
       this->shift_right(-amnt);
@@ -439,7 +489,7 @@ class AddressableLight : public LightOutput, public Component {
     }
     if (amnt > this->size())
       amnt = this->size();
-    this->range(0, -amnt) = this->range(amnt, this->size());
+    this->copy_range(0, amnt, this->size() - amnt);
   }
   void shift_right(int32_t amnt) {
     if (amnt < 0) {
@@ -448,21 +498,54 @@ class AddressableLight : public LightOutput, public Component {
     }
     if (amnt > this->size())
       amnt = this->size();
-    this->range(amnt, this->size()) = this->range(0, -amnt);
+    this->copy_range(amnt, 0, this->size() - amnt);
   }
+
   bool is_effect_active() const { return this->effect_active_; }
-  void set_effect_active(bool effect_active) { this->effect_active_ = effect_active; }
+  void set_effect_active(bool effect_active) {
+    if (effect_active && !this->effect_active_) {
+      this->frame_time_ = millis();
+      this->frame_delta_ = 0;
+      this->next_frame_us_ = micros();
+    }
+    this->effect_active_ = effect_active;
+  }
+  /** Render effects and transitions at most fps times per second, 0 renders a frame every loop.
+   *
+   * Effects step by the time between frames, so a lower frame rate only saves CPU time and doesn't slow them down.
+   */
+  void set_max_framerate(float fps) { this->frame_period_us_ = fps <= 0.0f ? 0 : uint32_t(1e6f / fps); }
+  /// The time the current effect frame was started at, in ms. Effects should use this instead of millis().
+  uint32_t get_frame_time() const { return this->frame_time_; }
+  /// The time since the previous effect frame, in ms.
+  uint32_t get_frame_delta() const { return this->frame_delta_; }
   void write_state(LightState *state) override;
   void set_correction(float red, float green, float blue, float white = 1.0f) {
     this->correction_.set_max_brightness(ESPColor(uint8_t(roundf(red * 255.0f)), uint8_t(roundf(green * 255.0f)),
                                                   uint8_t(roundf(blue * 255.0f)), uint8_t(roundf(white * 255.0f))));
   }
+  /** Show the LEDs [from, to) of the current frame with correction instead of the correction of this light.
+   *
+   * Used by lights that write a part of this one's frame buffer (see partition), so that their brightness and gamma
+   * apply to what they wrote. The range correction ends when this light renders a frame of its own.
+   */
+  void set_range_correction(int32_t from, int32_t to, const ESPColorCorrection *correction);
   void setup_state(LightState *state) override {
     this->correction_.calculate_gamma_table(state->get_gamma_correct());
     this->state_parent_ = state;
+    this->init_frame_();
   }
   void schedule_show() { this->next_show_ = true; }
 
+  /// Number of frames shown since boot.
+  uint32_t get_frames_shown() const { return this->frames_shown_; }
+  /** Number of frames that were skipped because the LEDs were still busy with the previous frame, or because the loop
+   * was too slow for the maximum frame rate.
+   */
+  uint32_t get_dropped_frames() const { return this->dropped_frames_; }
+  /// Frames shown per second, measured over about one second; 0 if no frames were shown recently.
+  float get_fps() const;
+
 #ifdef USE_POWER_SUPPLY
   void set_power_supply(power_supply::PowerSupply *power_supply) { this->power_.set_parent(power_supply); }
 #endif
@@ -470,30 +553,67 @@ class AddressableLight : public LightOutput, public Component {
   void call_setup() override;
 
  protected:
-  bool should_show_() const { return this->effect_active_ || this->next_show_; }
-  void mark_shown_() {
-    this->next_show_ = false;
-#ifdef USE_POWER_SUPPLY
-    for (auto c : *this) {
-      if (c.get().is_on()) {
-        this->power_.request();
-        return;
-      }
-    }
-    this->power_.unrequest();
-#endif
+  struct RangeCorrection {
+    int32_t from;
+    int32_t to;
+    const ESPColorCorrection *correction;
+  };
+
+  friend AddressableLightEffect;
+
+  bool should_show_() const { return this->next_show_; }
+  /// Call right before showing the LEDs, this writes the frame buffer to them with write_frame_internal().
+  void mark_shown_();
+  /** Whether a new frame should be rendered now, and if so start it.
+   *
+   * No frame is rendered before the frame period has passed or while the previous frame hasn't been shown yet.
+   * If the loop falls behind by more than a frame period, the missed frames are skipped instead of rendered in a burst.
+   */
+  bool begin_frame_();
+  /// Stop the current transition, if any.
+  void end_transition_();
+  /// This light renders a frame itself, show all LEDs with its own correction again.
+  void clear_range_corrections_() { this->range_corrections_.clear(); }
+  /// Allocate the frame buffer and effect data if that didn't happen yet.
+  void init_frame_();
+  ESPColorView get_frame_view_(int32_t index) const {
+    ESPColor &color = this->frame_[index];
+    return {&color.r, &color.g, &color.b, &color.w, &this->effect_data_[index], nullptr};
   }
-  virtual ESPColorView get_view_internal(int32_t index) const = 0;
 
+  /// Write the frame buffer with color correction to the output buffer of the driver, usually with write_frame_().
+  virtual void write_frame_internal() = 0;
+  /** Write the corrected frame buffer to out, size() LEDs of stride bytes with the red, green, blue (and white if
+   * stride is 4) channels at offsets.
+   */
+  void write_frame_(uint8_t *out, uint8_t stride, const uint8_t *offsets);
+
+  ESPColor *frame_{nullptr};
+  uint8_t *effect_data_{nullptr};
   bool effect_active_{false};
   bool next_show_{true};
   ESPColorCorrection correction_{};
+  std::vector<RangeCorrection> range_corrections_;
 #ifdef USE_POWER_SUPPLY
   power_supply::PowerSupplyRequester power_;
 #endif
   LightState *state_parent_{nullptr};
+  /// The colors at the start of the current transition, with brightness applied. Allocated with the first transition.
+  ESPColor *transition_start_{nullptr};
+  bool transition_active_{false};
   float last_transition_progress_{0.0f};
-  float accumulated_alpha_{0.0f};
+  uint32_t frame_period_us_{0};
+  uint32_t next_frame_us_{0};
+  uint32_t frame_time_{0};
+  uint32_t frame_delta_{0};
+  uint32_t frames_shown_{0};
+  uint32_t dropped_frames_{0};
+  uint32_t fps_window_start_{0};
+  uint32_t fps_window_frames_{0};
+  float fps_{0.0f};
+  /// Counters at the last statistics log message.
+  uint32_t logged_frames_shown_{0};
+  uint32_t logged_dropped_frames_{0};
 };
 
 }  // namespace light
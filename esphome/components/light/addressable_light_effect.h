@@ -34,18 +34,44 @@ class AddressableLightEffect : public LightEffect {
     this->start();
   }
   void stop() override { this->get_addressable_()->set_effect_active(false); }
+  /** Render a frame. Called at most at the maximum frame rate of the light, effects should step by
+   * it.get_frame_time() and it.get_frame_delta() so that their speed doesn't depend on the frame rate.
+   */
   virtual void apply(AddressableLight &it, const ESPColor &current_color) = 0;
   void apply() override {
+    AddressableLight *it = this->get_addressable_();
+    if (!it->begin_frame_())
+      return;
     LightColorValues color = this->state_->remote_values;
     // not using any color correction etc. that will be handled by the addressable layer
     ESPColor current_color =
         ESPColor(static_cast<uint8_t>(color.get_red() * 255), static_cast<uint8_t>(color.get_green() * 255),
                  static_cast<uint8_t>(color.get_blue() * 255), static_cast<uint8_t>(color.get_white() * 255));
-    this->apply(*this->get_addressable_(), current_color);
+    this->apply(*it, current_color);
+    it->schedule_show();
   }
 
  protected:
   AddressableLight *get_addressable_() const { return (AddressableLight *) this->state_->get_output(); }
+
+  /** The number of steps an effect that steps every interval ms has to take at time now, and advance last_step.
+   *
+   * If it's more than max_steps behind (for example when the effect was just started) it takes one step and
+   * continues from now instead of catching up.
+   */
+  static uint32_t steps_due_(uint32_t now, uint32_t interval, uint32_t &last_step, uint32_t max_steps) {
+    if (interval == 0) {
+      last_step = now;
+      return 1;
+    }
+    const uint32_t steps = (now - last_step) / interval;
+    if (steps > max_steps) {
+      last_step = now;
+      return 1;
+    }
+    last_step += steps * interval;
+    return steps;
+  }
 };
 
 class AddressableLambdaLightEffect : public AddressableLightEffect {
@@ -54,7 +80,7 @@ class AddressableLambdaLightEffect : public AddressableLightEffect {
                                uint32_t update_interval)
       : AddressableLightEffect(name), f_(f), update_interval_(update_interval) {}
   void apply(AddressableLight &it, const ESPColor &current_color) override {
-    const uint32_t now = millis();
+    const uint32_t now = it.get_frame_time();
     if (now - this->last_run_ >= this->update_interval_) {
       this->last_run_ = now;
       this->f_(it, current_color);
@@ -74,11 +100,15 @@ class AddressableRainbowLightEffect : public AddressableLightEffect {
     ESPHSVColor hsv;
     hsv.value = 255;
     hsv.saturation = 240;
-    uint16_t hue = (millis() * this->speed_) % 0xFFFF;
+    uint16_t hue = (it.get_frame_time() * this->speed_) % 0xFFFF;
     const uint16_t add = 0xFFFF / this->width_;
-    for (auto var : it) {
+    ESPColor *frame = it.get_frame_buffer();
+    for (int32_t i = 0, size = it.size(); i < size; i++) {
       hsv.hue = hue >> 8;
-      var = hsv;
+      const ESPColor rgb = hsv.to_rgb();
+      frame[i].r = rgb.r;
+      frame[i].g = rgb.g;
+      frame[i].b = rgb.b;
       hue += add;
     }
   }
@@ -103,20 +133,19 @@ class AddressableColorWipeEffect : public AddressableLightEffect {
   void set_add_led_interval(uint32_t add_led_interval) { this->add_led_interval_ = add_led_interval; }
   void set_reverse(bool reverse) { this->reverse_ = reverse; }
   void apply(AddressableLight &it, const ESPColor &current_color) override {
-    const uint32_t now = millis();
-    if (now - this->last_add_ < this->add_led_interval_)
-      return;
-    this->last_add_ = now;
+    const uint32_t steps = steps_due_(it.get_frame_time(), this->add_led_interval_, this->last_add_, it.size());
+    for (uint32_t i = 0; i < steps; i++)
+      this->add_led_(it);
+  }
+
+ protected:
+  void add_led_(AddressableLight &it) {
     if (this->reverse_)
       it.shift_left(1);
     else
       it.shift_right(1);
     const AddressableColorWipeEffectColor color = this->colors_[this->at_color_];
-    const ESPColor esp_color = ESPColor(color.r, color.g, color.b, color.w);
-    if (this->reverse_)
-      it[-1] = esp_color;
-    else
-      it[0] = esp_color;
+    it.get_frame_buffer()[this->reverse_ ? it.size() - 1 : 0] = ESPColor(color.r, color.g, color.b, color.w);
     if (++this->leds_added_ >= color.num_leds) {
       this->leds_added_ = 0;
       this->at_color_ = (this->at_color_ + 1) % this->colors_.size();
@@ -130,7 +159,6 @@ class AddressableColorWipeEffect : public AddressableLightEffect {
     }
   }
 
- protected:
   std::vector<AddressableColorWipeEffectColor> colors_;
   size_t at_color_{0};
   uint32_t last_add_{0};
@@ -151,8 +179,8 @@ class AddressableScanEffect : public AddressableLightEffect {
       it[this->at_led_ + i] = current_color;
     }
 
-    const uint32_t now = millis();
-    if (now - this->last_move_ > this->move_interval_) {
+    const uint32_t steps = steps_due_(it.get_frame_time(), this->move_interval_, this->last_move_, 2 * it.size());
+    for (uint32_t i = 0; i < steps; i++) {
       if (direction_) {
         this->at_led_++;
         if (this->at_led_ == it.size() - this->scan_width_)
@@ -162,7 +190,6 @@ class AddressableScanEffect : public AddressableLightEffect {
         if (this->at_led_ == 0)
           this->direction_ = true;
       }
-      this->last_move_ = now;
     }
   }
 
@@ -178,31 +205,30 @@ class AddressableTwinkleEffect : public AddressableLightEffect {
  public:
   explicit AddressableTwinkleEffect(const std::string &name) : AddressableLightEffect(name) {}
   void apply(AddressableLight &addressable, const ESPColor &current_color) override {
-    const uint32_t now = millis();
+    const uint32_t now = addressable.get_frame_time();
     uint8_t pos_add = 0;
     if (now - this->last_progress_ > this->progress_interval_) {
       const uint32_t pos_add32 = (now - this->last_progress_) / this->progress_interval_;
       pos_add = pos_add32;
       this->last_progress_ += pos_add32 * this->progress_interval_;
     }
-    for (auto view : addressable) {
-      if (view.get_effect_data() != 0) {
-        const uint8_t sine = half_sin8(view.get_effect_data());
-        view = current_color * sine;
-        const uint8_t new_pos = view.get_effect_data() + pos_add;
-        if (new_pos < view.get_effect_data())
-          view.set_effect_data(0);
-        else
-          view.set_effect_data(new_pos);
+    ESPColor *frame = addressable.get_frame_buffer();
+    uint8_t *data = addressable.get_effect_data();
+    for (int32_t i = 0, size = addressable.size(); i < size; i++) {
+      const uint8_t pos = data[i];
+      if (pos != 0) {
+        frame[i] = current_color * half_sin8(pos);
+        const uint8_t new_pos = pos + pos_add;
+        data[i] = new_pos < pos ? 0 : new_pos;
       } else {
-        view = ESPColor::BLACK;
+        frame[i] = ESPColor::BLACK;
       }
     }
     while (random_float() < this->twinkle_probability_) {
       const size_t pos = random_uint32() % addressable.size();
-      if (addressable[pos].get_effect_data() != 0)
+      if (data[pos] != 0)
         continue;
-      addressable[pos].set_effect_data(1);
+      data[pos] = 1;
     }
   }
   void set_twinkle_probability(float twinkle_probability) { this->twinkle_probability_ = twinkle_probability; }
@@ -218,38 +244,40 @@ class AddressableRandomTwinkleEffect : public AddressableLightEffect {
  public:
   explicit AddressableRandomTwinkleEffect(const std::string &name) : AddressableLightEffect(name) {}
   void apply(AddressableLight &it, const ESPColor &current_color) override {
-    const uint32_t now = millis();
+    const uint32_t now = it.get_frame_time();
     uint8_t pos_add = 0;
     if (now - this->last_progress_ > this->progress_interval_) {
       pos_add = (now - this->last_progress_) / this->progress_interval_;
       this->last_progress_ = now;
     }
     uint8_t subsine = ((8 * (now - this->last_progress_)) / this->progress_interval_) & 0b111;
-    for (auto view : it) {
-      if (view.get_effect_data() != 0) {
-        const uint8_t x = (view.get_effect_data() >> 3) & 0b11111;
-        const uint8_t color = view.get_effect_data() & 0b111;
+    ESPColor *frame = it.get_frame_buffer();
+    uint8_t *data = it.get_effect_data();
+    for (int32_t i = 0, size = it.size(); i < size; i++) {
+      if (data[i] != 0) {
+        const uint8_t x = (data[i] >> 3) & 0b11111;
+        const uint8_t color = data[i] & 0b111;
         const uint16_t sine = half_sin8((x << 3) | subsine);
         if (color == 0) {
-          view = current_color * sine;
+          frame[i] = current_color * sine;
         } else {
-          view = ESPColor(((color >> 2) & 1) * sine, ((color >> 1) & 1) * sine, ((color >> 0) & 1) * sine);
+          frame[i] = ESPColor(((color >> 2) & 1) * sine, ((color >> 1) & 1) * sine, ((color >> 0) & 1) * sine);
         }
         const uint8_t new_x = x + pos_add;
         if (new_x > 0b11111)
-          view.set_effect_data(0);
+          data[i] = 0;
         else
-          view.set_effect_data((new_x << 3) | color);
+          data[i] = (new_x << 3) | color;
       } else {
-        view = ESPColor(0, 0, 0, 0);
+        frame[i] = ESPColor(0, 0, 0, 0);
       }
     }
     while (random_float() < this->twinkle_probability_) {
       const size_t pos = random_uint32() % it.size();
-      if (it[pos].get_effect_data() != 0)
+      if (data[pos] != 0)
         continue;
       const uint8_t color = random_uint32() & 0b111;
-      it[pos].set_effect_data(0b1000 | color);
+      data[pos] = 0b1000 | color;
     }
   }
   void set_twinkle_probability(float twinkle_probability) { this->twinkle_probability_ = twinkle_probability; }
@@ -264,44 +292,47 @@ class AddressableRandomTwinkleEffect : public AddressableLightEffect {
 class AddressableFireworksEffect : public AddressableLightEffect {
  public:
   explicit AddressableFireworksEffect(const std::string &name) : AddressableLightEffect(name) {}
-  void start() override {
-    auto &it = *this->get_addressable_();
-    it.all() = ESPColor::BLACK;
-  }
+  void start() override { this->get_addressable_()->fill(ESPColor::BLACK); }
   void apply(AddressableLight &it, const ESPColor &current_color) override {
-    const uint32_t now = millis();
-    if (now - this->last_update_ < this->update_interval_)
-      return;
-    this->last_update_ = now;
+    const uint32_t steps = steps_due_(it.get_frame_time(), this->update_interval_, this->last_update_, MAX_STEPS);
+    for (uint32_t i = 0; i < steps; i++)
+      this->update_(it, current_color);
+  }
+  void set_update_interval(uint32_t update_interval) { this->update_interval_ = update_interval; }
+  void set_spark_probability(float spark_probability) { this->spark_probability_ = spark_probability; }
+  void set_use_random_color(bool random_color) { this->use_random_color_ = random_color; }
+  void set_fade_out_rate(uint8_t fade_out_rate) { this->fade_out_rate_ = fade_out_rate; }
+
+ protected:
+  /// Updates to catch up with in one frame, every update processes the whole strip.
+  static const uint32_t MAX_STEPS = 4;
+
+  void update_(AddressableLight &it, const ESPColor &current_color) {
     // "invert" the fade out parameter so that higher values make fade out faster
     const uint8_t fade_out_mult = 255u - this->fade_out_rate_;
-    for (auto view : it) {
-      ESPColor target = view.get() * fade_out_mult;
+    ESPColor *frame = it.get_frame_buffer();
+    const int last = it.size() - 1;
+    for (int i = 0; i <= last; i++) {
+      ESPColor target = frame[i] * fade_out_mult;
       if (target.r < 64)
         target *= 170;
-      view = target;
+      frame[i] = target;
     }
-    int last = it.size() - 1;
-    it[0].set(it[0].get() + (it[1].get() * 128));
+    frame[0] += frame[1] * 128;
     for (int i = 1; i < last; i++) {
-      it[i] = (it[i - 1].get() * 64) + it[i].get() + (it[i + 1].get() * 64);
+      frame[i] = (frame[i - 1] * 64) + frame[i] + (frame[i + 1] * 64);
     }
-    it[last] = it[last].get() + (it[last - 1].get() * 128);
+    frame[last] += frame[last - 1] * 128;
     if (random_float() < this->spark_probability_) {
       const size_t pos = random_uint32() % it.size();
       if (this->use_random_color_) {
-        it[pos] = ESPColor::random_color();
+        frame[pos] = ESPColor::random_color();
       } else {
-        it[pos] = current_color;
+        frame[pos] = current_color;
       }
     }
   }
-  void set_update_interval(uint32_t update_interval) { this->update_interval_ = update_interval; }
-  void set_spark_probability(float spark_probability) { this->spark_probability_ = spark_probability; }
-  void set_use_random_color(bool random_color) { this->use_random_color_ = random_color; }
-  void set_fade_out_rate(uint8_t fade_out_rate) { this->fade_out_rate_ = fade_out_rate; }
 
- protected:
   uint8_t fade_out_rate_{};
   uint32_t update_interval_{};
   uint32_t last_update_{0};
@@ -313,27 +344,30 @@ class AddressableFlickerEffect : public AddressableLightEffect {
  public:
   explicit AddressableFlickerEffect(const std::string &name) : AddressableLightEffect(name) {}
   void apply(AddressableLight &it, const ESPColor &current_color) override {
-    const uint32_t now = millis();
     const uint8_t intensity = this->intensity_;
     const uint8_t inv_intensity = 255 - intensity;
-    if (now - this->last_update_ < this->update_interval_)
+    const uint32_t steps = steps_due_(it.get_frame_time(), this->update_interval_, this->last_update_, MAX_STEPS);
+    if (steps == 0)
       return;
 
-    this->last_update_ = now;
     fast_random_set_seed(random_uint32());
-    for (auto var : it) {
-      const uint8_t flicker = fast_random_8() % intensity;
-      // scale down by random factor
-      var = var.get() * (255 - flicker);
-
-      // slowly fade back to "real" value
-      var = (var.get() * inv_intensity) + (current_color * intensity);
+    ESPColor *frame = it.get_frame_buffer();
+    const ESPColor add = current_color * intensity;
+    for (uint32_t step = 0; step < steps; step++) {
+      for (int32_t i = 0, size = it.size(); i < size; i++) {
+        const uint8_t flicker = fast_random_8() % intensity;
+        // scale down by random factor, then slowly fade back to "real" value
+        frame[i] = (frame[i] * uint8_t(255 - flicker)) * inv_intensity + add;
+      }
     }
   }
   void set_update_interval(uint32_t update_interval) { this->update_interval_ = update_interval; }
   void set_intensity(float intensity) { this->intensity_ = static_cast<uint8_t>(roundf(intensity * 255.0f)); }
 
  protected:
+  /// Updates to catch up with in one frame, every update processes the whole strip.
+  static const uint32_t MAX_STEPS = 4;
+
   uint32_t update_interval_{16};
   uint32_t last_update_{0};
   uint8_t intensity_{13};
@@ -259,6 +259,8 @@ class LightColorValues {
   }
 
  protected:
+  friend class LightColorValuesQ16;
+
   float state_;  ///< ON / OFF, float for transition
   float brightness_;
   float red_;
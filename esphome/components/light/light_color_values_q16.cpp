@@ -0,0 +1,23 @@
+#include "light_color_values_q16.h"
+
+namespace esphome {
+namespace light {
+
+const GammaTableQ16 *GammaTableQ16::get(float gamma) {
+  static std::vector<GammaTableQ16 *> tables;
+  for (auto *table : tables) {
+    if (table->gamma_ == gamma)
+      return table;
+  }
+  auto *table = new GammaTableQ16(gamma);
+  tables.push_back(table);
+  return table;
+}
+
+GammaTableQ16::GammaTableQ16(float gamma) : gamma_(gamma) {
+  for (int i = 0; i <= 256; i++)
+    this->table_[i] = LightColorValuesQ16::from_float(gamma_correct(i / 256.0f, gamma));
+}
+
+}  // namespace light
+}  // namespace esphome
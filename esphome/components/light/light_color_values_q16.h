@@ -0,0 +1,217 @@
+#pragma once
+
+#include "esphome/core/helpers.h"
+#include "light_color_values.h"
+
+namespace esphome {
+namespace light {
+
+/** Fixed-point counterpart of LightColorValues, for targets without an FPU (ESP8266).
+ *
+ * All attributes except the color temperature are Q16 values in the range from 0 (0.0) to ONE (1.0). The color
+ * temperature is in mired, with 16 fractional bits.
+ *
+ * The lerp and as_* methods mirror the ones of LightColorValues using only integer math. Each operation rounds to
+ * the nearest Q16 value, so results stay within a few Q16 steps of the float implementation - after gamma correction
+ * that's within 1 LSB of a 12-bit PWM output, and a few LSB of a 16-bit one.
+ */
+class LightColorValuesQ16 {
+ public:
+  static const uint16_t ONE = 0xFFFF;
+
+  LightColorValuesQ16() = default;
+  explicit LightColorValuesQ16(const LightColorValues &values)
+      : state(from_float(values.get_state())),
+        brightness(from_float(values.get_brightness())),
+        red(from_float(values.get_red())),
+        green(from_float(values.get_green())),
+        blue(from_float(values.get_blue())),
+        white(from_float(values.get_white())),
+        color_temperature(mireds_from_float(values.get_color_temperature())) {}
+
+  /// Convert back to floating point LightColorValues.
+  LightColorValues to_float() const {
+    // The values are in range already, skip the clamping of the setters.
+    LightColorValues v;
+    v.state_ = to_float(this->state);
+    v.brightness_ = to_float(this->brightness);
+    v.red_ = to_float(this->red);
+    v.green_ = to_float(this->green);
+    v.blue_ = to_float(this->blue);
+    v.white_ = to_float(this->white);
+    v.set_color_temperature(this->color_temperature / 65536.0f);
+    return v;
+  }
+
+  /// Linearly interpolate between the values in start to the values in end, see LightColorValues::lerp.
+  static LightColorValuesQ16 lerp(const LightColorValuesQ16 &start, const LightColorValuesQ16 &end,
+                                  uint16_t completion) {
+    LightColorValuesQ16 v;
+    v.state = lerp(completion, start.state, end.state);
+    v.brightness = lerp(completion, start.brightness, end.brightness);
+    v.red = lerp(completion, start.red, end.red);
+    v.green = lerp(completion, start.green, end.green);
+    v.blue = lerp(completion, start.blue, end.blue);
+    v.white = lerp(completion, start.white, end.white);
+    if (start.color_temperature <= end.color_temperature) {
+      v.color_temperature =
+          start.color_temperature + mul_u32(end.color_temperature - start.color_temperature, completion);
+    } else {
+      v.color_temperature =
+          start.color_temperature - mul_u32(start.color_temperature - end.color_temperature, completion);
+    }
+    return v;
+  }
+
+  /// Convert these light color values to a binary representation and write them to binary.
+  void as_binary(bool *binary) const { *binary = this->state == ONE; }
+
+  /// Convert these light color values to a brightness-only representation and write them to brightness.
+  void as_brightness(uint16_t *brightness) const { *brightness = mul(this->state, this->brightness); }
+
+  /// Convert these light color values to an RGB representation and write them to red, green, blue.
+  void as_rgb(uint16_t *red, uint16_t *green, uint16_t *blue) const {
+    const uint16_t brightness = mul(this->state, this->brightness);
+    *red = mul(brightness, this->red);
+    *green = mul(brightness, this->green);
+    *blue = mul(brightness, this->blue);
+  }
+
+  /// Convert these light color values to an RGBW representation and write them to red, green, blue, white.
+  void as_rgbw(uint16_t *red, uint16_t *green, uint16_t *blue, uint16_t *white) const {
+    this->as_rgb(red, green, blue);
+    *white = mul(mul(this->state, this->brightness), this->white);
+  }
+
+  /// Convert these light color values to an RGBWW representation, color temperatures are in mired (Q16).
+  void as_rgbww(uint32_t color_temperature_cw, uint32_t color_temperature_ww, uint16_t *red, uint16_t *green,
+                uint16_t *blue, uint16_t *cold_white, uint16_t *warm_white) const {
+    this->as_rgb(red, green, blue);
+    const uint16_t white = mul(mul(this->state, this->brightness), this->white);
+    this->split_white_(color_temperature_cw, color_temperature_ww, white, cold_white, warm_white);
+  }
+
+  /// Convert these light color values to an CWWW representation, color temperatures are in mired (Q16).
+  void as_cwww(uint32_t color_temperature_cw, uint32_t color_temperature_ww, uint16_t *cold_white,
+               uint16_t *warm_white) const {
+    const uint16_t white = mul(this->state, this->brightness);
+    this->split_white_(color_temperature_cw, color_temperature_ww, white, cold_white, warm_white);
+  }
+
+  bool operator==(const LightColorValuesQ16 &rhs) const {
+    return state == rhs.state && brightness == rhs.brightness && red == rhs.red && green == rhs.green &&
+           blue == rhs.blue && white == rhs.white && color_temperature == rhs.color_temperature;
+  }
+  bool operator!=(const LightColorValuesQ16 &rhs) const { return !(rhs == *this); }
+
+  /// Convert a float in the range 0.0 to 1.0 to Q16, values outside of the range are clamped.
+  static uint16_t from_float(float value) { return uint16_t(clamp(value, 0.0f, 1.0f) * ONE + 0.5f); }
+  static float to_float(uint16_t value) { return value * (1.0f / ONE); }
+  /// Convert a color temperature in mired to Q16.
+  static uint32_t mireds_from_float(float mireds) { return uint32_t(mireds * 65536.0f + 0.5f); }
+
+  /// Multiply two Q16 values, rounded to nearest.
+  static uint16_t mul(uint16_t a, uint16_t b) ALWAYS_INLINE {
+    // x / 65535 == (x + x / 65536) / 65536 closely enough for x <= 65535 * 65535
+    const uint32_t x = uint32_t(a) * b + 0x8000;
+    return (x + (x >> 16)) >> 16;
+  }
+  /// Linearly interpolate between start and end by completion, see esphome::lerp.
+  static uint16_t lerp(uint16_t completion, uint16_t start, uint16_t end) ALWAYS_INLINE {
+    if (start <= end)
+      return start + mul(end - start, completion);
+    return start - mul(start - end, completion);
+  }
+  /// Q16 version of LightTransitionTransformer::smoothed_progress.
+  static uint16_t smoothed_progress(uint16_t x) {
+    // x^3 * (x * (x * 6 - 15) + 10), evaluated in Q32 with 1.0 = 2^32
+    const uint64_t xq = (uint32_t(x) << 8) + (x >> 8);  // Q24, x * 2^24 / 65535
+    const uint64_t x2 = (xq * xq) >> 16;
+    const uint64_t x3 = (x2 * xq) >> 24;
+    const uint64_t poly = 6 * x2 + (uint64_t(10) << 32) - 15 * (xq << 8);
+    const uint64_t result = ((x3 >> 8) * (poly >> 8)) >> 16;
+    return (result * ONE + 0x80000000UL) >> 32;
+  }
+
+  uint16_t state{0};
+  uint16_t brightness{ONE};
+  uint16_t red{ONE};
+  uint16_t green{ONE};
+  uint16_t blue{ONE};
+  uint16_t white{ONE};
+  uint32_t color_temperature{65536};  ///< Color Temperature in Mired, Q16
+
+ protected:
+  /// Multiply a 32-bit value by a Q16 value, rounded to nearest.
+  static uint32_t mul_u32(uint32_t a, uint16_t b) {
+    const uint64_t x = uint64_t(a) * b + 0x8000;
+    return (x + (x >> 16)) >> 16;
+  }
+
+  void split_white_(uint32_t color_temperature_cw, uint32_t color_temperature_ww, uint16_t white,
+                    uint16_t *cold_white, uint16_t *warm_white) const {
+    uint32_t color_temp = this->color_temperature;
+    if (color_temp < color_temperature_cw)
+      color_temp = color_temperature_cw;
+    if (color_temp > color_temperature_ww)
+      color_temp = color_temperature_ww;
+    // The channel closer to the color temperature is at full white, the other one is scaled by the distance ratio.
+    const uint32_t cw_distance = color_temp - color_temperature_cw;
+    const uint32_t ww_distance = color_temperature_ww - color_temp;
+    if (ww_distance >= cw_distance) {
+      *cold_white = white;
+      *warm_white = ww_distance == 0 ? white : mul(white, ratio_(cw_distance, ww_distance));
+    } else {
+      *cold_white = mul(white, ratio_(ww_distance, cw_distance));
+      *warm_white = white;
+    }
+  }
+  /// Q16 value of num / den, with num <= den.
+  static uint16_t ratio_(uint32_t num, uint32_t den) {
+    if (num == 0)
+      return 0;
+    return (uint64_t(num) * ONE + den / 2) / den;
+  }
+};
+
+/** Gamma correction for Q16 values.
+ *
+ * Holds the gamma curve at 257 points and interpolates linearly in between, which is accurate to about one Q16 step
+ * for gamma values >= 1. That's within 1 LSB for outputs with up to 16 bits, so a single table serves all PWM
+ * outputs. Tables are shared between all lights with the same gamma.
+ */
+class GammaTableQ16 {
+ public:
+  /// Get the (shared) table for gamma, creating it on first use.
+  static const GammaTableQ16 *get(float gamma);
+  /// Whether the table is accurate for gamma, the curve is too steep near 0 for gamma values between 0 and 1.
+  static bool supports_gamma(float gamma) { return gamma <= 0.0f || gamma >= 1.0f; }
+
+  /// Apply the gamma correction to value, the Q16 equivalent of esphome::gamma_correct().
+  uint16_t correct(uint16_t value) const {
+    // Position in the table with 16 fractional bits, value * 256 / 65535.
+    return this->correct_position_((uint32_t(value) << 8) + (value >> 8));
+  }
+  /// Apply the gamma correction to a float in the range 0.0 to 1.0, without the rounding of value to Q16 first.
+  uint16_t correct_float(float value) const {
+    return this->correct_position_(uint32_t(clamp(value, 0.0f, 1.0f) * 16777215.0f + 0.5f));
+  }
+
+  float get_gamma() const { return this->gamma_; }
+
+ protected:
+  explicit GammaTableQ16(float gamma);
+
+  /// Interpolate the curve at position (0 to 2^24 - 1), the table index with 16 fractional bits.
+  uint16_t correct_position_(uint32_t pos) const {
+    const uint16_t low = this->table_[pos >> 16];
+    const uint16_t high = this->table_[(pos >> 16) + 1];
+    return low + (((high - low) * (pos & 0xFFFF) + 0x8000) >> 16);
+  }
+
+  float gamma_;
+  uint16_t table_[257];
+};
+
+}  // namespace light
+}  // namespace esphome
@@ -96,6 +96,11 @@ struct LightStateRTCState {
 void LightState::setup() {
   ESP_LOGCONFIG(TAG, "Setting up light '%s'...", this->get_name().c_str());
 
+  if (this->fixed_point_ && !GammaTableQ16::supports_gamma(this->gamma_correct_)) {
+    ESP_LOGW(TAG, "Fixed point math doesn't support gamma values below 1.0, using floats.");
+    this->fixed_point_ = false;
+  }
+
   this->output_->setup_state(this);
   for (auto *effect : this->effects_) {
     effect->init_internal(this);
@@ -148,6 +153,10 @@ void LightState::loop() {
       if (this->transformer_->publish_at_end())
         this->publish_state();
       this->transformer_ = nullptr;
+    } else if (this->fixed_point_) {
+      this->current_values_q16_ = this->transformer_->get_values_q16();
+      this->current_values_q16_source_ = this->current_values = this->current_values_q16_.to_float();
+      this->remote_values = this->transformer_->get_remote_values();
     } else {
       this->current_values = this->transformer_->get_values();
       this->remote_values = this->transformer_->get_remote_values();
@@ -178,6 +187,7 @@ void LightState::dump_config() {
   if (this->get_traits().get_supports_brightness()) {
     ESP_LOGCONFIG(TAG, "  Default Transition Length: %.1fs", this->default_transition_length_ / 1e3f);
     ESP_LOGCONFIG(TAG, "  Gamma Correct: %.2f", this->gamma_correct_);
+    ESP_LOGCONFIG(TAG, "  Fixed Point: %s", YESNO(this->fixed_point_));
   }
   if (this->get_traits().get_supports_color_temperature()) {
     ESP_LOGCONFIG(TAG, "  Min Mireds: %.1f", this->get_traits().get_min_mireds());
@@ -699,40 +709,113 @@ LightCall &LightCall::set_rgbw(float red, float green, float blue, float white)
 
 float LightState::get_setup_priority() const { return setup_priority::HARDWARE - 1.0f; }
 LightOutput *LightState::get_output() const { return this->output_; }
-void LightState::set_gamma_correct(float gamma_correct) { this->gamma_correct_ = gamma_correct; }
+void LightState::set_gamma_correct(float gamma_correct) {
+  this->gamma_correct_ = gamma_correct;
+  this->gamma_table_ = nullptr;
+}
+void LightState::set_fixed_point(bool fixed_point) { this->fixed_point_ = fixed_point; }
+const LightColorValuesQ16 &LightState::get_current_values_q16_() {
+  if (this->current_values != this->current_values_q16_source_) {
+    this->current_values_q16_ = LightColorValuesQ16(this->current_values);
+    this->current_values_q16_source_ = this->current_values;
+  }
+  return this->current_values_q16_;
+}
+const GammaTableQ16 *LightState::get_gamma_table_() {
+  if (this->gamma_table_ == nullptr)
+    this->gamma_table_ = GammaTableQ16::get(this->gamma_correct_);
+  return this->gamma_table_;
+}
+float LightState::apply_gamma_(float value) {
+  // gamma correction disabled, don't round the value through an identity table
+  if (this->gamma_correct_ <= 0.0f)
+    return value;
+  if (!GammaTableQ16::supports_gamma(this->gamma_correct_))
+    return gamma_correct(value, this->gamma_correct_);
+  return LightColorValuesQ16::to_float(this->get_gamma_table_()->correct_float(value));
+}
+float LightState::apply_gamma_q16_(uint16_t value) {
+  if (this->gamma_correct_ <= 0.0f)
+    return LightColorValuesQ16::to_float(value);
+  return LightColorValuesQ16::to_float(this->get_gamma_table_()->correct(value));
+}
 void LightState::current_values_as_binary(bool *binary) { this->current_values.as_binary(binary); }
 void LightState::current_values_as_brightness(float *brightness) {
+  if (this->fixed_point_) {
+    uint16_t value;
+    this->get_current_values_q16_().as_brightness(&value);
+    *brightness = this->apply_gamma_q16_(value);
+    return;
+  }
   this->current_values.as_brightness(brightness);
-  *brightness = gamma_correct(*brightness, this->gamma_correct_);
+  *brightness = this->apply_gamma_(*brightness);
 }
 void LightState::current_values_as_rgb(float *red, float *green, float *blue) {
+  if (this->fixed_point_) {
+    uint16_t r, g, b;
+    this->get_current_values_q16_().as_rgb(&r, &g, &b);
+    *red = this->apply_gamma_q16_(r);
+    *green = this->apply_gamma_q16_(g);
+    *blue = this->apply_gamma_q16_(b);
+    return;
+  }
   this->current_values.as_rgb(red, green, blue);
-  *red = gamma_correct(*red, this->gamma_correct_);
-  *green = gamma_correct(*green, this->gamma_correct_);
-  *blue = gamma_correct(*blue, this->gamma_correct_);
+  *red = this->apply_gamma_(*red);
+  *green = this->apply_gamma_(*green);
+  *blue = this->apply_gamma_(*blue);
 }
 void LightState::current_values_as_rgbw(float *red, float *green, float *blue, float *white) {
+  if (this->fixed_point_) {
+    uint16_t r, g, b, w;
+    this->get_current_values_q16_().as_rgbw(&r, &g, &b, &w);
+    *red = this->apply_gamma_q16_(r);
+    *green = this->apply_gamma_q16_(g);
+    *blue = this->apply_gamma_q16_(b);
+    *white = this->apply_gamma_q16_(w);
+    return;
+  }
   this->current_values.as_rgbw(red, green, blue, white);
-  *red = gamma_correct(*red, this->gamma_correct_);
-  *green = gamma_correct(*green, this->gamma_correct_);
-  *blue = gamma_correct(*blue, this->gamma_correct_);
-  *white = gamma_correct(*white, this->gamma_correct_);
+  *red = this->apply_gamma_(*red);
+  *green = this->apply_gamma_(*green);
+  *blue = this->apply_gamma_(*blue);
+  *white = this->apply_gamma_(*white);
 }
 void LightState::current_values_as_rgbww(float *red, float *green, float *blue, float *cold_white, float *warm_white) {
   auto traits = this->get_traits();
+  if (this->fixed_point_) {
+    uint16_t r, g, b, cw, ww;
+    this->get_current_values_q16_().as_rgbww(LightColorValuesQ16::mireds_from_float(traits.get_min_mireds()),
+                                             LightColorValuesQ16::mireds_from_float(traits.get_max_mireds()), &r,
+                                             &g, &b, &cw, &ww);
+    *red = this->apply_gamma_q16_(r);
+    *green = this->apply_gamma_q16_(g);
+    *blue = this->apply_gamma_q16_(b);
+    *cold_white = this->apply_gamma_q16_(cw);
+    *warm_white = this->apply_gamma_q16_(ww);
+    return;
+  }
   this->current_values.as_rgbww(traits.get_min_mireds(), traits.get_max_mireds(), red, green, blue, cold_white,
                                 warm_white);
-  *red = gamma_correct(*red, this->gamma_correct_);
-  *green = gamma_correct(*green, this->gamma_correct_);
-  *blue = gamma_correct(*blue, this->gamma_correct_);
-  *cold_white = gamma_correct(*cold_white, this->gamma_correct_);
-  *warm_white = gamma_correct(*warm_white, this->gamma_correct_);
+  *red = this->apply_gamma_(*red);
+  *green = this->apply_gamma_(*green);
+  *blue = this->apply_gamma_(*blue);
+  *cold_white = this->apply_gamma_(*cold_white);
+  *warm_white = this->apply_gamma_(*warm_white);
 }
 void LightState::current_values_as_cwww(float *cold_white, float *warm_white) {
   auto traits = this->get_traits();
+  if (this->fixed_point_) {
+    uint16_t cw, ww;
+    this->get_current_values_q16_().as_cwww(LightColorValuesQ16::mireds_from_float(traits.get_min_mireds()),
+                                            LightColorValuesQ16::mireds_from_float(traits.get_max_mireds()), &cw,
+                                            &ww);
+    *cold_white = this->apply_gamma_q16_(cw);
+    *warm_white = this->apply_gamma_q16_(ww);
+    return;
+  }
   this->current_values.as_cwww(traits.get_min_mireds(), traits.get_max_mireds(), cold_white, warm_white);
-  *cold_white = gamma_correct(*cold_white, this->gamma_correct_);
-  *warm_white = gamma_correct(*warm_white, this->gamma_correct_);
+  *cold_white = this->apply_gamma_(*cold_white);
+  *warm_white = this->apply_gamma_(*warm_white);
 }
 void LightState::add_new_remote_values_callback(std::function<void()> &&send_callback) {
   this->remote_values_callback_.add(std::move(send_callback));
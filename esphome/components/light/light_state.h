@@ -5,6 +5,7 @@
 #include "esphome/core/preferences.h"
 #include "light_effect.h"
 #include "light_color_values.h"
+#include "light_color_values_q16.h"
 #include "light_traits.h"
 #include "light_transformer.h"
 
@@ -258,6 +259,17 @@ class LightState : public Nameable, public Component {
   float get_gamma_correct() const { return this->gamma_correct_; }
   void set_restore_mode(LightRestoreMode restore_mode) { restore_mode_ = restore_mode; }
 
+  /** Use fixed-point (Q16) math for transitions, gamma correction and the current_values_as_* conversions.
+   *
+   * Meant for targets without an FPU like the ESP8266, where the float math costs noticeable loop time during
+   * transitions. Outputs stay within 1 LSB of the float path for PWM resolutions up to 12 bits, and within a few LSB
+   * at 16 bits.
+   * Gamma values between 0 and 1 aren't supported by the fixed-point gamma table, for those lights setup() switches
+   * back to floats.
+   */
+  void set_fixed_point(bool fixed_point);
+  bool get_fixed_point() const { return this->fixed_point_; }
+
   const std::vector<LightEffect *> &get_effects() const;
 
   void add_effects(std::vector<LightEffect *> effects);
@@ -299,6 +311,15 @@ class LightState : public Nameable, public Component {
 
   LightEffect *get_active_effect_();
 
+  /// current_values in fixed point, converted again only when current_values changed.
+  const LightColorValuesQ16 &get_current_values_q16_();
+  /// The gamma table for gamma_correct_, created on first use so that lights that don't need it don't allocate it.
+  const GammaTableQ16 *get_gamma_table_();
+  /// Apply the gamma correction with the gamma table, or powf() for the gamma values the table doesn't support.
+  float apply_gamma_(float value);
+  /// Apply the gamma correction to a Q16 value and convert the result to float for the outputs.
+  float apply_gamma_q16_(uint16_t value);
+
   /// Object used to store the persisted values of the light.
   ESPPreferenceObject rtc_;
   /// Restore mode of the light.
@@ -322,6 +343,14 @@ class LightState : public Nameable, public Component {
   bool next_write_{true};
   /// Gamma correction factor for the light.
   float gamma_correct_{};
+  /// Whether to use fixed-point math, see set_fixed_point().
+  bool fixed_point_{false};
+  /// The gamma table for gamma_correct_, see get_gamma_table_().
+  const GammaTableQ16 *gamma_table_{nullptr};
+  /// current_values in fixed point, valid as long as current_values equals current_values_q16_source_.
+  LightColorValuesQ16 current_values_q16_{};
+  /// The current_values that current_values_q16_ was computed from.
+  LightColorValues current_values_q16_source_{};
   /// List of effects for this light.
   std::vector<LightEffect *> effects_;
 };
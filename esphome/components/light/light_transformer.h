@@ -3,6 +3,7 @@
 #include "esphome/core/component.h"
 #include "esphome/core/helpers.h"
 #include "light_color_values.h"
+#include "light_color_values_q16.h"
 
 namespace esphome {
 namespace light {
@@ -22,6 +23,9 @@ class LightTransformer {
   /// This will be called to get the current values for output.
   virtual LightColorValues get_values() = 0;
 
+  /// get_values() in fixed point, see LightState::set_fixed_point().
+  virtual LightColorValuesQ16 get_values_q16() { return LightColorValuesQ16(this->get_values()); }
+
   /// The values that should be reported to the front-end.
   virtual LightColorValues get_remote_values() { return this->get_target_values_(); }
 
@@ -33,6 +37,19 @@ class LightTransformer {
 
   float get_progress() { return clamp((millis() - this->start_time_) / float(this->length_), 0.0f, 1.0f); }
 
+  /// get_progress() as a Q16 value, computed without float math.
+  uint16_t get_progress_q16() {
+    uint32_t elapsed = millis() - this->start_time_;
+    uint32_t length = this->length_;
+    if (elapsed >= length)
+      return LightColorValuesQ16::ONE;
+    while (length > 0xFFFF) {
+      elapsed >>= 1;
+      length >>= 1;
+    }
+    return (elapsed * LightColorValuesQ16::ONE + length / 2) / length;
+  }
+
  protected:
   const LightColorValues &get_start_values_() const { return this->start_values_; }
 
@@ -58,6 +75,8 @@ class LightTransitionTransformer : public LightTransformer {
       this->start_values_.set_white(target_values.get_white());
       this->start_values_.set_color_temperature(target_values.get_color_temperature());
     }
+    this->start_values_q16_ = LightColorValuesQ16(this->start_values_);
+    this->target_values_q16_ = LightColorValuesQ16(this->target_values_);
   }
 
   LightColorValues get_values() override {
@@ -65,10 +84,19 @@ class LightTransitionTransformer : public LightTransformer {
     return LightColorValues::lerp(this->get_start_values_(), this->get_target_values_(), v);
   }
 
+  LightColorValuesQ16 get_values_q16() override {
+    uint16_t v = LightColorValuesQ16::smoothed_progress(this->get_progress_q16());
+    return LightColorValuesQ16::lerp(this->start_values_q16_, this->target_values_q16_, v);
+  }
+
   bool publish_at_end() override { return false; }
   bool is_transition() override { return true; }
 
   static float smoothed_progress(float x) { return x * x * x * (x * (x * 6.0f - 15.0f) + 10.0f); }
+
+ protected:
+  LightColorValuesQ16 start_values_q16_;
+  LightColorValuesQ16 target_values_q16_;
 };
 
 class LightFlashTransformer : public LightTransformer {
@@ -73,11 +73,13 @@ LoggerMessageTrigger = logger_ns.class_('LoggerMessageTrigger',
                                         automation.Trigger.template(cg.int_, cg.const_char_ptr,
                                                                     cg.const_char_ptr))
 
+CONF_ASYNC_BUFFER_SIZE = 'async_buffer_size'
 CONF_ESP8266_STORE_LOG_STRINGS_IN_FLASH = 'esp8266_store_log_strings_in_flash'
 CONFIG_SCHEMA = cv.All(cv.Schema({
     cv.GenerateID(): cv.declare_id(Logger),
     cv.Optional(CONF_BAUD_RATE, default=115200): cv.positive_int,
     cv.Optional(CONF_TX_BUFFER_SIZE, default=512): cv.validate_bytes,
+    cv.Optional(CONF_ASYNC_BUFFER_SIZE): cv.All(cv.validate_bytes, cv.int_range(min=256, max=65536)),
     cv.Optional(CONF_HARDWARE_UART, default='UART0'): uart_selection,
     cv.Optional(CONF_LEVEL, default='DEBUG'): is_log_level,
     cv.Optional(CONF_LOGS, default={}): cv.Schema({
@@ -101,6 +103,8 @@ def to_code(config):
                      HARDWARE_UART_TO_UART_SELECTION[config[CONF_HARDWARE_UART]])
     log = cg.Pvariable(config[CONF_ID], rhs)
     cg.add(log.pre_setup())
+    if CONF_ASYNC_BUFFER_SIZE in config:
+        cg.add(log.set_async_buffer_size(config[CONF_ASYNC_BUFFER_SIZE]))
 
     for tag, level in config[CONF_LOGS].items():
         cg.add(log.set_log_level(tag, LOG_LEVELS[level]))
@@ -0,0 +1,83 @@
+#include "log_ring_buffer.h"
+#include "esphome/core/helpers.h"
+
+#include <cstring>
+
+namespace esphome {
+namespace logger {
+
+LogRingBuffer::LogRingBuffer(size_t capacity) {
+  uint32_t size = 64;
+  while (size < capacity)
+    size <<= 1;
+  this->buffer_ = new uint8_t[size];
+  this->mask_ = size - 1;
+}
+bool HOT LogRingBuffer::push(int level, const char *tag, const char *message, size_t message_len) {
+  const size_t tag_len = strlen(tag);
+  // 2 bytes length, 1 byte level and both strings with null terminator
+  const uint32_t length = 3 + tag_len + 1 + message_len + 1;
+  const uint32_t capacity = this->mask_ + 1;
+  const uint32_t head = this->head_.load(std::memory_order_relaxed);
+  const uint32_t tail = this->tail_.load(std::memory_order_acquire);
+
+  // Records are never split, if it doesn't fit before the end of the buffer continue at the start
+  uint32_t pos = head & this->mask_;
+  uint32_t padding = 0;
+  if (capacity - pos < length)
+    padding = capacity - pos;
+  if (length > UINT16_MAX || (head - tail) + padding + length > capacity) {
+    this->dropped_.store(this->dropped_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    return false;
+  }
+  if (padding >= 2) {
+    // length 0 marks the padding, a shorter padding is implied
+    memset(this->buffer_ + pos, 0, 2);
+  }
+
+  pos = (head + padding) & this->mask_;
+  uint8_t *record = this->buffer_ + pos;
+  const auto length16 = static_cast<uint16_t>(length);
+  memcpy(record, &length16, 2);
+  record[2] = static_cast<uint8_t>(level);
+  memcpy(record + 3, tag, tag_len + 1);
+  memcpy(record + 3 + tag_len + 1, message, message_len);
+  record[length - 1] = '\0';
+
+  this->head_.store(head + padding + length, std::memory_order_release);
+  return true;
+}
+bool LogRingBuffer::front(int &level, const char *&tag, const char *&message) {
+  const uint32_t capacity = this->mask_ + 1;
+  const uint32_t head = this->head_.load(std::memory_order_acquire);
+  uint32_t tail = this->tail_.load(std::memory_order_relaxed);
+  while (tail != head) {
+    const uint32_t pos = tail & this->mask_;
+    const uint32_t remaining = capacity - pos;
+    uint16_t length = 0;
+    if (remaining >= 2)
+      memcpy(&length, this->buffer_ + pos, 2);
+    if (length == 0) {
+      // padding up to the end of the buffer
+      tail += remaining;
+      this->tail_.store(tail, std::memory_order_release);
+      continue;
+    }
+
+    const char *record = reinterpret_cast<const char *>(this->buffer_ + pos);
+    level = record[2];
+    tag = record + 3;
+    message = tag + strlen(tag) + 1;
+    this->front_length_ = length;
+    return true;
+  }
+  return false;
+}
+void LogRingBuffer::pop() {
+  const uint32_t tail = this->tail_.load(std::memory_order_relaxed);
+  this->tail_.store(tail + this->front_length_, std::memory_order_release);
+  this->front_length_ = 0;
+}
+
+}  // namespace logger
+}  // namespace esphome
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace logger {
+
+/** Lock-free single producer, single consumer ring buffer of formatted log records, used by the async logger mode.
+ *
+ * Records are stored contiguously ([length][level][tag\0][message\0]) so that the consumer can pass them on without
+ * copying. If a record doesn't fit, it's dropped and counted instead of blocking the producer.
+ */
+class LogRingBuffer {
+ public:
+  /// The capacity is rounded up to a power of two.
+  explicit LogRingBuffer(size_t capacity);
+
+  /// Producer side: copy a record into the buffer, returns false if it was dropped because the buffer is full.
+  bool push(int level, const char *tag, const char *message, size_t message_len);
+
+  /// Consumer side: get the oldest record, the strings stay valid until pop() is called.
+  bool front(int &level, const char *&tag, const char *&message);
+  /// Consumer side: remove the record returned by front().
+  void pop();
+
+  bool empty() const {
+    return this->head_.load(std::memory_order_acquire) == this->tail_.load(std::memory_order_relaxed);
+  }
+  size_t get_capacity() const { return this->mask_ + 1; }
+  /// Number of records dropped because the buffer was full.
+  uint32_t get_dropped() const { return this->dropped_.load(std::memory_order_relaxed); }
+
+ protected:
+  uint8_t *buffer_;
+  uint32_t mask_;
+  /// Free running write/read positions, the buffer index is position & mask_.
+  std::atomic<uint32_t> head_{0};
+  std::atomic<uint32_t> tail_{0};
+  std::atomic<uint32_t> dropped_{0};
+  uint16_t front_length_{0};
+};
+
+}  // namespace logger
+}  // namespace esphome
@@ -9,6 +9,9 @@ namespace esphome {
 namespace logger {
 
 static const char *TAG = "logger";
+#ifdef ARDUINO_ARCH_ESP32
+static const TickType_t ASYNC_LOCK_TIMEOUT = pdMS_TO_TICKS(20);
+#endif
 
 static const char *LOG_LEVEL_COLORS[] = {
     "",                                            // NONE
@@ -46,11 +49,24 @@ void HOT Logger::log_vprintf_(int level, const char *tag, int line, const char *
   if (level > this->level_for(tag))
     return;
 
+#ifdef ARDUINO_ARCH_ESP32
+  if (this->async_lock_ != nullptr) {
+    // Never block in an ISR, and don't hang a task if the lock holder is stuck (e.g. on a full UART)
+    if (xPortInIsrContext() || xSemaphoreTakeRecursive(this->async_lock_, ASYNC_LOCK_TIMEOUT) != pdTRUE) {
+      this->lock_dropped_.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+  }
+#endif
   this->reset_buffer_();
   this->write_header_(level, tag, line);
   this->vprintf_to_buffer_(format, args);
   this->write_footer_();
   this->log_message_(level, tag);
+#ifdef ARDUINO_ARCH_ESP32
+  if (this->async_lock_ != nullptr)
+    xSemaphoreGiveRecursive(this->async_lock_);
+#endif
 }
 #ifdef USE_STORE_LOG_STR_IN_FLASH
 void Logger::log_vprintf_(int level, const char *tag, int line, const __FlashStringHelper *format,
@@ -101,10 +117,57 @@ void HOT Logger::log_message_(int level, const char *tag, int offset) {
   this->set_null_terminator_();
 
   const char *msg = this->tx_buffer_ + offset;
+  if (this->async_active_) {
+    this->async_buffer_->push(level, tag, msg, this->tx_buffer_at_ - offset);
+    return;
+  }
+  this->write_message_(level, tag, msg);
+}
+void Logger::write_message_(int level, const char *tag, const char *msg) {
   if (this->baud_rate_ > 0)
     this->hw_serial_->println(msg);
   this->log_callback_.call(level, tag, msg);
 }
+void Logger::loop() {
+  if (this->async_buffer_ == nullptr)
+    return;
+  this->async_active_ = true;
+
+  int level;
+  const char *tag;
+  const char *msg;
+  while (this->async_buffer_->front(level, tag, msg)) {
+    this->write_message_(level, tag, msg);
+    this->async_buffer_->pop();
+  }
+
+  const uint32_t dropped = this->get_dropped_messages();
+  if (dropped != this->reported_dropped_) {
+    ESP_LOGW(TAG, "Dropped %u log messages because the async buffer was full or busy",
+             dropped - this->reported_dropped_);
+    this->reported_dropped_ = dropped;
+  }
+}
+uint32_t Logger::next_wake_in() {
+  if (this->async_buffer_ != nullptr && !this->async_buffer_->empty())
+    return 0;
+  return UINT32_MAX;
+}
+void Logger::set_async_buffer_size(size_t size) {
+  this->async_buffer_ = new LogRingBuffer(size);
+#ifdef ARDUINO_ARCH_ESP32
+  this->async_lock_ = xSemaphoreCreateRecursiveMutex();
+#endif
+}
+uint32_t Logger::get_dropped_messages() const {
+  if (this->async_buffer_ == nullptr)
+    return 0;
+#ifdef ARDUINO_ARCH_ESP32
+  return this->async_buffer_->get_dropped() + this->lock_dropped_.load(std::memory_order_relaxed);
+#else
+  return this->async_buffer_->get_dropped();
+#endif
+}
 
 Logger::Logger(uint32_t baud_rate, size_t tx_buffer_size, UARTSelection uart)
     : baud_rate_(baud_rate), tx_buffer_size_(tx_buffer_size), uart_(uart) {
@@ -176,6 +239,9 @@ void Logger::dump_config() {
   ESP_LOGCONFIG(TAG, "  Level: %s", LOG_LEVELS[ESPHOME_LOG_LEVEL]);
   ESP_LOGCONFIG(TAG, "  Log Baud Rate: %u", this->baud_rate_);
   ESP_LOGCONFIG(TAG, "  Hardware UART: %s", UART_SELECTIONS[this->uart_]);
+  if (this->async_buffer_ != nullptr) {
+    ESP_LOGCONFIG(TAG, "  Async Buffer Size: %u", this->async_buffer_->get_capacity());
+  }
   for (auto &it : this->log_levels_) {
     ESP_LOGCONFIG(TAG, "  Level for '%s': %s", it.tag.c_str(), LOG_LEVELS[it.level]);
   }
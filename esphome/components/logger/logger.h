@@ -5,6 +5,14 @@
 #include "esphome/core/log.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/defines.h"
+#include "log_ring_buffer.h"
+
+#include <atomic>
+
+#ifdef ARDUINO_ARCH_ESP32
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#endif
 
 namespace esphome {
 
@@ -37,6 +45,15 @@ class Logger : public Component {
   /// Get the UART used by the logger.
   UARTSelection get_uart() const;
 
+  /** Enable the async mode with a ring buffer of size bytes.
+   *
+   * Log calls then only format the message and put it into the ring buffer. Writing it to the UART and calling
+   * the log callbacks (API, MQTT, web server) is deferred to loop(), so that logging doesn't block on I/O.
+   */
+  void set_async_buffer_size(size_t size);
+  /// Number of messages dropped because the async ring buffer was full (or, on ESP32, its lock was busy).
+  uint32_t get_dropped_messages() const;
+
   /// Set the log level of the specified tag.
   void set_log_level(const std::string &tag, int log_level);
 
@@ -45,6 +62,9 @@ class Logger : public Component {
   /// Set up this component.
   void pre_setup();
   void dump_config() override;
+  /// Write out the messages queued in async mode.
+  void loop() override;
+  uint32_t next_wake_in() override;
 
   int level_for(const char *tag);
 
@@ -62,6 +82,7 @@ class Logger : public Component {
   void write_header_(int level, const char *tag, int line);
   void write_footer_();
   void log_message_(int level, const char *tag, int offset = 0);
+  void write_message_(int level, const char *tag, const char *msg);
 
   inline bool is_buffer_full_() const { return this->tx_buffer_at_ >= this->tx_buffer_size_; }
   inline int buffer_remaining_capacity_() const { return this->tx_buffer_size_ - this->tx_buffer_at_; }
@@ -113,6 +134,16 @@ class Logger : public Component {
   };
   std::vector<LogLevelOverride> log_levels_;
   CallbackManager<void(int, const char *, const char *)> log_callback_{};
+  LogRingBuffer *async_buffer_{nullptr};
+  /// Async mode only kicks in with the first loop(), before that messages are written right away.
+  bool async_active_{false};
+  uint32_t reported_dropped_{0};
+#ifdef ARDUINO_ARCH_ESP32
+  /// Serializes log calls from other tasks (BLE, camera, ...), they share tx_buffer_ and the ring buffer producer.
+  SemaphoreHandle_t async_lock_{nullptr};
+  /// Messages dropped because they were logged from an ISR or the lock couldn't be taken in time.
+  std::atomic<uint32_t> lock_dropped_{0};
+#endif
 };
 
 extern Logger *global_logger;
@@ -32,6 +32,7 @@ void MQTTClientComponent::setup() {
   this->mqtt_client_.onDisconnect([this](AsyncMqttClientDisconnectReason reason) {
     this->state_ = MQTT_CLIENT_DISCONNECTED;
     this->disconnect_reason_ = reason;
+    App.wake_loop();
   });
 #ifdef USE_LOGGER
   if (this->is_log_message_enabled() && logger::global_logger != nullptr) {
@@ -205,6 +206,8 @@ void MQTTClientComponent::check_connected() {
 
   this->resubscribe_subscriptions_();
 
+  // All states are sent again anyway
+  this->dirty_states_.clear();
   for (MQTTComponent *component : this->children_)
     component->schedule_resend_state();
 }
@@ -274,6 +277,8 @@ void MQTTClientComponent::loop() {
 
         this->last_connected_ = now;
         this->resubscribe_subscriptions_();
+        this->dirty_states_.flush(
+            [](MQTTComponent *component, uint8_t tag) { return component->send_initial_state(); });
       }
       break;
   }
@@ -283,6 +288,19 @@ void MQTTClientComponent::loop() {
     App.reboot();
   }
 }
+uint32_t MQTTClientComponent::next_wake_in() {
+  // Connecting, retrying subscriptions and the birth message and sending states are polled
+  if (this->state_ != MQTT_CLIENT_CONNECTED || this->disconnect_reason_.has_value() || !this->dirty_states_.empty())
+    return Component::next_wake_in();
+  if (!this->birth_message_.topic.empty() && !this->sent_birth_message_)
+    return Component::next_wake_in();
+  for (auto &subscription : this->subscriptions_) {
+    if (!subscription.subscribed)
+      return Component::next_wake_in();
+  }
+  // Connected, disconnects and messages arrive through the client callbacks (messages are deferred on ESP8266)
+  return UINT32_MAX;
+}
 float MQTTClientComponent::get_setup_priority() const { return setup_priority::AFTER_WIFI; }
 
 // Subscribe
@@ -465,6 +483,7 @@ void MQTTClientComponent::disable_log_message() { this->log_message_.topic = "";
 bool MQTTClientComponent::is_log_message_enabled() const { return !this->log_message_.topic.empty(); }
 void MQTTClientComponent::set_reboot_timeout(uint32_t reboot_timeout) { this->reboot_timeout_ = reboot_timeout; }
 void MQTTClientComponent::register_mqtt_component(MQTTComponent *component) { this->children_.push_back(component); }
+void MQTTClientComponent::mark_state_dirty(MQTTComponent *component) { this->dirty_states_.mark(component); }
 void MQTTClientComponent::set_log_level(int level) { this->log_level_ = level; }
 void MQTTClientComponent::set_keep_alive(uint16_t keep_alive_s) { this->mqtt_client_.setKeepAlive(keep_alive_s); }
 void MQTTClientComponent::set_log_message_template(MQTTMessage &&message) { this->log_message_ = std::move(message); }
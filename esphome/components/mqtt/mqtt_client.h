@@ -189,6 +189,7 @@ class MQTTClientComponent : public Component {
   void dump_config() override;
   /// Reconnect if required
   void loop() override;
+  uint32_t next_wake_in() override;
   /// MQTT client setup priority
   float get_setup_priority() const override;
 
@@ -202,6 +203,9 @@ class MQTTClientComponent : public Component {
 
   void register_mqtt_component(MQTTComponent *component);
 
+  /// Publish the state of component again once there is space in the TCP buffer (used when a state publish failed).
+  void mark_state_dirty(MQTTComponent *component);
+
   bool is_connected();
 
   void on_shutdown() override;
@@ -259,6 +263,7 @@ class MQTTClientComponent : public Component {
   bool dns_resolved_{false};
   bool dns_resolve_error_{false};
   std::vector<MQTTComponent *> children_;
+  DirtySet<MQTTComponent> dirty_states_;
   uint32_t reboot_timeout_{300000};
   uint32_t connect_begin_;
   uint32_t last_connected_{0};
@@ -37,13 +37,20 @@ const std::string MQTTComponent::get_command_topic_() const {
 bool MQTTComponent::publish(const std::string &topic, const std::string &payload) {
   if (topic.empty())
     return false;
-  return global_mqtt_client->publish(topic, payload, 0, this->retain_);
+  return this->check_published_(global_mqtt_client->publish(topic, payload, 0, this->retain_));
 }
 
 bool MQTTComponent::publish_json(const std::string &topic, const json::json_build_t &f) {
   if (topic.empty())
     return false;
-  return global_mqtt_client->publish_json(topic, f, 0, this->retain_);
+  return this->check_published_(global_mqtt_client->publish_json(topic, f, 0, this->retain_));
+}
+
+bool MQTTComponent::check_published_(bool published) {
+  // If the TCP buffer is full, publish the (then current) state again later. On reconnect all states are sent anyway.
+  if (!published && this->is_connected_())
+    global_mqtt_client->mark_state_dirty(this);
+  return published;
 }
 
 bool MQTTComponent::send_discovery_() {
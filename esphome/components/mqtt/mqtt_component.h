@@ -158,6 +158,9 @@ class MQTTComponent : public Component {
 
   bool is_connected_() const;
 
+  /// Mark this component's state dirty if publishing it failed while connected, returns published.
+  bool check_published_(bool published);
+
   /// Internal method to start sending discovery info, this will call send_discovery().
   bool send_discovery_();
 
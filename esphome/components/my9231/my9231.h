@@ -33,7 +33,7 @@ class MY9231OutputComponent : public Component {
 
    protected:
     void write_state(float state) override {
-      auto amount = uint16_t(state * this->parent_->get_max_amount_());
+      auto amount = static_cast<uint16_t>(roundf(state * this->parent_->get_max_amount_()));
       this->parent_->set_channel_value_(this->channel_, amount);
     }
 
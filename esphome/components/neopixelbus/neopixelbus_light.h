@@ -52,11 +52,6 @@ class NeoPixelBusLightOutputBase : public light::AddressableLight {
  public:
   NeoPixelBus<T_COLOR_FEATURE, T_METHOD> *get_controller() const { return this->controller_; }
 
-  void clear_effect_data() override {
-    for (int i = 0; i < this->size(); i++)
-      this->effect_data_[i] = 0;
-  }
-
   /// Add some LEDS, can only be called once.
   void add_leds(uint16_t count_pixels, uint8_t pin) {
     this->add_leds(new NeoPixelBus<T_COLOR_FEATURE, T_METHOD>(count_pixels, pin));
@@ -71,19 +66,17 @@ class NeoPixelBusLightOutputBase : public light::AddressableLight {
   }
 
   // ========== INTERNAL METHODS ==========
-  void setup() override {
-    for (int i = 0; i < this->size(); i++) {
-      (*this)[i] = light::ESPColor(0, 0, 0, 0);
-    }
-
-    this->effect_data_ = new uint8_t[this->size()];
-    this->controller_->Begin();
-  }
+  void setup() override { this->controller_->Begin(); }
 
   void loop() override {
     if (!this->should_show_())
       return;
 
+    // The DMA, RMT and async UART methods send the previous frame in the background and Show() would wait for that.
+    // Don't block the loop, show the frame once they're done; effects don't render new frames until then.
+    if (!this->controller_->CanShow())
+      return;
+
     this->mark_shown_();
     this->controller_->Dirty();
 
@@ -104,7 +97,6 @@ class NeoPixelBusLightOutputBase : public light::AddressableLight {
 
  protected:
   NeoPixelBus<T_COLOR_FEATURE, T_METHOD> *controller_{nullptr};
-  uint8_t *effect_data_{nullptr};
   uint8_t rgb_offsets_[4]{0, 1, 2, 3};
 };
 
@@ -119,11 +111,7 @@ class NeoPixelRGBLightOutput : public NeoPixelBusLightOutputBase<T_METHOD, T_COL
   }
 
  protected:
-  light::ESPColorView get_view_internal(int32_t index) const override {  // NOLINT
-    uint8_t *base = this->controller_->Pixels() + 3ULL * index;
-    return light::ESPColorView(base + this->rgb_offsets_[0], base + this->rgb_offsets_[1], base + this->rgb_offsets_[2],
-                               nullptr, this->effect_data_ + index, &this->correction_);
-  }
+  void write_frame_internal() override { this->write_frame_(this->controller_->Pixels(), 3, this->rgb_offsets_); }
 };
 
 template<typename T_METHOD, typename T_COLOR_FEATURE = NeoRgbwFeature>
@@ -138,11 +126,7 @@ class NeoPixelRGBWLightOutput : public NeoPixelBusLightOutputBase<T_METHOD, T_CO
   }
 
  protected:
-  light::ESPColorView get_view_internal(int32_t index) const override {  // NOLINT
-    uint8_t *base = this->controller_->Pixels() + 4ULL * index;
-    return light::ESPColorView(base + this->rgb_offsets_[0], base + this->rgb_offsets_[1], base + this->rgb_offsets_[2],
-                               base + this->rgb_offsets_[3], this->effect_data_ + index, &this->correction_);
-  }
+  void write_frame_internal() override { this->write_frame_(this->controller_->Pixels(), 4, this->rgb_offsets_); }
 };
 
 }  // namespace neopixelbus
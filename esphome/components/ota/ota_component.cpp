@@ -48,6 +48,11 @@ void OTAComponent::loop() {
   }
 }
 
+uint32_t OTAComponent::next_wake_in() {
+  // New connections wait in the listen backlog until accepted, checking for them once a second is enough
+  return 1000;
+}
+
 void OTAComponent::handle_() {
   OTAResponseTypes error_code = OTA_RESPONSE_ERROR_UNKNOWN;
   bool update_started = false;
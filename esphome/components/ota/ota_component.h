@@ -55,6 +55,7 @@ class OTAComponent : public Component {
   void dump_config() override;
   float get_setup_priority() const override;
   void loop() override;
+  uint32_t next_wake_in() override;
 
   uint16_t get_port() const;
 
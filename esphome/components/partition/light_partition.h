@@ -37,11 +37,6 @@ class PartitionLightOutput : public light::AddressableLight {
     auto &last_seg = this->segments_[this->segments_.size() - 1];
     return last_seg.get_dst_offset() + last_seg.get_size();
   }
-  void clear_effect_data() override {
-    for (auto &seg : this->segments_) {
-      seg.get_src()->clear_effect_data();
-    }
-  }
   light::LightTraits get_traits() override { return this->segments_[0].get_src()->get_traits(); }
   void loop() override {
     if (this->should_show_()) {
@@ -53,29 +48,14 @@ class PartitionLightOutput : public light::AddressableLight {
   }
 
  protected:
-  light::ESPColorView get_view_internal(int32_t index) const override {
-    uint32_t lo = 0;
-    uint32_t hi = this->segments_.size() - 1;
-    while (lo < hi) {
-      uint32_t mid = (lo + hi) / 2;
-      int32_t begin = this->segments_[mid].get_dst_offset();
-      int32_t end = begin + this->segments_[mid].get_size();
-      if (index < begin) {
-        hi = mid - 1;
-      } else if (index >= end) {
-        lo = mid + 1;
-      } else {
-        lo = hi = mid;
-      }
+  void write_frame_internal() override {
+    for (auto &seg : this->segments_) {
+      const light::ESPColor *begin = this->frame_ + seg.get_dst_offset();
+      std::copy(begin, begin + seg.get_size(), seg.get_src()->get_frame_buffer() + seg.get_src_offset());
+      // the source shows the LEDs we wrote with our brightness and gamma, until it renders a frame itself
+      seg.get_src()->set_range_correction(seg.get_src_offset(), seg.get_src_offset() + seg.get_size(),
+                                          &this->correction_);
     }
-    auto &seg = this->segments_[lo];
-    // offset within the segment
-    int32_t seg_off = index - seg.get_dst_offset();
-    // offset within the src
-    int32_t src_off = seg.get_src_offset() + seg_off;
-    auto view = (*seg.get_src())[src_off];
-    view.raw_set_color_correction(&this->correction_);
-    return view;
   }
 
   std::vector<AddressableSegment> segments_;
@@ -64,15 +64,13 @@ size_t PCD8544::get_buffer_length_() {
 }
 
 void HOT PCD8544::display() {
-  uint8_t col, maxcol, p;
+  for (uint8_t p = 0; p < 6; p++) {
+    int col, maxcol;
+    if (!this->get_dirty_span_(p, &col, &maxcol))
+      continue;
 
-  for (p = 0; p < 6; p++) {
     this->command(this->PCD8544_SETYADDR | p);
-
-    // start at the beginning of the row
-    col = 0;
-    maxcol = this->get_width_internal() - 1;
-
+    // start at the first changed column of the row
     this->command(this->PCD8544_SETXADDR | col);
 
     this->start_data_();
@@ -83,6 +81,7 @@ void HOT PCD8544::display() {
   }
 
   this->command(this->PCD8544_SETYADDR);
+  this->clear_dirty_();
 }
 
 void HOT PCD8544::draw_absolute_pixel_internal(int x, int y, int color) {
@@ -118,9 +117,10 @@ void PCD8544::update() {
 }
 
 void PCD8544::fill(int color) {
-  uint8_t fill = color ? 0xFF : 0x00;
+  uint8_t fill = this->native_color_(color) ? 0xFF : 0x00;
   for (uint32_t i = 0; i < this->get_buffer_length_(); i++)
     this->buffer_[i] = fill;
+  this->mark_dirty_(0, 0, this->get_width_internal() - 1, this->get_height_internal() - 1);
 }
 
 }  // namespace pcd8544
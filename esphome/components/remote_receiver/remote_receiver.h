@@ -31,6 +31,9 @@ class RemoteReceiverComponent : public remote_base::RemoteReceiverBase, public C
   void setup() override;
   void dump_config() override;
   void loop() override;
+#ifdef ARDUINO_ARCH_ESP8266
+  uint32_t next_wake_in() override;
+#endif
   float get_setup_priority() const override { return setup_priority::DATA; }
 
   void set_buffer_size(uint32_t buffer_size) { this->buffer_size_ = buffer_size; }
@@ -1,6 +1,7 @@
 #include "remote_receiver.h"
 #include "esphome/core/log.h"
 #include "esphome/core/helpers.h"
+#include "esphome/core/application.h"
 
 #ifdef ARDUINO_ARCH_ESP8266
 
@@ -26,7 +27,11 @@ void ICACHE_RAM_ATTR HOT RemoteReceiverComponentStore::gpio_intr(RemoteReceiverC
   if (time_since_change <= arg->filter_us)
     return;
 
+  // Wake up a tickless main loop on the first edge of a new signal, loop() then sleeps until the signal is done
+  const uint32_t dist = (arg->buffer_size + arg->buffer_write_at - arg->buffer_read_at) % arg->buffer_size;
   arg->buffer[arg->buffer_write_at = next] = now;
+  if (dist <= 1)
+    App.wake_loop();
 }
 
 void RemoteReceiverComponent::setup() {
@@ -37,7 +42,9 @@ void RemoteReceiverComponent::setup() {
   s.pin = this->pin_->to_isr();
   s.buffer_size = this->buffer_size_;
 
-  this->high_freq_.start();
+  // A tickless main loop is woken up by the interrupt instead, see next_wake_in()
+  if (!App.is_tickless())
+    this->high_freq_.start();
   if (s.buffer_size % 2 != 0) {
     // Make sure divisible by two. This way, we know that every 0bxxx0 index is a space and every 0bxxx1 index is a mark
     s.buffer_size++;
@@ -68,6 +75,19 @@ void RemoteReceiverComponent::dump_config() {
   ESP_LOGCONFIG(TAG, "  Signal is done after %u us of no changes", this->idle_us_);
 }
 
+uint32_t RemoteReceiverComponent::next_wake_in() {
+  auto &s = this->store_;
+  const uint32_t write_at = s.buffer_write_at;
+  const uint32_t dist = (s.buffer_size + write_at - s.buffer_read_at) % s.buffer_size;
+  if (dist <= 1)
+    // Nothing received, the interrupt wakes us up.
+    return UINT32_MAX;
+  const uint32_t since_change = micros() - s.buffer[write_at];
+  if (since_change >= this->idle_us_)
+    return 0;
+  return (this->idle_us_ - since_change + 999) / 1000;
+}
+
 void RemoteReceiverComponent::loop() {
   auto &s = this->store_;
 
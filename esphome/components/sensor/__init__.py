@@ -8,7 +8,7 @@ from esphome.const import CONF_ABOVE, CONF_ACCURACY_DECIMALS, CONF_ALPHA, CONF_B
     CONF_EXPIRE_AFTER, CONF_FILTERS, CONF_FROM, CONF_ICON, CONF_ID, CONF_INTERNAL, \
     CONF_ON_RAW_VALUE, CONF_ON_VALUE, CONF_ON_VALUE_RANGE, CONF_SEND_EVERY, CONF_SEND_FIRST_AT, \
     CONF_TO, CONF_TRIGGER_ID, CONF_UNIT_OF_MEASUREMENT, CONF_WINDOW_SIZE, CONF_NAME, CONF_MQTT_ID, \
-    CONF_FORCE_UPDATE
+    CONF_FORCE_UPDATE, CONF_QUANTILE, CONF_TYPE_ID
 from esphome.core import CORE, coroutine, coroutine_with_priority
 from esphome.util import Registry
 
@@ -26,6 +26,17 @@ def validate_send_first_at(value):
 
 FILTER_REGISTRY = Registry()
 validate_filters = cv.validate_registry('filter', FILTER_REGISTRY)
+# Stateless filters that can be fused with adjacent ones, maps the filter name to a coroutine that
+# returns the C++ statements applying the filter to the float variable x.
+FUSED_FILTERS = {}
+
+
+def register_fused_filter(name):
+    def decorator(fun):
+        FUSED_FILTERS[name] = coroutine(fun)
+        return fun
+
+    return decorator
 
 
 def validate_datapoint(value):
@@ -60,7 +71,11 @@ SensorPublishAction = sensor_ns.class_('SensorPublishAction', automation.Action)
 
 # Filters
 Filter = sensor_ns.class_('Filter')
+make_fused_filter = sensor_ns.make_fused_filter
 MedianFilter = sensor_ns.class_('MedianFilter', Filter)
+QuantileFilter = sensor_ns.class_('QuantileFilter', Filter)
+SlidingWindowMaxFilter = sensor_ns.class_('SlidingWindowMaxFilter', Filter)
+SlidingWindowMinFilter = sensor_ns.class_('SlidingWindowMinFilter', Filter)
 SlidingWindowMovingAverageFilter = sensor_ns.class_('SlidingWindowMovingAverageFilter', Filter)
 ExponentialMovingAverageFilter = sensor_ns.class_('ExponentialMovingAverageFilter', Filter)
 LambdaFilter = sensor_ns.class_('LambdaFilter', Filter)
@@ -118,18 +133,28 @@ def offset_filter_to_code(config, filter_id):
     yield cg.new_Pvariable(filter_id, config)
 
 
+@register_fused_filter('offset')
+def offset_filter_to_fused_code(config):
+    yield f'x = x + {cg.safe_exp(config)};'
+
+
 @FILTER_REGISTRY.register('multiply', MultiplyFilter, cv.float_)
 def multiply_filter_to_code(config, filter_id):
     yield cg.new_Pvariable(filter_id, config)
 
 
+@register_fused_filter('multiply')
+def multiply_filter_to_fused_code(config):
+    yield f'x = x * {cg.safe_exp(config)};'
+
+
 @FILTER_REGISTRY.register('filter_out', FilterOutValueFilter, cv.float_)
 def filter_out_filter_to_code(config, filter_id):
     yield cg.new_Pvariable(filter_id, config)
 
 
 MEDIAN_SCHEMA = cv.All(cv.Schema({
-    cv.Optional(CONF_WINDOW_SIZE, default=5): cv.positive_not_null_int,
+    cv.Optional(CONF_WINDOW_SIZE, default=5): cv.int_range(min=1, max=65534),
     cv.Optional(CONF_SEND_EVERY, default=5): cv.positive_not_null_int,
     cv.Optional(CONF_SEND_FIRST_AT, default=1): cv.positive_not_null_int,
 }), validate_send_first_at)
@@ -141,6 +166,39 @@ def median_filter_to_code(config, filter_id):
                            config[CONF_SEND_FIRST_AT])
 
 
+QUANTILE_SCHEMA = cv.All(cv.Schema({
+    cv.Optional(CONF_WINDOW_SIZE, default=5): cv.int_range(min=1, max=65534),
+    cv.Optional(CONF_SEND_EVERY, default=5): cv.positive_not_null_int,
+    cv.Optional(CONF_SEND_FIRST_AT, default=1): cv.positive_not_null_int,
+    cv.Optional(CONF_QUANTILE, default=0.9): cv.percentage,
+}), validate_send_first_at)
+
+
+@FILTER_REGISTRY.register('quantile', QuantileFilter, QUANTILE_SCHEMA)
+def quantile_filter_to_code(config, filter_id):
+    yield cg.new_Pvariable(filter_id, config[CONF_WINDOW_SIZE], config[CONF_SEND_EVERY],
+                           config[CONF_SEND_FIRST_AT], config[CONF_QUANTILE])
+
+
+SLIDING_MIN_MAX_SCHEMA = cv.All(cv.Schema({
+    cv.Optional(CONF_WINDOW_SIZE, default=5): cv.positive_not_null_int,
+    cv.Optional(CONF_SEND_EVERY, default=5): cv.positive_not_null_int,
+    cv.Optional(CONF_SEND_FIRST_AT, default=1): cv.positive_not_null_int,
+}), validate_send_first_at)
+
+
+@FILTER_REGISTRY.register('sliding_window_max', SlidingWindowMaxFilter, SLIDING_MIN_MAX_SCHEMA)
+def sliding_window_max_filter_to_code(config, filter_id):
+    yield cg.new_Pvariable(filter_id, config[CONF_WINDOW_SIZE], config[CONF_SEND_EVERY],
+                           config[CONF_SEND_FIRST_AT])
+
+
+@FILTER_REGISTRY.register('sliding_window_min', SlidingWindowMinFilter, SLIDING_MIN_MAX_SCHEMA)
+def sliding_window_min_filter_to_code(config, filter_id):
+    yield cg.new_Pvariable(filter_id, config[CONF_WINDOW_SIZE], config[CONF_SEND_EVERY],
+                           config[CONF_SEND_FIRST_AT])
+
+
 SLIDING_AVERAGE_SCHEMA = cv.All(cv.Schema({
     cv.Optional(CONF_WINDOW_SIZE, default=15): cv.positive_not_null_int,
     cv.Optional(CONF_SEND_EVERY, default=15): cv.positive_not_null_int,
@@ -170,6 +228,14 @@ def lambda_filter_to_code(config, filter_id):
     yield cg.new_Pvariable(filter_id, lambda_)
 
 
+@register_fused_filter('lambda')
+def lambda_filter_to_fused_code(config):
+    lambda_ = yield cg.process_lambda(config, [(float, 'x')],
+                                      return_type=cg.optional.template(float))
+    yield f'{{\n  optional<float> result = ({lambda_})(x);\n  if (!result.has_value())\n' \
+          f'    return {{}};\n  x = *result;\n}}'
+
+
 @FILTER_REGISTRY.register('delta', DeltaFilter, cv.float_)
 def delta_filter_to_code(config, filter_id):
     yield cg.new_Pvariable(filter_id, config)
@@ -216,6 +282,14 @@ def calibrate_linear_filter_to_code(config, filter_id):
     yield cg.new_Pvariable(filter_id, k, b)
 
 
+@register_fused_filter('calibrate_linear')
+def calibrate_linear_filter_to_fused_code(config):
+    x = [conf[CONF_FROM] for conf in config]
+    y = [conf[CONF_TO] for conf in config]
+    k, b = fit_linear(x, y)
+    yield f'x = x * {cg.safe_exp(k)} + {cg.safe_exp(b)};'
+
+
 CONF_DATAPOINTS = 'datapoints'
 CONF_DEGREE = 'degree'
 
@@ -242,9 +316,48 @@ def calibrate_polynomial_filter_to_code(config, filter_id):
     yield cg.new_Pvariable(filter_id, res)
 
 
+def is_fusable_filter(full_config):
+    registry_entry, _ = cg.extract_registry_entry_config(FILTER_REGISTRY, full_config)
+    # keep filters with a manually assigned ID, they may be referenced from lambdas
+    return registry_entry.name in FUSED_FILTERS and not full_config[CONF_TYPE_ID].is_manual
+
+
+@coroutine
+def build_fused_filter(configs):
+    body = []
+    for full_config in configs:
+        registry_entry, config = cg.extract_registry_entry_config(FILTER_REGISTRY, full_config)
+        statement = yield FUSED_FILTERS[registry_entry.name](config)
+        body.append(statement)
+    body.append('return x;')
+    lambda_ = cg.LambdaExpression('\n'.join(body), [(float, 'x')], capture='=',
+                                  return_type=cg.optional.template(float))
+    # the fused filter takes over the ID of the first filter in the run
+    yield cg.Pvariable(configs[0][CONF_TYPE_ID], make_fused_filter(lambda_), type=Filter)
+
+
 @coroutine
 def build_filters(config):
-    yield cg.build_registry_list(FILTER_REGISTRY, config)
+    # Runs of adjacent stateless filters are fused into one filter, so that values go through
+    # one inlined function instead of a virtual call per filter.
+    filters = []
+    run = []
+    for full_config in config + [None]:
+        if full_config is not None and is_fusable_filter(full_config):
+            run.append(full_config)
+            continue
+        if len(run) >= 2:
+            filter_ = yield build_fused_filter(run)
+            filters.append(filter_)
+        else:
+            for run_config in run:
+                filter_ = yield cg.build_registry_entry(FILTER_REGISTRY, run_config)
+                filters.append(filter_)
+        run = []
+        if full_config is not None:
+            filter_ = yield cg.build_registry_entry(FILTER_REGISTRY, full_config)
+            filters.append(filter_)
+    yield filters
 
 
 @coroutine
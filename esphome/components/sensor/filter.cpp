@@ -39,17 +39,170 @@ uint32_t Filter::calculate_remaining_interval(uint32_t input) {
   }
 }
 
+// SortedWindow
+SortedWindow::SortedWindow(size_t capacity) : history_(std::min<size_t>(capacity, NIL - 1)) { this->allocate_(); }
+SortedWindow::~SortedWindow() { this->release_(); }
+void SortedWindow::allocate_() {
+  const size_t capacity = this->capacity();
+  this->levels_ = 1;
+  while (this->levels_ < MAX_LEVELS && (size_t(1) << this->levels_) <= capacity)
+    this->levels_++;
+
+  this->values_ = new float[capacity];
+  this->link_offsets_ = new uint32_t[capacity + 1];
+  // the head node's links come first
+  uint32_t links = this->levels_;
+  this->link_offsets_[this->head_()] = 0;
+  for (uint16_t node = 0; node < capacity; node++) {
+    this->link_offsets_[node] = links;
+    links += this->node_levels_(node);
+  }
+  this->next_ = new uint16_t[links];
+  this->width_ = new uint16_t[links];
+
+  for (uint8_t level = 0; level < this->levels_; level++) {
+    this->next_[this->link_(this->head_(), level)] = NIL;
+    this->width_[this->link_(this->head_(), level)] = 1;
+  }
+  for (uint16_t node = 0; node < this->size(); node++)
+    this->insert_(node, this->history_[node]);
+}
+void SortedWindow::release_() {
+  delete[] this->values_;
+  delete[] this->link_offsets_;
+  delete[] this->next_;
+  delete[] this->width_;
+}
+void SortedWindow::clear() {
+  this->history_.clear();
+  for (uint8_t level = 0; level < this->levels_; level++) {
+    this->next_[this->link_(this->head_(), level)] = NIL;
+    this->width_[this->link_(this->head_(), level)] = 1;
+  }
+}
+void SortedWindow::set_capacity(size_t capacity) {
+  capacity = std::max<size_t>(1, std::min<size_t>(capacity, NIL - 1));
+  if (capacity == this->capacity())
+    return;
+  this->release_();
+  this->history_.set_capacity(capacity);
+  this->allocate_();
+}
+uint8_t SortedWindow::node_levels_(uint16_t node) const {
+  if (node == this->head_())
+    return this->levels_;
+  // every second node has 2 levels, every fourth 3 and so on; nodes are reused in effectively random order, so
+  // this gives the same expected complexity as random levels
+  const uint8_t levels = 1 + __builtin_ctz(node + 1u);
+  return std::min(levels, this->levels_);
+}
+void SortedWindow::push(float value) {
+  uint16_t node;
+  if (this->history_.full()) {
+    node = this->remove_(this->history_.front());
+  } else {
+    // values are only evicted once the window is full, so exactly the first size() nodes are in use
+    node = this->size();
+  }
+  this->history_.push(value);
+  this->insert_(node, value);
+}
+void SortedWindow::insert_(uint16_t node, float value) {
+  uint16_t chain[MAX_LEVELS];
+  uint16_t steps_at_level[MAX_LEVELS];
+  uint16_t prev = this->head_();
+  for (int level = this->levels_ - 1; level >= 0; level--) {
+    steps_at_level[level] = 0;
+    while (true) {
+      const uint32_t link = this->link_(prev, level);
+      const uint16_t next = this->next_[link];
+      if (next == NIL || this->values_[next] > value)
+        break;
+      steps_at_level[level] += this->width_[link];
+      prev = next;
+    }
+    chain[level] = prev;
+  }
+
+  this->values_[node] = value;
+  const uint8_t node_levels = this->node_levels_(node);
+  uint16_t steps = 0;
+  for (uint8_t level = 0; level < node_levels; level++) {
+    const uint32_t prev_link = this->link_(chain[level], level);
+    const uint32_t link = this->link_(node, level);
+    this->next_[link] = this->next_[prev_link];
+    this->next_[prev_link] = node;
+    this->width_[link] = this->width_[prev_link] - steps;
+    this->width_[prev_link] = steps + 1;
+    steps += steps_at_level[level];
+  }
+  for (uint8_t level = node_levels; level < this->levels_; level++)
+    this->width_[this->link_(chain[level], level)]++;
+}
+uint16_t SortedWindow::remove_(float value) {
+  uint16_t chain[MAX_LEVELS] = {};
+  uint16_t prev = this->head_();
+  for (int level = this->levels_ - 1; level >= 0; level--) {
+    while (true) {
+      const uint16_t next = this->next_[this->link_(prev, level)];
+      if (next == NIL || !(this->values_[next] < value))
+        break;
+      prev = next;
+    }
+    chain[level] = prev;
+  }
+
+  // the first node with this value, not necessarily the one that was inserted first, but that doesn't matter
+  const uint16_t node = this->next_[this->link_(chain[0], 0)];
+  const uint8_t node_levels = this->node_levels_(node);
+  for (uint8_t level = 0; level < node_levels; level++) {
+    const uint32_t prev_link = this->link_(chain[level], level);
+    const uint32_t link = this->link_(node, level);
+    this->width_[prev_link] += this->width_[link] - 1;
+    this->next_[prev_link] = this->next_[link];
+  }
+  for (uint8_t level = node_levels; level < this->levels_; level++)
+    this->width_[this->link_(chain[level], level)]--;
+  return node;
+}
+float SortedWindow::at(size_t rank) const {
+  uint16_t node = this->head_();
+  size_t remaining = rank + 1;
+  for (int level = this->levels_ - 1; level >= 0; level--) {
+    while (true) {
+      const uint32_t link = this->link_(node, level);
+      if (this->width_[link] > remaining)
+        break;
+      remaining -= this->width_[link];
+      node = this->next_[link];
+    }
+  }
+  return this->values_[node];
+}
+float SortedWindow::median() const {
+  const size_t size = this->size();
+  if (size % 2)
+    return this->at(size / 2);
+  return (this->at(size / 2) + this->at((size / 2) - 1)) / 2.0f;
+}
+float SortedWindow::quantile(float q) const {
+  const float pos = q * (this->size() - 1);
+  const size_t rank = pos;
+  const float value = this->at(rank);
+  const float fraction = pos - rank;
+  if (fraction <= 0.0f || rank + 1 >= this->size())
+    return value;
+  return value + (this->at(rank + 1) - value) * fraction;
+}
+
 // MedianFilter
 MedianFilter::MedianFilter(size_t window_size, size_t send_every, size_t send_first_at)
-    : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size) {}
+    : window_(window_size), send_every_(send_every), send_at_(send_every - send_first_at) {}
 void MedianFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
-void MedianFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
+void MedianFilter::set_window_size(size_t window_size) { this->window_.set_capacity(window_size); }
 optional<float> MedianFilter::new_value(float value) {
   if (!isnan(value)) {
-    while (this->queue_.size() >= this->window_size_) {
-      this->queue_.pop_front();
-    }
-    this->queue_.push_back(value);
+    this->window_.push(value);
     ESP_LOGVV(TAG, "MedianFilter(%p)::new_value(%f)", this, value);
   }
 
@@ -57,17 +210,8 @@ optional<float> MedianFilter::new_value(float value) {
     this->send_at_ = 0;
 
     float median = 0.0f;
-    if (!this->queue_.empty()) {
-      std::deque<float> median_queue = this->queue_;
-      sort(median_queue.begin(), median_queue.end());
-
-      size_t queue_size = median_queue.size();
-      if (queue_size % 2) {
-        median = median_queue[queue_size / 2];
-      } else {
-        median = (median_queue[queue_size / 2] + median_queue[(queue_size / 2) - 1]) / 2.0f;
-      }
-    }
+    if (!this->window_.empty())
+      median = this->window_.median();
 
     ESP_LOGVV(TAG, "MedianFilter(%p)::new_value(%f) SENDING", this, median);
     return median;
@@ -77,20 +221,136 @@ optional<float> MedianFilter::new_value(float value) {
 
 uint32_t MedianFilter::expected_interval(uint32_t input) { return input * this->send_every_; }
 
+// QuantileFilter
+QuantileFilter::QuantileFilter(size_t window_size, size_t send_every, size_t send_first_at, float quantile)
+    : window_(window_size), send_every_(send_every), send_at_(send_every - send_first_at), quantile_(quantile) {}
+void QuantileFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
+void QuantileFilter::set_window_size(size_t window_size) { this->window_.set_capacity(window_size); }
+void QuantileFilter::set_quantile(float quantile) { this->quantile_ = quantile; }
+optional<float> QuantileFilter::new_value(float value) {
+  if (!isnan(value)) {
+    this->window_.push(value);
+    ESP_LOGVV(TAG, "QuantileFilter(%p)::new_value(%f)", this, value);
+  }
+
+  if (++this->send_at_ >= this->send_every_) {
+    this->send_at_ = 0;
+
+    float result = 0.0f;
+    if (!this->window_.empty())
+      result = this->window_.quantile(this->quantile_);
+
+    ESP_LOGVV(TAG, "QuantileFilter(%p)::new_value(%f) SENDING", this, result);
+    return result;
+  }
+  return {};
+}
+
+uint32_t QuantileFilter::expected_interval(uint32_t input) { return input * this->send_every_; }
+
+// MonotonicWindow
+MonotonicWindow::MonotonicWindow(size_t window_size, bool max) : candidates_(window_size), max_(max) {}
+void MonotonicWindow::set_window_size(size_t window_size) {
+  // drop candidates that are outside of the new window, set_capacity() keeps the newest ones
+  while (!this->candidates_.empty() && this->count_ - this->candidates_.front().index >= window_size)
+    this->candidates_.pop_front();
+  this->candidates_.set_capacity(window_size);
+}
+void MonotonicWindow::push(float value) {
+  this->count_++;
+  if (!this->candidates_.empty() && this->count_ - this->candidates_.front().index >= this->candidates_.capacity())
+    this->candidates_.pop_front();
+  while (!this->candidates_.empty()) {
+    const float back = this->candidates_.back().value;
+    if (this->max_ ? back > value : back < value)
+      break;
+    this->candidates_.pop_back();
+  }
+  this->candidates_.push(Candidate{value, this->count_});
+}
+
+// SlidingWindowMaxFilter
+SlidingWindowMaxFilter::SlidingWindowMaxFilter(size_t window_size, size_t send_every, size_t send_first_at)
+    : window_(window_size, true), send_every_(send_every), send_at_(send_every - send_first_at) {}
+void SlidingWindowMaxFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
+void SlidingWindowMaxFilter::set_window_size(size_t window_size) { this->window_.set_window_size(window_size); }
+optional<float> SlidingWindowMaxFilter::new_value(float value) {
+  if (!isnan(value)) {
+    this->window_.push(value);
+    ESP_LOGVV(TAG, "SlidingWindowMaxFilter(%p)::new_value(%f)", this, value);
+  }
+
+  if (++this->send_at_ >= this->send_every_) {
+    this->send_at_ = 0;
+
+    float result = 0.0f;
+    if (!this->window_.empty())
+      result = this->window_.get();
+
+    ESP_LOGVV(TAG, "SlidingWindowMaxFilter(%p)::new_value(%f) SENDING", this, result);
+    return result;
+  }
+  return {};
+}
+
+uint32_t SlidingWindowMaxFilter::expected_interval(uint32_t input) { return input * this->send_every_; }
+
+// SlidingWindowMinFilter
+SlidingWindowMinFilter::SlidingWindowMinFilter(size_t window_size, size_t send_every, size_t send_first_at)
+    : window_(window_size, false), send_every_(send_every), send_at_(send_every - send_first_at) {}
+void SlidingWindowMinFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
+void SlidingWindowMinFilter::set_window_size(size_t window_size) { this->window_.set_window_size(window_size); }
+optional<float> SlidingWindowMinFilter::new_value(float value) {
+  if (!isnan(value)) {
+    this->window_.push(value);
+    ESP_LOGVV(TAG, "SlidingWindowMinFilter(%p)::new_value(%f)", this, value);
+  }
+
+  if (++this->send_at_ >= this->send_every_) {
+    this->send_at_ = 0;
+
+    float result = 0.0f;
+    if (!this->window_.empty())
+      result = this->window_.get();
+
+    ESP_LOGVV(TAG, "SlidingWindowMinFilter(%p)::new_value(%f) SENDING", this, result);
+    return result;
+  }
+  return {};
+}
+
+uint32_t SlidingWindowMinFilter::expected_interval(uint32_t input) { return input * this->send_every_; }
+
 // SlidingWindowMovingAverageFilter
 SlidingWindowMovingAverageFilter::SlidingWindowMovingAverageFilter(size_t window_size, size_t send_every,
                                                                    size_t send_first_at)
-    : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size) {}
+    : queue_(window_size), send_every_(send_every), send_at_(send_every - send_first_at) {}
 void SlidingWindowMovingAverageFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
-void SlidingWindowMovingAverageFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
+void SlidingWindowMovingAverageFilter::set_window_size(size_t window_size) {
+  this->queue_.set_capacity(window_size);
+  // a smaller window drops the oldest values, and the average must be right even if the next value is NaN
+  this->recompute_sum_();
+}
+void SlidingWindowMovingAverageFilter::recompute_sum_() {
+  this->evicted_ = 0;
+  this->sum_ = 0.0f;
+  for (size_t i = 0; i < this->queue_.size(); i++)
+    this->sum_ += this->queue_[i];
+}
 optional<float> SlidingWindowMovingAverageFilter::new_value(float value) {
   if (!isnan(value)) {
-    if (this->queue_.size() == this->window_size_) {
+    if (this->queue_.full()) {
       this->sum_ -= this->queue_.front();
-      this->queue_.pop();
+      this->evicted_++;
     }
     this->queue_.push(value);
-    this->sum_ += value;
+    if (this->evicted_ >= this->queue_.capacity()) {
+      // Adding and subtracting accumulates rounding errors, so recompute the sum from scratch once per window,
+      // this costs one extra add per value on average.
+      this->recompute_sum_();
+    } else {
+      this->sum_ += value;
+    }
   }
   float average;
   if (this->queue_.empty())
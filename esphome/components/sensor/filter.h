@@ -1,6 +1,5 @@
 #pragma once
 
-#include <queue>
 #include "esphome/core/component.h"
 #include "esphome/core/helpers.h"
 
@@ -46,9 +45,141 @@ class Filter {
   Sensor *parent_{nullptr};
 };
 
+/** Fixed-capacity FIFO of the last values of a sensor, for windowed filters.
+ *
+ * The storage is allocated once (at construction or by set_capacity()), pushing into a full buffer overwrites the
+ * oldest value. So memory use is deterministic and a push is just a couple of loads and stores.
+ */
+template<typename T> class RingBuffer {
+ public:
+  RingBuffer() = default;
+  explicit RingBuffer(size_t capacity) { this->set_capacity(capacity); }
+  ~RingBuffer() { delete[] this->data_; }
+  RingBuffer(const RingBuffer &) = delete;
+  RingBuffer &operator=(const RingBuffer &) = delete;
+
+  /// Append a value, overwriting the oldest value if the buffer is full.
+  void push(const T &value) {
+    if (this->full()) {
+      this->data_[this->head_] = value;
+      if (++this->head_ == this->capacity_)
+        this->head_ = 0;
+    } else {
+      this->data_[this->index_(this->size_)] = value;
+      this->size_++;
+    }
+  }
+  /// Remove the oldest value. The buffer must not be empty.
+  void pop_front() {
+    if (++this->head_ == this->capacity_)
+      this->head_ = 0;
+    this->size_--;
+  }
+  /// Remove the newest value. The buffer must not be empty.
+  void pop_back() { this->size_--; }
+  /// The oldest value. The buffer must not be empty.
+  const T &front() const { return this->data_[this->head_]; }
+  /// The newest value. The buffer must not be empty.
+  const T &back() const { return this->data_[this->index_(this->size_ - 1)]; }
+  /// The i-th oldest value, i must be less than size().
+  const T &operator[](size_t i) const { return this->data_[this->index_(i)]; }
+
+  /// Change the capacity (at least 1), keeping the newest values. This reallocates the storage.
+  void set_capacity(size_t capacity) {
+    capacity = std::max<size_t>(capacity, 1);
+    if (capacity == this->capacity_)
+      return;
+    T *data = new T[capacity];
+    const size_t keep = std::min(this->size_, capacity);
+    for (size_t i = 0; i < keep; i++)
+      data[i] = (*this)[this->size_ - keep + i];
+    delete[] this->data_;
+    this->data_ = data;
+    this->capacity_ = capacity;
+    this->head_ = 0;
+    this->size_ = keep;
+  }
+  void clear() {
+    this->head_ = 0;
+    this->size_ = 0;
+  }
+  size_t size() const { return this->size_; }
+  size_t capacity() const { return this->capacity_; }
+  bool empty() const { return this->size_ == 0; }
+  bool full() const { return this->size_ == this->capacity_; }
+
+ protected:
+  size_t index_(size_t i) const {
+    i += this->head_;
+    return i >= this->capacity_ ? i - this->capacity_ : i;
+  }
+
+  T *data_{nullptr};
+  size_t capacity_{0};
+  /// Index of the oldest value.
+  size_t head_{0};
+  size_t size_{0};
+};
+
+/** The last <capacity> values of a sensor, ordered by value so that the value at any rank can be looked up.
+ *
+ * Implemented as an indexable skip list, so adding a value (and evicting the oldest one) and looking up a rank
+ * are O(log n). All nodes are allocated up front and the node of the evicted value is reused for the new one, so
+ * push() never allocates. The capacity is limited to 65534 values.
+ */
+class SortedWindow {
+ public:
+  explicit SortedWindow(size_t capacity);
+  ~SortedWindow();
+  SortedWindow(const SortedWindow &) = delete;
+  SortedWindow &operator=(const SortedWindow &) = delete;
+
+  /// Add a value, evicting the oldest value if the window is full.
+  void push(float value);
+  /// Get the value with the given rank, 0 being the smallest value. rank must be less than size().
+  float at(size_t rank) const;
+  /// The median of the values, the mean of the two middle values if the size is even. The window must not be empty.
+  float median() const;
+  /// The quantile q (0 to 1) of the values, linearly interpolated between the closest ranks. Must not be empty.
+  float quantile(float q) const;
+
+  /// Change the capacity, keeping the newest values.
+  void set_capacity(size_t capacity);
+  void clear();
+  size_t size() const { return this->history_.size(); }
+  size_t capacity() const { return this->history_.capacity(); }
+  bool empty() const { return this->history_.empty(); }
+
+ protected:
+  static const uint8_t MAX_LEVELS = 16;
+  static const uint16_t NIL = 0xFFFF;
+
+  /// Allocate the skip list nodes for the capacity of history_ and link its values.
+  void allocate_();
+  void release_();
+  /// Link node into the skip list, in order after all equal values.
+  void insert_(uint16_t node, float value);
+  /// Unlink a node with the given value from the skip list and return it.
+  uint16_t remove_(float value);
+  uint8_t node_levels_(uint16_t node) const;
+  uint32_t link_(uint16_t node, uint8_t level) const { return this->link_offsets_[node] + level; }
+  uint16_t head_() const { return this->history_.capacity(); }
+
+  /// The values in insertion order, to know which one to evict.
+  RingBuffer<float> history_;
+  uint8_t levels_{1};
+  /// Value of each node, the head node (index capacity()) has no value.
+  float *values_{nullptr};
+  /// Offset of the links of each node in next_ and width_, a node at index i has node_levels_(i) links.
+  uint32_t *link_offsets_{nullptr};
+  uint16_t *next_{nullptr};
+  /// Number of level 0 steps that following the link skips.
+  uint16_t *width_{nullptr};
+};
+
 /** Simple median filter.
  *
- * Takes the median of the last <send_every> values and pushes it out every <send_every>.
+ * Takes the median of the last <window_size> values and pushes it out every <send_every>.
  */
 class MedianFilter : public Filter {
  public:
@@ -70,10 +201,127 @@ class MedianFilter : public Filter {
   uint32_t expected_interval(uint32_t input) override;
 
  protected:
-  std::deque<float> queue_;
+  SortedWindow window_;
+  size_t send_every_;
+  size_t send_at_;
+};
+
+/** Simple quantile filter.
+ *
+ * Takes the quantile (for example 0.9 for the 90th percentile) of the last <window_size> values and pushes it out
+ * every <send_every>.
+ */
+class QuantileFilter : public Filter {
+ public:
+  /** Construct a QuantileFilter.
+   *
+   * @param window_size The number of values that should be used in quantile calculation.
+   * @param send_every After how many sensor values should a new one be pushed out.
+   * @param send_first_at After how many values to forward the very first value. Must be less than or equal to
+   *   send_every.
+   * @param quantile The quantile to take, between 0 and 1.
+   */
+  explicit QuantileFilter(size_t window_size, size_t send_every, size_t send_first_at, float quantile);
+
+  optional<float> new_value(float value) override;
+
+  void set_send_every(size_t send_every);
+  void set_window_size(size_t window_size);
+  void set_quantile(float quantile);
+
+  uint32_t expected_interval(uint32_t input) override;
+
+ protected:
+  SortedWindow window_;
+  size_t send_every_;
+  size_t send_at_;
+  float quantile_;
+};
+
+/** Minimum or maximum of the last <window_size> values, in amortized O(1) per value.
+ *
+ * Only the values that can still become the extremum are kept, in a monotonic ring buffer: a new value removes all
+ * older values it dominates from the back, values that leave the window are removed from the front. Each value is
+ * added and removed at most once.
+ */
+class MonotonicWindow {
+ public:
+  MonotonicWindow(size_t window_size, bool max);
+
+  void push(float value);
+  /// The minimum or maximum of the values in the window. The window must not be empty.
+  float get() const { return this->candidates_.front().value; }
+  bool empty() const { return this->candidates_.empty(); }
+
+  void set_window_size(size_t window_size);
+
+ protected:
+  struct Candidate {
+    float value;
+    /// Number of values pushed before this one.
+    uint32_t index;
+  };
+
+  RingBuffer<Candidate> candidates_;
+  uint32_t count_{0};
+  bool max_;
+};
+
+/** Sliding window maximum filter.
+ *
+ * Takes the maximum of the last <window_size> values and pushes it out every <send_every>. With send_every 1 this is
+ * a peak hold for the duration of the window.
+ */
+class SlidingWindowMaxFilter : public Filter {
+ public:
+  /** Construct a SlidingWindowMaxFilter.
+   *
+   * @param window_size The number of values that should be used in the maximum calculation.
+   * @param send_every After how many sensor values should a new one be pushed out.
+   * @param send_first_at After how many values to forward the very first value. Must be less than or equal to
+   *   send_every.
+   */
+  explicit SlidingWindowMaxFilter(size_t window_size, size_t send_every, size_t send_first_at);
+
+  optional<float> new_value(float value) override;
+
+  void set_send_every(size_t send_every);
+  void set_window_size(size_t window_size);
+
+  uint32_t expected_interval(uint32_t input) override;
+
+ protected:
+  MonotonicWindow window_;
+  size_t send_every_;
+  size_t send_at_;
+};
+
+/** Sliding window minimum filter.
+ *
+ * Takes the minimum of the last <window_size> values and pushes it out every <send_every>.
+ */
+class SlidingWindowMinFilter : public Filter {
+ public:
+  /** Construct a SlidingWindowMinFilter.
+   *
+   * @param window_size The number of values that should be used in the minimum calculation.
+   * @param send_every After how many sensor values should a new one be pushed out.
+   * @param send_first_at After how many values to forward the very first value. Must be less than or equal to
+   *   send_every.
+   */
+  explicit SlidingWindowMinFilter(size_t window_size, size_t send_every, size_t send_first_at);
+
+  optional<float> new_value(float value) override;
+
+  void set_send_every(size_t send_every);
+  void set_window_size(size_t window_size);
+
+  uint32_t expected_interval(uint32_t input) override;
+
+ protected:
+  MonotonicWindow window_;
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
 };
 
 /** Simple sliding window moving average filter.
@@ -101,11 +349,14 @@ class SlidingWindowMovingAverageFilter : public Filter {
   uint32_t expected_interval(uint32_t input) override;
 
  protected:
+  void recompute_sum_();
+
   float sum_{0.0};
-  std::queue<float> queue_;
+  /// Number of values subtracted from sum_ since it was last recomputed from scratch.
+  size_t evicted_{0};
+  RingBuffer<float> queue_;
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
 };
 
 /** Simple exponential moving average filter.
@@ -154,6 +405,23 @@ class LambdaFilter : public Filter {
   lambda_filter_t lambda_filter_;
 };
 
+/** A run of adjacent stateless filters (offset, multiply, calibrate_linear, lambda) fused into a single filter.
+ *
+ * Generated by codegen so that a value goes through one inlined function instead of a virtual call, optional<float>
+ * and (for lambdas) std::function per filter.
+ */
+template<typename F> class FusedFilter : public Filter {
+ public:
+  explicit FusedFilter(F &&f) : f_(std::move(f)) {}
+
+  optional<float> new_value(float value) override { return this->f_(value); }
+
+ protected:
+  F f_;
+};
+
+template<typename F> Filter *make_fused_filter(F &&f) { return new FusedFilter<F>(std::move(f)); }
+
 /// A simple filter that adds `offset` to each value it receives.
 class OffsetFilter : public Filter {
  public:
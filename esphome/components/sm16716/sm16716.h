@@ -32,7 +32,7 @@ class SM16716 : public Component {
 
    protected:
     void write_state(float state) override {
-      auto amount = uint8_t(state * 0xFF);
+      auto amount = static_cast<uint8_t>(roundf(state * 0xFF));
       this->parent_->set_channel_value_(this->channel_, amount);
     }
 
@@ -107,30 +107,42 @@ void SSD1306::setup() {
   this->command(SSD1306_COMMAND_DISPLAY_ON);
 }
 void SSD1306::display() {
+  const int width = this->get_width_internal();
   if (this->is_sh1106_()) {
-    this->write_display_data();
+    // page addressing mode, each page is addressed separately
+    for (int page = 0; page < this->get_height_internal() / 8; page++) {
+      int x1, x2;
+      if (!this->get_dirty_span_(page, &x1, &x2))
+        continue;
+      // the SH1106 has 132 columns, the visible ones start at 2
+      const uint8_t column = x1 + 2;
+      this->command(0xB0 + page);           // row
+      this->command(column & 0x0F);         // lower column
+      this->command(0x10 | (column >> 4));  // higher column
+      this->write_display_data(this->buffer_ + page * width + x1, x2 - x1 + 1);
+    }
+    this->clear_dirty_();
     return;
   }
 
+  int x1, y1, x2, y2;
+  if (!this->get_dirty_region_(&x1, &y1, &x2, &y2))
+    return;
+
+  // Horizontal addressing mode wraps around within the column/page window, so the dirty region can be sent
+  // page by page without addressing each page.
+  const uint8_t column_offset = this->model_ == SSD1306_MODEL_64_48 ? 0x20 : 0x00;
   this->command(SSD1306_COMMAND_COLUMN_ADDRESS);
-  switch (this->model_) {
-    case SSD1306_MODEL_64_48:
-      this->command(0x20);
-      this->command(0x20 + this->get_width_internal() - 1);
-      break;
-    default:
-      this->command(0);  // Page start address, 0
-      this->command(this->get_width_internal() - 1);
-      break;
-  }
+  this->command(column_offset + x1);
+  this->command(column_offset + x2);
 
   this->command(SSD1306_COMMAND_PAGE_ADDRESS);
-  // Page start address, 0
-  this->command(0);
-  // Page end address:
-  this->command((this->get_height_internal() / 8) - 1);
+  this->command(y1 / 8);
+  this->command(y2 / 8);
 
-  this->write_display_data();
+  for (int page = y1 / 8; page <= y2 / 8; page++)
+    this->write_display_data(this->buffer_ + page * width + x1, x2 - x1 + 1);
+  this->clear_dirty_();
 }
 bool SSD1306::is_sh1106_() const {
   return this->model_ == SH1106_MODEL_96_16 || this->model_ == SH1106_MODEL_128_32 ||
@@ -191,10 +203,56 @@ void HOT SSD1306::draw_absolute_pixel_internal(int x, int y, int color) {
     this->buffer_[pos] &= ~(1 << subpos);
   }
 }
+void HOT SSD1306::fill_rect_internal(int x, int y, int width, int height, int color) {
+  // every byte is a column of 8 pixels in a page, so whole columns of a page can be set at once
+  const int y2 = y + height;
+  for (int page = y / 8; page * 8 < y2; page++) {
+    const int bit1 = std::max(y - page * 8, 0);
+    const int bit2 = std::min(y2 - page * 8, 8);
+    const uint8_t mask = ((1u << (bit2 - bit1)) - 1u) << bit1;
+    uint8_t *data = this->buffer_ + page * this->get_width_internal() + x;
+    if (color) {
+      for (int i = 0; i < width; i++)
+        data[i] |= mask;
+    } else {
+      for (int i = 0; i < width; i++)
+        data[i] &= ~mask;
+    }
+  }
+}
+void HOT SSD1306::blit_1bpp_internal(int x, int y, int width, int height, const uint8_t *data, int stride, int src_x,
+                                     int src_y, int color, bool opaque) {
+  const int buffer_width = this->get_width_internal();
+  for (int row = 0; row < height; row++) {
+    const uint8_t *src = data + (src_y + row) * stride + src_x / 8;
+    uint8_t *dst = this->buffer_ + ((y + row) / 8) * buffer_width + x;
+    const uint8_t mask = 1 << ((y + row) & 0x07);
+    // shift the source bits out of the top of a register, reading a new byte every 8 pixels
+    uint8_t bits = pgm_read_byte(src++) << (src_x % 8);
+    int bits_left = 8 - src_x % 8;
+    for (int col = 0; col < width; col++) {
+      if (bits_left == 0) {
+        bits = pgm_read_byte(src++);
+        bits_left = 8;
+      }
+      if (bits & 0x80) {
+        if (color)
+          dst[col] |= mask;
+        else
+          dst[col] &= ~mask;
+      } else if (opaque) {
+        dst[col] &= ~mask;
+      }
+      bits <<= 1;
+      bits_left--;
+    }
+  }
+}
 void SSD1306::fill(int color) {
-  uint8_t fill = color ? 0xFF : 0x00;
+  uint8_t fill = this->native_color_(color) ? 0xFF : 0x00;
   for (uint32_t i = 0; i < this->get_buffer_length_(); i++)
     this->buffer_[i] = fill;
+  this->mark_dirty_(0, 0, this->get_width_internal() - 1, this->get_height_internal() - 1);
 }
 void SSD1306::init_reset_() {
   if (this->reset_pin_ != nullptr) {
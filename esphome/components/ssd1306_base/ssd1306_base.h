@@ -36,12 +36,16 @@ class SSD1306 : public PollingComponent, public display::DisplayBuffer {
 
  protected:
   virtual void command(uint8_t value) = 0;
-  virtual void write_display_data() = 0;
+  /// Write length bytes of display data, the column/page address has already been set.
+  virtual void write_display_data(const uint8_t *data, size_t length) = 0;
   void init_reset_();
 
   bool is_sh1106_() const;
 
   void draw_absolute_pixel_internal(int x, int y, int color) override;
+  void fill_rect_internal(int x, int y, int width, int height, int color) override;
+  void blit_1bpp_internal(int x, int y, int width, int height, const uint8_t *data, int stride, int src_x, int src_y,
+                          int color, bool opaque) override;
 
   int get_height_internal() override;
   int get_width_internal() override;
@@ -8,7 +8,7 @@ namespace ssd1325_base {
 static const char *TAG = "ssd1325";
 
 static const uint8_t BLACK = 0;
-static const uint8_t WHITE = 1;
+static const uint8_t WHITE = 15;
 
 static const uint8_t SSD1325_SETCOLADDR = 0x15;
 static const uint8_t SSD1325_SETROWADDR = 0x75;
@@ -85,14 +85,22 @@ void SSD1325::setup() {
   this->command(SSD1325_DISPLAYON);     /* display ON */
 }
 void SSD1325::display() {
+  int x1, y1, x2, y2;
+  if (!this->get_dirty_region_(&x1, &y1, &x2, &y2))
+    return;
+  // every column address holds two pixels
+  x1 &= ~1;
+  x2 |= 1;
+
   this->command(SSD1325_SETCOLADDR); /* set column address */
-  this->command(0x00);               /* set column start address */
-  this->command(0x3F);               /* set column end address */
+  this->command(x1 / 2);             /* set column start address */
+  this->command(x2 / 2);             /* set column end address */
   this->command(SSD1325_SETROWADDR); /* set row address */
-  this->command(0x00);               /* set row start address */
-  this->command(0x3F);               /* set row end address */
+  this->command(y1);                 /* set row start address */
+  this->command(y2);                 /* set row end address */
 
-  this->write_display_data();
+  this->write_display_data(x1, y1, x2, y2);
+  this->clear_dirty_();
 }
 void SSD1325::update() {
   this->do_update_();
@@ -125,26 +133,25 @@ int SSD1325::get_width_internal() {
       return 0;
   }
 }
-size_t SSD1325::get_buffer_length_() {
-  return size_t(this->get_width_internal()) * size_t(this->get_height_internal()) / 8u;
-}
+size_t SSD1325::get_buffer_length_() { return this->get_packed_buffer_length_(); }
 
 void HOT SSD1325::draw_absolute_pixel_internal(int x, int y, int color) {
   if (x >= this->get_width_internal() || x < 0 || y >= this->get_height_internal() || y < 0)
     return;
 
-  uint16_t pos = x + (y / 8) * this->get_width_internal();
-  uint8_t subpos = y % 8;
-  if (color) {
-    this->buffer_[pos] |= (1 << subpos);
-  } else {
-    this->buffer_[pos] &= ~(1 << subpos);
-  }
+  this->set_packed_pixel_(x, y, color);
+}
+int SSD1325::get_absolute_pixel_internal(int x, int y) { return this->get_packed_pixel_(x, y); }
+void HOT SSD1325::fill_span_internal(int x, int y, int width, int color) {
+  this->fill_packed_span_(x, y, width, color);
 }
 void SSD1325::fill(int color) {
-  uint8_t fill = color ? 0xFF : 0x00;
+  // two pixels per byte, the same gray level in both nibbles
+  const uint8_t level = this->native_color_(color);
+  const uint8_t fill = (level << 4) | level;
   for (uint32_t i = 0; i < this->get_buffer_length_(); i++)
     this->buffer_[i] = fill;
+  this->mark_dirty_(0, 0, this->get_width_internal() - 1, this->get_height_internal() - 1);
 }
 void SSD1325::init_reset_() {
   if (this->reset_pin_ != nullptr) {
@@ -16,6 +16,8 @@ enum SSD1325Model {
 
 class SSD1325 : public PollingComponent, public display::DisplayBuffer {
  public:
+  SSD1325() { this->pixel_format_ = display::PIXEL_FORMAT_GRAY4; }
+
   void setup() override;
 
   void display();
@@ -31,10 +33,16 @@ class SSD1325 : public PollingComponent, public display::DisplayBuffer {
 
  protected:
   virtual void command(uint8_t value) = 0;
-  virtual void write_display_data() = 0;
+  /** Write the pixels from [x1,y1] to [x2,y2] (inclusive), the column/row address has already been set.
+   *
+   * x1 is even and x2 odd, the controller increments the row address first (vertical address increment).
+   */
+  virtual void write_display_data(int x1, int y1, int x2, int y2) = 0;
   void init_reset_();
 
   void draw_absolute_pixel_internal(int x, int y, int color) override;
+  int get_absolute_pixel_internal(int x, int y) override;
+  void fill_span_internal(int x, int y, int width, int color) override;
 
   int get_height_internal() override;
   int get_width_internal() override;
@@ -36,25 +36,17 @@ void SPISSD1325::command(uint8_t value) {
   this->cs_->digital_write(true);
   this->disable();
 }
-void HOT SPISSD1325::write_display_data() {
+void HOT SPISSD1325::write_display_data(int x1, int y1, int x2, int y2) {
   this->cs_->digital_write(true);
   this->dc_pin_->digital_write(true);
   this->cs_->digital_write(false);
   delay(1);
   this->enable();
-  for (uint16_t x = 0; x < this->get_width_internal(); x += 2) {
-    for (uint16_t y = 0; y < this->get_height_internal(); y += 8) {  // we write 8 pixels at once
-      uint8_t left8 = this->buffer_[y * 16 + x];
-      uint8_t right8 = this->buffer_[y * 16 + x + 1];
-      for (uint8_t p = 0; p < 8; p++) {
-        uint8_t d = 0;
-        if (left8 & (1 << p))
-          d |= 0xF0;
-        if (right8 & (1 << p))
-          d |= 0x0F;
-        this->write_byte(d);
-      }
-    }
+  // the buffer holds two pixels per byte like the display RAM, the left one in the high nibble
+  const int stride = this->get_width_internal() / 2;
+  for (int x = x1; x <= x2; x += 2) {
+    for (int y = y1; y <= y2; y++)
+      this->write_byte(this->buffer_[y * stride + x / 2]);
   }
   this->cs_->digital_write(true);
   this->disable();
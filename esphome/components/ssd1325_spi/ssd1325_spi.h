@@ -20,7 +20,7 @@ class SPISSD1325 : public ssd1325_base::SSD1325,
  protected:
   void command(uint8_t value) override;
 
-  void write_display_data() override;
+  void write_display_data(int x1, int y1, int x2, int y2) override;
 
   GPIOPin *dc_pin_;
 };
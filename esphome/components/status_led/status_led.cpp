@@ -28,6 +28,20 @@ void StatusLED::loop() {
     this->pin_->digital_write(false);
   }
 }
+uint32_t StatusLED::next_wake_in() {
+  // Wake up for the next edge of the blink pattern of loop()
+  const uint32_t now = millis();
+  if ((App.get_app_state() & STATUS_LED_ERROR) != 0u) {
+    const uint32_t t = now % 250u;
+    return t < 150u ? 150u - t : 250u - t;
+  }
+  if ((App.get_app_state() & STATUS_LED_WARNING) != 0u) {
+    const uint32_t t = now % 1500u;
+    return t < 250u ? 250u - t : 1500u - t;
+  }
+  // The LED is off, a new warning or error shows up with the next wakeup
+  return UINT32_MAX;
+}
 float StatusLED::get_setup_priority() const { return setup_priority::HARDWARE; }
 float StatusLED::get_loop_priority() const { return 50.0f; }
 
@@ -2,3 +2,4 @@ import esphome.codegen as cg
 
 voltage_sampler_ns = cg.esphome_ns.namespace('voltage_sampler')
 VoltageSampler = voltage_sampler_ns.class_('VoltageSampler')
+BlockSampler = voltage_sampler_ns.class_('BlockSampler', cg.Component)
@@ -0,0 +1,175 @@
+#include "block_sampler.h"
+#include "esphome/core/application.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace voltage_sampler {
+
+static const char *TAG = "voltage_sampler.block";
+
+BlockSampler::BlockSampler(VoltageSampler *source, uint32_t sample_rate, uint16_t block_size)
+    : source_(source), sample_rate_(sample_rate), period_us_(1000000 / sample_rate), block_size_(block_size) {}
+
+void BlockSampler::setup() {
+  this->blocks_[0] = new float[this->block_size_];
+  this->blocks_[1] = new float[this->block_size_];
+#ifdef ARDUINO_ARCH_ESP32
+  this->use_task_ = this->source_->is_sample_thread_safe();
+  if (this->use_task_) {
+    // The main loop runs on the APP CPU, sample on the other one. The task only runs for a single sample per timer
+    // period, so the high priority (for a stable sample rate) doesn't starve the other tasks.
+    xTaskCreatePinnedToCore(BlockSampler::sample_task_, "sampler", 2048, this, 10, &this->task_, 0);
+    esp_timer_create_args_t timer_args{};
+    timer_args.callback = BlockSampler::timer_callback_;
+    timer_args.arg = this;
+    timer_args.name = "sampler";
+    esp_timer_create(&timer_args, &this->timer_);
+  }
+#endif
+}
+
+void BlockSampler::dump_config() {
+  ESP_LOGCONFIG(TAG, "Block Sampler:");
+  ESP_LOGCONFIG(TAG, "  Sample Rate: %u Hz", this->sample_rate_);
+  ESP_LOGCONFIG(TAG, "  Block Size: %u", this->block_size_);
+#ifdef ARDUINO_ARCH_ESP32
+  ESP_LOGCONFIG(TAG, "  Sampled From: %s", this->use_task_ ? "Timer Task" : "Main Loop");
+#else
+  ESP_LOGCONFIG(TAG, "  Sampled From: Main Loop");
+#endif
+}
+
+float BlockSampler::get_setup_priority() const { return setup_priority::DATA; }
+
+void BlockSampler::add_on_block_callback(std::function<void(const float *, size_t, bool)> &&callback) {
+  this->block_callback_.add(std::move(callback));
+}
+
+void BlockSampler::start() {
+  if (this->requests_++ != 0)
+    return;
+  // The sampler discards its partial block from before the last stop() with the first sample of the new session. A
+  // full block from before is dropped here, or by loop() if the sampler was just finishing it.
+  this->session_.fetch_add(1, std::memory_order_acq_rel);
+  this->ready_.store(false, std::memory_order_release);
+  this->active_.store(true, std::memory_order_release);
+#ifdef ARDUINO_ARCH_ESP32
+  if (this->use_task_) {
+    esp_timer_start_periodic(this->timer_, this->period_us_);
+    return;
+  }
+#endif
+  this->high_freq_.start();
+}
+void BlockSampler::stop() {
+  if (this->requests_ == 0 || --this->requests_ != 0)
+    return;
+  this->active_.store(false, std::memory_order_release);
+#ifdef ARDUINO_ARCH_ESP32
+  if (this->use_task_) {
+    esp_timer_stop(this->timer_);
+    return;
+  }
+#endif
+  this->high_freq_.stop();
+}
+
+void BlockSampler::loop() {
+#ifdef ARDUINO_ARCH_ESP32
+  if (!this->use_task_)
+    this->sample_due_();
+#else
+  this->sample_due_();
+#endif
+
+  if (!this->ready_.load(std::memory_order_acquire))
+    return;
+  if (this->ready_session_ != this->session_.load(std::memory_order_acquire)) {
+    this->ready_.store(false, std::memory_order_release);
+    return;
+  }
+  if (this->ready_gaps_)
+    this->gap_blocks_++;
+  this->block_callback_.call(this->blocks_[this->ready_block_], this->block_size_, this->ready_gaps_);
+  this->ready_.store(false, std::memory_order_release);
+}
+uint32_t BlockSampler::next_wake_in() {
+  if (this->ready_.load(std::memory_order_acquire))
+    return 0;
+  // loop() runs at high frequency while sampling from it, full blocks of the sampling task wake the loop
+  return UINT32_MAX;
+}
+
+#ifdef ARDUINO_ARCH_ESP32
+void BlockSampler::sample_task_(void *param) {
+  auto *sampler = reinterpret_cast<BlockSampler *>(param);
+  while (true) {
+    // Number of timer periods since the last sample, more than one if the task couldn't run in time
+    const uint32_t periods = ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    if (periods != 0 && sampler->active_.load(std::memory_order_acquire))
+      sampler->take_sample_(periods - 1);
+  }
+}
+void BlockSampler::timer_callback_(void *param) {
+  // Runs in the esp_timer task, take the sample in our own task so that a slow source doesn't delay other timers
+  xTaskNotifyGive(reinterpret_cast<BlockSampler *>(param)->task_);
+}
+#endif
+
+void BlockSampler::sample_due_() {
+  if (!this->active_.load(std::memory_order_acquire))
+    return;
+  const uint32_t now = micros();
+  if (this->restarted_())
+    this->next_sample_us_ = now;
+  const auto late = int32_t(now - this->next_sample_us_);
+  if (late < 0)
+    return;
+  const uint32_t missed = uint32_t(late) / this->period_us_;
+  if (missed == 0) {
+    this->next_sample_us_ += this->period_us_;
+  } else {
+    // Skip the missed slots instead of catching up with a burst of samples, that would distort the signal more than
+    // the gap. Restart the pacing from this sample.
+    this->next_sample_us_ = now + this->period_us_;
+  }
+  this->take_sample_(missed);
+}
+
+void BlockSampler::take_sample_(uint32_t missed) {
+  if (this->restarted_()) {
+    this->sampling_ = true;
+    this->write_session_ = this->session_.load(std::memory_order_acquire);
+    this->sample_index_ = 0;
+    this->write_gaps_ = false;
+  } else if (missed != 0 && this->sample_index_ != 0) {
+    this->write_gaps_ = true;
+  }
+
+  this->blocks_[this->write_block_][this->sample_index_] = this->source_->sample();
+  if (++this->sample_index_ == this->block_size_)
+    this->finish_block_();
+}
+
+void BlockSampler::finish_block_() {
+  this->sample_index_ = 0;
+  const bool gaps = this->write_gaps_;
+  this->write_gaps_ = false;
+  if (this->ready_.load(std::memory_order_acquire)) {
+    // the consumers still use the other block, overwrite this one
+    this->dropped_blocks_++;
+    return;
+  }
+  this->ready_block_ = this->write_block_;
+  this->ready_gaps_ = gaps;
+  this->ready_session_ = this->write_session_;
+  this->ready_.store(true, std::memory_order_release);
+  this->write_block_ ^= 1;
+#ifdef ARDUINO_ARCH_ESP32
+  if (this->use_task_)
+    App.wake_loop();
+#endif
+}
+
+}  // namespace voltage_sampler
+}  // namespace esphome
@@ -0,0 +1,118 @@
+#pragma once
+
+#include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
+#include "esphome/components/voltage_sampler/voltage_sampler.h"
+
+#include <atomic>
+
+#ifdef ARDUINO_ARCH_ESP32
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
+namespace esphome {
+namespace voltage_sampler {
+
+/** Samples a VoltageSampler at a fixed rate into a double buffer and hands whole blocks of samples to consumers.
+ *
+ * On the ESP32, sources that can be sampled from another task (see VoltageSampler::is_sample_thread_safe()) are
+ * sampled by a high priority task on the PRO CPU, triggered by the high resolution timer every sample period. The
+ * sample rate then doesn't depend on the main loop, and sampling doesn't block loop(). Sample slots are only missed
+ * if the task can't run for a whole sample period.
+ *
+ * Everywhere else (the ESP8266 has no tasks, and sources like I2C ADCs share their bus with the main loop) loop()
+ * runs at high frequency while sampling and takes a sample whenever one is due, without waiting for it. How many
+ * sample slots that hits depends on how long the other components take in loop(): with a few fast components it's
+ * all of them, a component blocking for longer than a sample period causes a gap.
+ *
+ * Samples are never taken late to catch up after a missed slot, a block with missed slots is marked as having gaps
+ * instead. Consumers get the samples in the order they were taken, with the gap flag (and get_gap_blocks() counts
+ * those blocks), and can decide whether that's good enough for them.
+ *
+ * Full blocks are passed to the consumers from loop(), on the main task. While they're processed the other buffer is
+ * being filled; if the consumers don't keep up, blocks are dropped (and counted) instead of blocking the sampling.
+ *
+ * Sampling only runs between start() and stop(), so that it doesn't take CPU time when nobody needs samples.
+ */
+class BlockSampler : public Component {
+ public:
+  BlockSampler(VoltageSampler *source, uint32_t sample_rate, uint16_t block_size);
+
+  void setup() override;
+  void loop() override;
+  uint32_t next_wake_in() override;
+  void dump_config() override;
+  float get_setup_priority() const override;
+
+  /** Add a callback that will be called from loop() with every full block of samples (in V).
+   *
+   * The last argument is whether sample slots were missed between the samples of the block.
+   */
+  void add_on_block_callback(std::function<void(const float *, size_t, bool)> &&callback);
+  /// Request sampling, it runs as long as there are more start() than stop() calls.
+  void start();
+  void stop();
+
+  uint32_t get_sample_rate() const { return this->sample_rate_; }
+  uint16_t get_block_size() const { return this->block_size_; }
+  /// Number of blocks dropped because the consumers were still busy with the previous block.
+  uint32_t get_dropped_blocks() const { return this->dropped_blocks_; }
+  /// Number of blocks passed to the consumers that have gaps.
+  uint32_t get_gap_blocks() const { return this->gap_blocks_; }
+
+ protected:
+  /// Take the next sample, missed is the number of sample slots skipped since the previous one.
+  void take_sample_(uint32_t missed);
+  /// Whether the sampler has to start a new block, because it hasn't sampled yet or start() was called since.
+  bool restarted_() const {
+    return !this->sampling_ || this->session_.load(std::memory_order_acquire) != this->write_session_;
+  }
+  /// Take a sample from loop() if one is due.
+  void sample_due_();
+  void finish_block_();
+
+#ifdef ARDUINO_ARCH_ESP32
+  static void sample_task_(void *param);
+  static void timer_callback_(void *param);
+
+  /// Whether samples are taken by sample_task_() instead of loop().
+  bool use_task_{false};
+  TaskHandle_t task_{nullptr};
+  esp_timer_handle_t timer_{nullptr};
+#endif
+
+  VoltageSampler *source_;
+  uint32_t sample_rate_;
+  uint32_t period_us_;
+  uint16_t block_size_;
+  float *blocks_[2]{nullptr, nullptr};
+  /// Buffer the sampler writes into, the next sample index in it and whether slots were missed for it.
+  uint8_t write_block_{0};
+  uint16_t sample_index_{0};
+  bool write_gaps_{false};
+  uint32_t next_sample_us_{0};
+  /// Number of start() calls without stop(), only used by the main task.
+  uint8_t requests_{0};
+  /// Whether sampling is requested.
+  std::atomic<bool> active_{false};
+  /// Incremented by start(). The sampler discards its partial block when it changes, and loop() blocks of an
+  /// earlier session, so start() never writes to the sampler's state while a sample may still be in progress.
+  std::atomic<uint32_t> session_{0};
+  /// Only used by the sampler: whether it has taken a sample yet, and the session of the block it writes.
+  bool sampling_{false};
+  uint32_t write_session_{0};
+  /// Set by the sampler when blocks_[ready_block_] is full, cleared by loop() after the consumers are done with it.
+  std::atomic<bool> ready_{false};
+  uint8_t ready_block_{0};
+  bool ready_gaps_{false};
+  uint32_t ready_session_{0};
+  uint32_t dropped_blocks_{0};
+  uint32_t gap_blocks_{0};
+  CallbackManager<void(const float *, size_t, bool)> block_callback_;
+  HighFrequencyLoopRequester high_freq_;
+};
+
+}  // namespace voltage_sampler
+}  // namespace esphome
@@ -0,0 +1,134 @@
+#include "dsp.h"
+#include "esphome/core/helpers.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace esphome {
+namespace voltage_sampler {
+
+static const float Q16_SCALE = 65536.0f;
+
+/// Convert to Q16.16, the range of ±32768 V is plenty for any ADC or sensor voltage.
+static inline int32_t to_q16(float value) { return static_cast<int32_t>(value * Q16_SCALE); }
+
+/** Whether all samples can be converted to Q16.16.
+ *
+ * Converting NaN (a failed read) or infinity to an integer is undefined behavior, the fixed-point kernels return NaN
+ * for those blocks instead, like the float kernels.
+ */
+static bool all_finite(const float *samples, size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    if (!std::isfinite(samples[i]))
+      return false;
+  }
+  return true;
+}
+
+float HOT block_mean_float(const float *samples, size_t count) {
+  if (count == 0)
+    return 0.0f;
+  float sum = 0.0f;
+  for (size_t i = 0; i < count; i++)
+    sum += samples[i];
+  return sum / count;
+}
+float HOT block_mean_fixed(const float *samples, size_t count) {
+  if (count == 0)
+    return 0.0f;
+  if (!all_finite(samples, count))
+    return NAN;
+  int64_t sum = 0;
+  for (size_t i = 0; i < count; i++)
+    sum += to_q16(samples[i]);
+  return (sum / int64_t(count)) / Q16_SCALE;
+}
+
+float HOT block_sum_squares_float(const float *samples, size_t count, float offset) {
+  float sum = 0.0f;
+  for (size_t i = 0; i < count; i++) {
+    const float value = samples[i] - offset;
+    sum += value * value;
+  }
+  return sum;
+}
+float HOT block_sum_squares_fixed(const float *samples, size_t count, float offset) {
+  if (!std::isfinite(offset) || !all_finite(samples, count))
+    return NAN;
+  const int32_t offset_q16 = to_q16(offset);
+  uint64_t sum = 0;
+  for (size_t i = 0; i < count; i++) {
+    const int64_t value = to_q16(samples[i]) - offset_q16;
+    sum += uint64_t(value * value);
+  }
+  // Q32.32, convert in two steps so that the intermediate value stays in float range with full precision
+  return float(sum >> 16) / Q16_SCALE;
+}
+
+float block_rms(const float *samples, size_t count, float offset) {
+  if (count == 0)
+    return 0.0f;
+  return std::sqrt(block_sum_squares(samples, count, offset) / count);
+}
+
+static PowerMeasurement make_power_measurement(float voltage_variance, float current_variance, float covariance) {
+  PowerMeasurement measurement{};
+  measurement.voltage_rms = std::sqrt(std::max(voltage_variance, 0.0f));
+  measurement.current_rms = std::sqrt(std::max(current_variance, 0.0f));
+  measurement.real_power = covariance;
+  measurement.apparent_power = measurement.voltage_rms * measurement.current_rms;
+  return measurement;
+}
+
+PowerMeasurement HOT block_power_float(const float *voltage, const float *current, size_t count) {
+  if (count == 0)
+    return make_power_measurement(0.0f, 0.0f, 0.0f);
+  // remove the DC offsets first, the single pass formula loses too much precision in float
+  const float voltage_mean = block_mean_float(voltage, count);
+  const float current_mean = block_mean_float(current, count);
+  float sum_vv = 0.0f, sum_ii = 0.0f, sum_vi = 0.0f;
+  for (size_t i = 0; i < count; i++) {
+    const float v = voltage[i] - voltage_mean;
+    const float c = current[i] - current_mean;
+    sum_vv += v * v;
+    sum_ii += c * c;
+    sum_vi += v * c;
+  }
+  return make_power_measurement(sum_vv / count, sum_ii / count, sum_vi / count);
+}
+PowerMeasurement HOT block_power_fixed(const float *voltage, const float *current, size_t count) {
+  if (count == 0)
+    return make_power_measurement(0.0f, 0.0f, 0.0f);
+  if (!all_finite(voltage, count) || !all_finite(current, count))
+    return make_power_measurement(NAN, NAN, NAN);
+  const auto n = int64_t(count);
+  // Two passes: the products of the raw Q16 sums overflow 64 bits with large DC offsets (n * |mean| > ~46k V),
+  // the products of the deviations from the mean only depend on the AC part.
+  int64_t sum_v = 0, sum_i = 0;
+  for (size_t i = 0; i < count; i++) {
+    sum_v += to_q16(voltage[i]);
+    sum_i += to_q16(current[i]);
+  }
+  const int64_t mean_v = sum_v / n;
+  const int64_t mean_i = sum_i / n;
+  int64_t sum_vv = 0, sum_ii = 0, sum_vi = 0;
+  for (size_t i = 0; i < count; i++) {
+    const int64_t v = to_q16(voltage[i]) - mean_v;
+    const int64_t c = to_q16(current[i]) - mean_i;
+    sum_vv += v * v;
+    sum_ii += c * c;
+    sum_vi += v * c;
+  }
+  // The truncated means leave a residual DC part below one LSB (|rest| < n), remove it exactly
+  const int64_t rest_v = sum_v - mean_v * n;
+  const int64_t rest_i = sum_i - mean_i * n;
+  // n * variance in Q32.32
+  const int64_t var_v = sum_vv - (rest_v * rest_v) / n;
+  const int64_t var_i = sum_ii - (rest_i * rest_i) / n;
+  const int64_t cov = sum_vi - (rest_v * rest_i) / n;
+  const float scale = Q16_SCALE * Q16_SCALE * count;
+  return make_power_measurement(var_v / scale, var_i / scale, cov / scale);
+}
+
+}  // namespace voltage_sampler
+}  // namespace esphome
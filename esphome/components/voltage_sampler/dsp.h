@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace voltage_sampler {
+
+/** Block kernels for measuring AC signals, for example from the blocks of a BlockSampler.
+ *
+ * Every kernel has a float and a fixed-point implementation. The fixed-point one converts the samples to Q16.16 and
+ * accumulates in 64-bit integers, which is much faster on the ESP8266 (no FPU) and exact apart from the conversion.
+ * The versions without suffix pick the faster one for the platform.
+ *
+ * Input range of the fixed-point kernels: samples (and offsets) within ±32768, and the sum of the squared deviations
+ * (from the offset for block_sum_squares, from the block mean for block_power) below 2^31 V², for example a
+ * deviation of up to ±1448 V in a block of 1024 samples. DC offsets don't count against that limit.
+ *
+ * A block with a NaN sample (a failed read) gives NaN results in both implementations, the fixed-point ones also
+ * return NaN for infinite samples (they can't be converted to Q16.16).
+ */
+
+/// Real and apparent power of a pair of voltage and current blocks, with the DC offsets removed.
+struct PowerMeasurement {
+  float voltage_rms;
+  float current_rms;
+  /// Mean of the instantaneous power, in W.
+  float real_power;
+  /// voltage_rms * current_rms, in VA.
+  float apparent_power;
+
+  float power_factor() const { return this->apparent_power == 0.0f ? 0.0f : this->real_power / this->apparent_power; }
+};
+
+/// Mean of the samples (their DC offset).
+float block_mean_float(const float *samples, size_t count);
+float block_mean_fixed(const float *samples, size_t count);
+/// Sum of (x - offset)², to accumulate the RMS value of a signal over multiple blocks.
+float block_sum_squares_float(const float *samples, size_t count, float offset);
+float block_sum_squares_fixed(const float *samples, size_t count, float offset);
+/// Power of the paired voltage and current samples, both blocks have count samples.
+PowerMeasurement block_power_float(const float *voltage, const float *current, size_t count);
+PowerMeasurement block_power_fixed(const float *voltage, const float *current, size_t count);
+
+#ifdef ARDUINO_ARCH_ESP8266
+inline float block_mean(const float *samples, size_t count) { return block_mean_fixed(samples, count); }
+inline float block_sum_squares(const float *samples, size_t count, float offset) {
+  return block_sum_squares_fixed(samples, count, offset);
+}
+inline PowerMeasurement block_power(const float *voltage, const float *current, size_t count) {
+  return block_power_fixed(voltage, current, count);
+}
+#else
+inline float block_mean(const float *samples, size_t count) { return block_mean_float(samples, count); }
+inline float block_sum_squares(const float *samples, size_t count, float offset) {
+  return block_sum_squares_float(samples, count, offset);
+}
+inline PowerMeasurement block_power(const float *voltage, const float *current, size_t count) {
+  return block_power_float(voltage, current, count);
+}
+#endif
+
+/// RMS value of the samples around offset: sqrt(mean((x - offset)²)).
+float block_rms(const float *samples, size_t count, float offset);
+
+}  // namespace voltage_sampler
+}  // namespace esphome
@@ -10,6 +10,13 @@ class VoltageSampler {
  public:
   /// Get a voltage reading, in V.
   virtual float sample() = 0;
+
+  /** Whether sample() may be called from another task while the main loop is running.
+   *
+   * Sources that share a bus or peripheral with components on the main loop without a lock (like I2C) must return
+   * false, a BlockSampler then samples them from the main loop.
+   */
+  virtual bool is_sample_thread_safe() const { return false; }
 };
 
 }  // namespace voltage_sampler
@@ -117,9 +117,10 @@ void WaveshareEPaper::update() {
 }
 void WaveshareEPaper::fill(int color) {
   // flip logic
-  const uint8_t fill = color ? 0x00 : 0xFF;
+  const uint8_t fill = this->native_color_(color) ? 0x00 : 0xFF;
   for (uint32_t i = 0; i < this->get_buffer_length_(); i++)
     this->buffer_[i] = fill;
+  this->mark_dirty_(0, 0, this->get_width_internal() - 1, this->get_height_internal() - 1);
 }
 void HOT WaveshareEPaper::draw_absolute_pixel_internal(int x, int y, int color) {
   if (x >= this->get_width_internal() || y >= this->get_height_internal() || x < 0 || y < 0)
@@ -133,6 +134,23 @@ void HOT WaveshareEPaper::draw_absolute_pixel_internal(int x, int y, int color)
   else
     this->buffer_[pos] &= ~(0x80 >> subpos);
 }
+void HOT WaveshareEPaper::fill_span_internal(int x, int y, int width, int color) {
+  // rows of 8 pixels per byte, most significant bit first
+  uint8_t *row = this->buffer_ + y * (this->get_width_internal() / 8u);
+  const int x2 = x + width - 1;
+  const int byte1 = x / 8, byte2 = x2 / 8;
+  uint8_t first_mask = 0xFF >> (x & 0x07);
+  const uint8_t last_mask = 0xFF << (7 - (x2 & 0x07));
+  if (byte1 == byte2)
+    first_mask &= last_mask;
+  // flip logic
+  const uint8_t fill = this->native_color_(color) ? 0x00 : 0xFF;
+  row[byte1] = (row[byte1] & ~first_mask) | (fill & first_mask);
+  if (byte1 == byte2)
+    return;
+  memset(row + byte1 + 1, fill, byte2 - byte1 - 1);
+  row[byte2] = (row[byte2] & ~last_mask) | (fill & last_mask);
+}
 uint32_t WaveshareEPaper::get_buffer_length_() { return this->get_width_internal() * this->get_height_internal() / 8u; }
 void WaveshareEPaper::start_command_() {
   this->dc_pin_->digital_write(false);
@@ -210,9 +228,17 @@ void HOT WaveshareEPaperTypeA::display() {
     return;
   }
 
+  int x1, y1, x2, y2;
+  const bool dirty = this->get_dirty_region_(&x1, &y1, &x2, &y2);
+  if (!dirty && !this->has_last_region_) {
+    // nothing changed, don't refresh (and flash) the panel
+    this->status_clear_warning();
+    return;
+  }
+
+  const bool full_update = this->full_update_every_ < 2 || this->at_update_ == 0;
   if (this->full_update_every_ >= 2) {
     bool prev_full_update = this->at_update_ == 1;
-    bool full_update = this->at_update_ == 0;
     if (full_update != prev_full_update) {
       if (this->model_ == TTGO_EPAPER_2_13_IN) {
         this->write_lut_(full_update ? FULL_UPDATE_LUT_TTGO : PARTIAL_UPDATE_LUT_TTGO, LUT_SIZE_TTGO);
@@ -225,25 +251,58 @@ void HOT WaveshareEPaperTypeA::display() {
     this->at_update_ = (this->at_update_ + 1) % this->full_update_every_;
   }
 
-  // Set x & y regions we want to write to (full)
+  if (full_update) {
+    x1 = 0;
+    y1 = 0;
+    x2 = this->get_width_internal() - 1;
+    y2 = this->get_height_internal() - 1;
+  }
+  const bool has_region = dirty || full_update;
+
+  // The controller alternates between two RAM buffers on partial updates, so the region written now also has to
+  // contain what was written to the other buffer in the last update.
+  int written_x1 = x1, written_y1 = y1, written_x2 = x2, written_y2 = y2;
+  if (this->has_last_region_) {
+    if (!has_region) {
+      written_x1 = this->last_region_x1_;
+      written_y1 = this->last_region_y1_;
+      written_x2 = this->last_region_x2_;
+      written_y2 = this->last_region_y2_;
+    } else {
+      written_x1 = std::min(written_x1, this->last_region_x1_);
+      written_y1 = std::min(written_y1, this->last_region_y1_);
+      written_x2 = std::max(written_x2, this->last_region_x2_);
+      written_y2 = std::max(written_y2, this->last_region_y2_);
+    }
+  }
+  this->has_last_region_ = has_region;
+  this->last_region_x1_ = x1;
+  this->last_region_y1_ = y1;
+  this->last_region_x2_ = x2;
+  this->last_region_y2_ = y2;
+
+  // RAM X addresses are in bytes (8 pixels)
+  const int byte_x1 = written_x1 / 8, byte_x2 = written_x2 / 8;
+
+  // Set x & y regions we want to write to
   // COMMAND SET RAM X ADDRESS START END POSITION
   this->command(0x44);
-  this->data(0x00);
-  this->data((this->get_width_internal() - 1) >> 3);
+  this->data(byte_x1);
+  this->data(byte_x2);
   // COMMAND SET RAM Y ADDRESS START END POSITION
   this->command(0x45);
-  this->data(0x00);
-  this->data(0x00);
-  this->data(this->get_height_internal() - 1);
-  this->data((this->get_height_internal() - 1) >> 8);
+  this->data(written_y1);
+  this->data(written_y1 >> 8);
+  this->data(written_y2);
+  this->data(written_y2 >> 8);
 
   // COMMAND SET RAM X ADDRESS COUNTER
   this->command(0x4E);
-  this->data(0x00);
+  this->data(byte_x1);
   // COMMAND SET RAM Y ADDRESS COUNTER
   this->command(0x4F);
-  this->data(0x00);
-  this->data(0x00);
+  this->data(written_y1);
+  this->data(written_y1 >> 8);
 
   if (!this->wait_until_idle_()) {
     this->status_set_warning();
@@ -253,8 +312,11 @@ void HOT WaveshareEPaperTypeA::display() {
   // COMMAND WRITE RAM
   this->command(0x24);
   this->start_data_();
-  this->write_array(this->buffer_, this->get_buffer_length_());
+  const int row_bytes = this->get_width_internal() / 8;
+  for (int y = written_y1; y <= written_y2; y++)
+    this->write_array(this->buffer_ + y * row_bytes + byte_x1, byte_x2 - byte_x1 + 1);
   this->end_data_();
+  this->clear_dirty_();
 
   // COMMAND DISPLAY UPDATE CONTROL 2
   this->command(0x22);
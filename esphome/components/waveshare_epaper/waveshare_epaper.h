@@ -37,6 +37,7 @@ class WaveshareEPaper : public PollingComponent,
 
  protected:
   void draw_absolute_pixel_internal(int x, int y, int color) override;
+  void fill_span_internal(int x, int y, int width, int color) override;
 
   bool wait_until_idle_();
 
@@ -98,6 +99,12 @@ class WaveshareEPaperTypeA : public WaveshareEPaper {
 
   uint32_t full_update_every_{30};
   uint32_t at_update_{0};
+  /// The dirty region of the last update, see display().
+  bool has_last_region_{false};
+  int last_region_x1_{0};
+  int last_region_y1_{0};
+  int last_region_x2_{0};
+  int last_region_y2_{0};
   WaveshareEPaperTypeAModel model_;
 };
 
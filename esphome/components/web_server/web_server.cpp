@@ -17,6 +17,19 @@ namespace web_server {
 
 static const char *TAG = "web_server";
 
+/// Defer state events while event source clients have this many messages queued (the library drops at 32).
+static const size_t MAX_QUEUED_EVENTS = 16;
+
+/// Entity types in dirty_states_.
+enum DirtyStateType : uint8_t {
+  DIRTY_SENSOR,
+  DIRTY_SWITCH,
+  DIRTY_BINARY_SENSOR,
+  DIRTY_FAN,
+  DIRTY_LIGHT,
+  DIRTY_TEXT_SENSOR,
+};
+
 void write_row(AsyncResponseStream *stream, Nameable *obj, const std::string &klass, const std::string &action) {
   if (obj->is_internal())
     return;
@@ -121,6 +134,72 @@ void WebServer::setup() {
 
   this->set_interval(10000, [this]() { this->events_.send("", "ping", millis(), 30000); });
 }
+void WebServer::loop() {
+  if (this->dirty_states_.empty() || this->events_congested_())
+    return;
+  this->dirty_states_.flush([this](Nameable *obj, uint8_t type) { return this->send_dirty_state_(obj, type); });
+}
+uint32_t WebServer::next_wake_in() {
+  // Requests are handled by the async web server (actions are deferred, which wakes the loop)
+  if (this->dirty_states_.empty())
+    return UINT32_MAX;
+  // Wait for the congestion to clear
+  return Component::next_wake_in();
+}
+bool WebServer::events_congested_() { return this->events_.avgPacketsWaiting() >= MAX_QUEUED_EVENTS; }
+bool WebServer::defer_state_(Nameable *obj, uint8_t type) {
+  if (!this->events_congested_())
+    return false;
+  this->dirty_states_.mark(obj, type);
+  return true;
+}
+bool WebServer::send_dirty_state_(Nameable *obj, uint8_t type) {
+  if (this->events_congested_())
+    return false;
+  switch (type) {
+#ifdef USE_SENSOR
+    case DIRTY_SENSOR: {
+      auto *sensor = static_cast<sensor::Sensor *>(obj);
+      this->events_.send(this->sensor_json(sensor, sensor->state).c_str(), "state");
+      break;
+    }
+#endif
+#ifdef USE_SWITCH
+    case DIRTY_SWITCH: {
+      auto *a_switch = static_cast<switch_::Switch *>(obj);
+      this->events_.send(this->switch_json(a_switch, a_switch->state).c_str(), "state");
+      break;
+    }
+#endif
+#ifdef USE_BINARY_SENSOR
+    case DIRTY_BINARY_SENSOR: {
+      auto *binary_sensor = static_cast<binary_sensor::BinarySensor *>(obj);
+      this->events_.send(this->binary_sensor_json(binary_sensor, binary_sensor->state).c_str(), "state");
+      break;
+    }
+#endif
+#ifdef USE_FAN
+    case DIRTY_FAN:
+      this->events_.send(this->fan_json(static_cast<fan::FanState *>(obj)).c_str(), "state");
+      break;
+#endif
+#ifdef USE_LIGHT
+    case DIRTY_LIGHT:
+      this->events_.send(this->light_json(static_cast<light::LightState *>(obj)).c_str(), "state");
+      break;
+#endif
+#ifdef USE_TEXT_SENSOR
+    case DIRTY_TEXT_SENSOR: {
+      auto *text_sensor = static_cast<text_sensor::TextSensor *>(obj);
+      this->events_.send(this->text_sensor_json(text_sensor, text_sensor->state).c_str(), "state");
+      break;
+    }
+#endif
+    default:
+      break;
+  }
+  return true;
+}
 void WebServer::dump_config() {
   ESP_LOGCONFIG(TAG, "Web Server:");
   ESP_LOGCONFIG(TAG, "  Address: %s:%u", network_get_address().c_str(), this->base_->get_port());
@@ -224,6 +303,8 @@ void WebServer::handle_js_request(AsyncWebServerRequest *request) {
 
 #ifdef USE_SENSOR
 void WebServer::on_sensor_update(sensor::Sensor *obj, float state) {
+  if (this->defer_state_(obj, DIRTY_SENSOR))
+    return;
   this->events_.send(this->sensor_json(obj, state).c_str(), "state");
 }
 void WebServer::handle_sensor_request(AsyncWebServerRequest *request, UrlMatch match) {
@@ -252,6 +333,8 @@ std::string WebServer::sensor_json(sensor::Sensor *obj, float value) {
 
 #ifdef USE_TEXT_SENSOR
 void WebServer::on_text_sensor_update(text_sensor::TextSensor *obj, std::string state) {
+  if (this->defer_state_(obj, DIRTY_TEXT_SENSOR))
+    return;
   this->events_.send(this->text_sensor_json(obj, state).c_str(), "state");
 }
 void WebServer::handle_text_sensor_request(AsyncWebServerRequest *request, UrlMatch match) {
@@ -277,6 +360,8 @@ std::string WebServer::text_sensor_json(text_sensor::TextSensor *obj, const std:
 
 #ifdef USE_SWITCH
 void WebServer::on_switch_update(switch_::Switch *obj, bool state) {
+  if (this->defer_state_(obj, DIRTY_SWITCH))
+    return;
   this->events_.send(this->switch_json(obj, state).c_str(), "state");
 }
 std::string WebServer::switch_json(switch_::Switch *obj, bool value) {
@@ -316,7 +401,7 @@ void WebServer::handle_switch_request(AsyncWebServerRequest *request, UrlMatch m
 
 #ifdef USE_BINARY_SENSOR
 void WebServer::on_binary_sensor_update(binary_sensor::BinarySensor *obj, bool state) {
-  if (obj->is_internal())
+  if (obj->is_internal() || this->defer_state_(obj, DIRTY_BINARY_SENSOR))
     return;
   this->events_.send(this->binary_sensor_json(obj, state).c_str(), "state");
 }
@@ -343,7 +428,7 @@ void WebServer::handle_binary_sensor_request(AsyncWebServerRequest *request, Url
 
 #ifdef USE_FAN
 void WebServer::on_fan_update(fan::FanState *obj) {
-  if (obj->is_internal())
+  if (obj->is_internal() || this->defer_state_(obj, DIRTY_FAN))
     return;
   this->events_.send(this->fan_json(obj).c_str(), "state");
 }
@@ -422,7 +507,7 @@ void WebServer::handle_fan_request(AsyncWebServerRequest *request, UrlMatch matc
 
 #ifdef USE_LIGHT
 void WebServer::on_light_update(light::LightState *obj) {
-  if (obj->is_internal())
+  if (obj->is_internal() || this->defer_state_(obj, DIRTY_LIGHT))
     return;
   this->events_.send(this->light_json(obj).c_str(), "state");
 }
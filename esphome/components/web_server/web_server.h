@@ -2,6 +2,7 @@
 
 #include "esphome/core/component.h"
 #include "esphome/core/controller.h"
+#include "esphome/core/helpers.h"
 #include "esphome/components/web_server_base/web_server_base.h"
 
 #include <vector>
@@ -67,6 +68,10 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
 
   void dump_config() override;
 
+  /// Send state events that were held back while the event source clients were congested.
+  void loop() override;
+  uint32_t next_wake_in() override;
+
   /// MQTT setup priority.
   float get_setup_priority() const override;
 
@@ -152,8 +157,16 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   bool isRequestHandlerTrivial() override;
 
  protected:
+  /// Whether the event source clients have too many messages queued, state events are deferred then.
+  bool events_congested_();
+  /// Defer the state event of obj if the event source is congested, returns true if deferred.
+  bool defer_state_(Nameable *obj, uint8_t type);
+  bool send_dirty_state_(Nameable *obj, uint8_t type);
+
   web_server_base::WebServerBase *base_;
   AsyncEventSource events_{"/events"};
+  /// Entities whose state event was deferred, sent with their then current state once the clients caught up.
+  DirtySet<Nameable> dirty_states_;
   const char *username_{nullptr};
   const char *password_{nullptr};
   const char *css_url_{nullptr};
@@ -131,6 +131,18 @@ void WiFiComponent::loop() {
 
   network_tick_mdns();
 }
+uint32_t WiFiComponent::next_wake_in() {
+  switch (this->state_) {
+    case WIFI_COMPONENT_STATE_STA_CONNECTED:
+    case WIFI_COMPONENT_STATE_OFF:
+    case WIFI_COMPONENT_STATE_AP:
+      // Only the connection is checked (and mDNS ticked), once a second is enough
+      return 1000;
+    default:
+      // Scanning and connecting are polled
+      return Component::next_wake_in();
+  }
+}
 
 WiFiComponent::WiFiComponent() { global_wifi_component = this; }
 
@@ -175,6 +175,7 @@ class WiFiComponent : public Component {
 
   /// Reconnect WiFi if required.
   void loop() override;
+  uint32_t next_wake_in() override;
 
   bool has_sta() const;
   bool has_ap() const;
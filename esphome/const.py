@@ -48,6 +48,7 @@ CONF_AUTOMATION_ID = 'automation_id'
 CONF_AVAILABILITY = 'availability'
 CONF_AWAY = 'away'
 CONF_AWAY_CONFIG = 'away_config'
+CONF_BATCH_DELAY = 'batch_delay'
 CONF_BATTERY_LEVEL = 'battery_level'
 CONF_BATTERY_VOLTAGE = 'battery_voltage'
 CONF_BAUD_RATE = 'baud_rate'
@@ -350,10 +351,12 @@ CONF_POWER_SAVE_MODE = 'power_save_mode'
 CONF_POWER_SUPPLY = 'power_supply'
 CONF_PRESSURE = 'pressure'
 CONF_PRIORITY = 'priority'
+CONF_PROFILE_COMPONENTS = 'profile_components'
 CONF_PROTOCOL = 'protocol'
 CONF_PULL_MODE = 'pull_mode'
 CONF_PULSE_LENGTH = 'pulse_length'
 CONF_QOS = 'qos'
+CONF_QUANTILE = 'quantile'
 CONF_RANDOM = 'random'
 CONF_RANGE = 'range'
 CONF_RANGE_FROM = 'range_from'
@@ -451,6 +454,7 @@ CONF_TEXT_SENSORS = 'text_sensors'
 CONF_THEN = 'then'
 CONF_THRESHOLD = 'threshold'
 CONF_THROTTLE = 'throttle'
+CONF_TICKLESS = 'tickless'
 CONF_TILT = 'tilt'
 CONF_TILT_ACTION = 'tilt_action'
 CONF_TILT_LAMBDA = 'tilt_lambda'
@@ -6,10 +6,17 @@
 #include "esphome/components/status_led/status_led.h"
 #endif
 
+#ifdef ARDUINO_ARCH_ESP8266
+extern "C" void esp_schedule();
+#endif
+
 namespace esphome {
 
 static const char *TAG = "app";
 
+/// Upper bound for a single tickless sleep, so that the watchdogs are still fed regularly.
+static const uint32_t TICKLESS_MAX_SLEEP = 1000;
+
 void Application::register_component_(Component *comp) {
   if (comp == nullptr) {
     ESP_LOGW(TAG, "Tried to register null component!");
@@ -55,13 +62,20 @@ void Application::setup() {
     } while (!component->can_proceed());
   }
 
+#ifdef ARDUINO_ARCH_ESP32
+  this->loop_task_ = xTaskGetCurrentTaskHandle();
+#endif
+
   ESP_LOGI(TAG, "setup() finished successfully!");
   this->schedule_dump_config();
   this->calculate_looping_components_();
+  this->build_key_indexes_();
 }
 void Application::loop() {
   uint32_t new_app_state = 0;
   const uint32_t start = millis();
+  this->wake_requested_ = false;
+  this->loop_count_++;
 
   this->scheduler.call();
   for (Component *component : this->looping_components_) {
@@ -82,6 +96,16 @@ void Application::loop() {
 
   if (HighFrequencyLoopRequester::is_high_frequency()) {
     yield();
+  } else if (this->tickless_) {
+    // Sleep until the next scheduler item is due or a component wants to loop again, whichever comes first.
+    // Scheduler items are clamped like below so that interval=0 schedules don't result in constant looping.
+    uint32_t delay_time = TICKLESS_MAX_SLEEP;
+    auto next_schedule = this->scheduler.next_schedule_in();
+    if (next_schedule.has_value())
+      delay_time = std::max(*next_schedule, this->loop_interval_ / 2);
+    for (Component *component : this->looping_components_)
+      delay_time = std::min(delay_time, component->next_wake_in());
+    this->sleep_(std::min(delay_time, TICKLESS_MAX_SLEEP));
   } else {
     uint32_t delay_time = this->loop_interval_;
     if (now - this->last_loop_ < this->loop_interval_)
@@ -106,6 +130,50 @@ void Application::loop() {
   }
 }
 
+void Application::sleep_(uint32_t delay_time) {
+  if (delay_time == 0) {
+    yield();
+    return;
+  }
+  // Set before checking wake_requested_, so that a wake_loop() in between still ends the sleep below.
+  this->sleeping_ = true;
+  if (this->wake_requested_) {
+    this->sleeping_ = false;
+    yield();
+    return;
+  }
+#ifdef ARDUINO_ARCH_ESP32
+  // wake_loop() gives a task notification, which ends the wait early
+  ulTaskNotifyTake(pdTRUE, std::max<TickType_t>(delay_time / portTICK_PERIOD_MS, 1));
+#else
+  // On the ESP8266, esp_schedule() from wake_loop() resumes the loop task and thus ends delay() early
+  delay(delay_time);
+#endif
+  this->sleeping_ = false;
+}
+void ICACHE_RAM_ATTR Application::wake_loop() {
+  this->wake_requested_ = true;
+  // Only interrupt our own sleep. On the ESP8266 esp_schedule() would also end any other delay() early, for
+  // example a sensor waiting for a conversion.
+  if (!this->sleeping_)
+    return;
+#ifdef ARDUINO_ARCH_ESP32
+  if (this->loop_task_ == nullptr)
+    return;
+  if (xPortInIsrContext()) {
+    BaseType_t higher_priority_task_woken = pdFALSE;
+    vTaskNotifyGiveFromISR(this->loop_task_, &higher_priority_task_woken);
+    if (higher_priority_task_woken)
+      portYIELD_FROM_ISR();
+  } else {
+    xTaskNotifyGive(this->loop_task_);
+  }
+#endif
+#ifdef ARDUINO_ARCH_ESP8266
+  esp_schedule();
+#endif
+}
+
 void ICACHE_RAM_ATTR HOT Application::feed_wdt() {
   static uint32_t LAST_FEED = 0;
   uint32_t now = millis();
@@ -153,6 +221,32 @@ void Application::calculate_looping_components_() {
       this->looping_components_.push_back(obj);
   }
 }
+void Application::build_key_indexes_() {
+#ifdef USE_BINARY_SENSOR
+  this->binary_sensor_index_.build(this->binary_sensors_);
+#endif
+#ifdef USE_SWITCH
+  this->switch_index_.build(this->switches_);
+#endif
+#ifdef USE_SENSOR
+  this->sensor_index_.build(this->sensors_);
+#endif
+#ifdef USE_TEXT_SENSOR
+  this->text_sensor_index_.build(this->text_sensors_);
+#endif
+#ifdef USE_FAN
+  this->fan_index_.build(this->fans_);
+#endif
+#ifdef USE_COVER
+  this->cover_index_.build(this->covers_);
+#endif
+#ifdef USE_LIGHT
+  this->light_index_.build(this->lights_);
+#endif
+#ifdef USE_CLIMATE
+  this->climate_index_.build(this->climates_);
+#endif
+}
 
 Application App;
 
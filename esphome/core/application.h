@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <string>
 #include <vector>
 #include "esphome/core/defines.h"
@@ -8,6 +9,11 @@
 #include "esphome/core/helpers.h"
 #include "esphome/core/scheduler.h"
 
+#ifdef ARDUINO_ARCH_ESP32
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
 #ifdef USE_BINARY_SENSOR
 #include "esphome/components/binary_sensor/binary_sensor.h"
 #endif
@@ -35,6 +41,42 @@
 
 namespace esphome {
 
+/** Index of entities sorted by object_id_hash, for O(log n) lookups of the keys used by the native API.
+ *
+ * Entities don't change after setup, so the index is built once at the end of Application::setup(). If entities are
+ * registered after that, the index is rebuilt on the next lookup.
+ */
+template<typename T> class EntityKeyIndex {
+ public:
+  void build(const std::vector<T *> &entities) {
+    this->entries_.clear();
+    this->entries_.reserve(entities.size());
+    for (auto *obj : entities)
+      this->entries_.push_back(Entry{obj->get_object_id_hash(), obj});
+    // Stable, so that the first registered entity wins for duplicate keys just like with a linear scan
+    std::stable_sort(this->entries_.begin(), this->entries_.end(),
+                     [](const Entry &a, const Entry &b) { return a.key < b.key; });
+  }
+  T *find(const std::vector<T *> &entities, uint32_t key, bool include_internal) {
+    if (this->entries_.size() != entities.size())
+      this->build(entities);
+    auto it = std::lower_bound(this->entries_.begin(), this->entries_.end(), key,
+                               [](const Entry &entry, uint32_t key) { return entry.key < key; });
+    for (; it != this->entries_.end() && it->key == key; ++it) {
+      if (include_internal || !it->obj->is_internal())
+        return it->obj;
+    }
+    return nullptr;
+  }
+
+ protected:
+  struct Entry {
+    uint32_t key;
+    T *obj;
+  };
+  std::vector<Entry> entries_;
+};
+
 class Application {
  public:
   void pre_setup(const std::string &name, const char *compilation_time) {
@@ -109,6 +151,26 @@ class Application {
    * @param loop_interval The interval in milliseconds to run the core loop at. Defaults to 16 milliseconds.
    */
   void set_loop_interval(uint32_t loop_interval) { this->loop_interval_ = loop_interval; }
+  uint32_t get_loop_interval() const { return this->loop_interval_; }
+
+  /** Enable tickless idle.
+   *
+   * Instead of waking up every loop interval, the main loop then sleeps until the next scheduler item is due
+   * or a looping component needs to run again (see Component::next_wake_in()), at most TICKLESS_MAX_SLEEP ms.
+   * Interrupt-driven components call wake_loop() to end the sleep early.
+   */
+  void set_tickless(bool tickless) { this->tickless_ = tickless; }
+  bool is_tickless() const { return this->tickless_; }
+
+  /** Wake the main loop if it's currently sleeping, so that all looping components run as soon as possible.
+   *
+   * Does nothing while the main loop is running (including any delay() of a component), the next sleep is then
+   * skipped instead. Safe to call from interrupt handlers and other tasks.
+   */
+  void wake_loop();
+
+  /// The number of main loop iterations since boot, used to measure wakeups per second.
+  uint32_t get_loop_count() const { return this->loop_count_; }
 
   void schedule_dump_config() { this->dump_config_at_ = 0; }
 
@@ -129,76 +191,54 @@ class Application {
 
   uint32_t get_app_state() const { return this->app_state_; }
 
+  const std::vector<Component *> &get_components() const { return this->components_; }
+
 #ifdef USE_BINARY_SENSOR
   const std::vector<binary_sensor::BinarySensor *> &get_binary_sensors() { return this->binary_sensors_; }
   binary_sensor::BinarySensor *get_binary_sensor_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->binary_sensors_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return this->binary_sensor_index_.find(this->binary_sensors_, key, include_internal);
   }
 #endif
 #ifdef USE_SWITCH
   const std::vector<switch_::Switch *> &get_switches() { return this->switches_; }
   switch_::Switch *get_switch_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->switches_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return this->switch_index_.find(this->switches_, key, include_internal);
   }
 #endif
 #ifdef USE_SENSOR
   const std::vector<sensor::Sensor *> &get_sensors() { return this->sensors_; }
   sensor::Sensor *get_sensor_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->sensors_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return this->sensor_index_.find(this->sensors_, key, include_internal);
   }
 #endif
 #ifdef USE_TEXT_SENSOR
   const std::vector<text_sensor::TextSensor *> &get_text_sensors() { return this->text_sensors_; }
   text_sensor::TextSensor *get_text_sensor_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->text_sensors_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return this->text_sensor_index_.find(this->text_sensors_, key, include_internal);
   }
 #endif
 #ifdef USE_FAN
   const std::vector<fan::FanState *> &get_fans() { return this->fans_; }
   fan::FanState *get_fan_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->fans_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return this->fan_index_.find(this->fans_, key, include_internal);
   }
 #endif
 #ifdef USE_COVER
   const std::vector<cover::Cover *> &get_covers() { return this->covers_; }
   cover::Cover *get_cover_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->covers_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return this->cover_index_.find(this->covers_, key, include_internal);
   }
 #endif
 #ifdef USE_LIGHT
   const std::vector<light::LightState *> &get_lights() { return this->lights_; }
   light::LightState *get_light_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->lights_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return this->light_index_.find(this->lights_, key, include_internal);
   }
 #endif
 #ifdef USE_CLIMATE
   const std::vector<climate::Climate *> &get_climates() { return this->climates_; }
   climate::Climate *get_climate_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->climates_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return this->climate_index_.find(this->climates_, key, include_internal);
   }
 #endif
 
@@ -211,38 +251,59 @@ class Application {
 
   void calculate_looping_components_();
 
+  void build_key_indexes_();
+
+  /// Sleep for at most delay_time ms, or until wake_loop() is called.
+  void sleep_(uint32_t delay_time);
+
   std::vector<Component *> components_{};
   std::vector<Component *> looping_components_{};
 
 #ifdef USE_BINARY_SENSOR
   std::vector<binary_sensor::BinarySensor *> binary_sensors_{};
+  EntityKeyIndex<binary_sensor::BinarySensor> binary_sensor_index_{};
 #endif
 #ifdef USE_SWITCH
   std::vector<switch_::Switch *> switches_{};
+  EntityKeyIndex<switch_::Switch> switch_index_{};
 #endif
 #ifdef USE_SENSOR
   std::vector<sensor::Sensor *> sensors_{};
+  EntityKeyIndex<sensor::Sensor> sensor_index_{};
 #endif
 #ifdef USE_TEXT_SENSOR
   std::vector<text_sensor::TextSensor *> text_sensors_{};
+  EntityKeyIndex<text_sensor::TextSensor> text_sensor_index_{};
 #endif
 #ifdef USE_FAN
   std::vector<fan::FanState *> fans_{};
+  EntityKeyIndex<fan::FanState> fan_index_{};
 #endif
 #ifdef USE_COVER
   std::vector<cover::Cover *> covers_{};
+  EntityKeyIndex<cover::Cover> cover_index_{};
 #endif
 #ifdef USE_CLIMATE
   std::vector<climate::Climate *> climates_{};
+  EntityKeyIndex<climate::Climate> climate_index_{};
 #endif
 #ifdef USE_LIGHT
   std::vector<light::LightState *> lights_{};
+  EntityKeyIndex<light::LightState> light_index_{};
 #endif
 
   std::string name_;
   std::string compilation_time_;
   uint32_t last_loop_{0};
   uint32_t loop_interval_{16};
+  bool tickless_{false};
+  volatile bool wake_requested_{false};
+  /// Whether the main loop is in sleep_(), i.e. whether wake_loop() needs to interrupt it.
+  volatile bool sleeping_{false};
+  uint32_t loop_count_{0};
+#ifdef ARDUINO_ARCH_ESP32
+  TaskHandle_t loop_task_{nullptr};
+#endif
   int dump_config_at_{-1};
   uint32_t app_state_{0};
 };
@@ -36,6 +36,27 @@ uint32_t global_state = 0;
 
 float Component::get_loop_priority() const { return 0.0f; }
 
+uint32_t Component::next_wake_in() { return App.get_loop_interval(); }
+
+#ifdef USE_COMPONENT_PROFILER
+const char *Component::get_component_source() const {
+  if (this->component_source_ == nullptr)
+    return "<unknown>";
+  return this->component_source_;
+}
+
+void HOT ComponentTimingStats::record(uint32_t duration_us) {
+  if (this->count == 0) {
+    this->ewma_us = duration_us;
+  } else {
+    this->ewma_us = int32_t(this->ewma_us) + (int32_t(duration_us) - int32_t(this->ewma_us)) / 16;
+  }
+  this->count++;
+  this->total_us += duration_us;
+  this->max_us = std::max(this->max_us, duration_us);
+}
+#endif
+
 float Component::get_setup_priority() const { return setup_priority::DATA; }
 
 void Component::setup() {}
@@ -46,24 +67,61 @@ void Component::set_interval(const std::string &name, uint32_t interval, std::fu
   App.scheduler.set_interval(this, name, interval, std::move(f));
 }
 
+void Component::set_interval(const char *name, uint32_t interval, std::function<void()> &&f) {  // NOLINT
+  App.scheduler.set_interval(this, name, interval, std::move(f));
+}
+
+void Component::set_interval(NameHash id, uint32_t interval, std::function<void()> &&f) {  // NOLINT
+  App.scheduler.set_interval(this, id, interval, std::move(f));
+}
+
 bool Component::cancel_interval(const std::string &name) {  // NOLINT
   return App.scheduler.cancel_interval(this, name);
 }
 
+bool Component::cancel_interval(const char *name) {  // NOLINT
+  return App.scheduler.cancel_interval(this, name);
+}
+
+bool Component::cancel_interval(NameHash id) {  // NOLINT
+  return App.scheduler.cancel_interval(this, id);
+}
+
 void Component::set_timeout(const std::string &name, uint32_t timeout, std::function<void()> &&f) {  // NOLINT
-  return App.scheduler.set_timeout(this, name, timeout, std::move(f));
+  App.scheduler.set_timeout(this, name, timeout, std::move(f));
+}
+
+void Component::set_timeout(const char *name, uint32_t timeout, std::function<void()> &&f) {  // NOLINT
+  App.scheduler.set_timeout(this, name, timeout, std::move(f));
+}
+
+void Component::set_timeout(NameHash id, uint32_t timeout, std::function<void()> &&f) {  // NOLINT
+  App.scheduler.set_timeout(this, id, timeout, std::move(f));
 }
 
 bool Component::cancel_timeout(const std::string &name) {  // NOLINT
   return App.scheduler.cancel_timeout(this, name);
 }
 
+bool Component::cancel_timeout(const char *name) {  // NOLINT
+  return App.scheduler.cancel_timeout(this, name);
+}
+
+bool Component::cancel_timeout(NameHash id) {  // NOLINT
+  return App.scheduler.cancel_timeout(this, id);
+}
+
 void Component::call_loop() { this->loop(); }
 
 void Component::call_setup() { this->setup(); }
 uint32_t Component::get_component_state() const { return this->component_state_; }
 void Component::call() {
   uint32_t state = this->component_state_ & COMPONENT_STATE_MASK;
+#ifdef USE_COMPONENT_PROFILER
+  if (state == COMPONENT_STATE_FAILED)
+    return;
+  ComponentProfileScope scope(state == COMPONENT_STATE_CONSTRUCTION ? this->profile_.setup : this->profile_.loop);
+#endif
   switch (state) {
     case COMPONENT_STATE_CONSTRUCTION:
       // State Construction: Call setup and set state to setup
@@ -96,12 +154,28 @@ void Component::mark_failed() {
 }
 void Component::defer(std::function<void()> &&f) {  // NOLINT
   App.scheduler.set_timeout(this, "", 0, std::move(f));
+  App.wake_loop();
 }
 bool Component::cancel_defer(const std::string &name) {  // NOLINT
   return App.scheduler.cancel_timeout(this, name);
 }
+bool Component::cancel_defer(const char *name) {  // NOLINT
+  return App.scheduler.cancel_timeout(this, name);
+}
+bool Component::cancel_defer(NameHash id) {  // NOLINT
+  return App.scheduler.cancel_timeout(this, id);
+}
 void Component::defer(const std::string &name, std::function<void()> &&f) {  // NOLINT
   App.scheduler.set_timeout(this, name, 0, std::move(f));
+  App.wake_loop();
+}
+void Component::defer(const char *name, std::function<void()> &&f) {  // NOLINT
+  App.scheduler.set_timeout(this, name, 0, std::move(f));
+  App.wake_loop();
+}
+void Component::defer(NameHash id, std::function<void()> &&f) {  // NOLINT
+  App.scheduler.set_timeout(this, id, 0, std::move(f));
+  App.wake_loop();
 }
 void Component::set_timeout(uint32_t timeout, std::function<void()> &&f) {  // NOLINT
   App.scheduler.set_timeout(this, "", timeout, std::move(f));
@@ -160,7 +234,12 @@ void PollingComponent::call_setup() {
   this->setup();
 
   // Register interval.
-  this->set_interval("update", this->get_update_interval(), [this]() { this->update(); });
+  this->set_interval("update", this->get_update_interval(), [this]() {
+#ifdef USE_COMPONENT_PROFILER
+    ComponentProfileScope scope(this->profile_.update);
+#endif
+    this->update();
+  });
 }
 
 uint32_t PollingComponent::get_update_interval() const { return this->update_interval_; }
@@ -4,7 +4,9 @@
 #include <functional>
 #include "Arduino.h"
 
+#include "esphome/core/defines.h"
 #include "esphome/core/optional.h"
+#include "esphome/core/helpers.h"
 
 namespace esphome {
 
@@ -53,6 +55,42 @@ extern const uint32_t STATUS_LED_OK;
 extern const uint32_t STATUS_LED_WARNING;
 extern const uint32_t STATUS_LED_ERROR;
 
+#ifdef USE_COMPONENT_PROFILER
+/// Execution time statistics of one kind of component callback.
+struct ComponentTimingStats {
+  /// Number of calls.
+  uint32_t count{0};
+  /// Total time spent in all calls, in microseconds.
+  uint64_t total_us{0};
+  /// Duration of the longest call, in microseconds.
+  uint32_t max_us{0};
+  /// Exponentially weighted moving average of the call duration (alpha=1/16), in microseconds.
+  uint32_t ewma_us{0};
+
+  void record(uint32_t duration_us);
+};
+
+/// Per-component timing statistics, collected if USE_COMPONENT_PROFILER is defined.
+struct ComponentProfile {
+  ComponentTimingStats setup;
+  ComponentTimingStats loop;
+  /// All scheduler callbacks of the component, including update() of polling components.
+  ComponentTimingStats scheduler;
+  ComponentTimingStats update;
+};
+
+/// Measures the time until this object goes out of scope and records it in stats.
+class ComponentProfileScope {
+ public:
+  explicit ComponentProfileScope(ComponentTimingStats &stats) : stats_(stats), start_(micros()) {}
+  ~ComponentProfileScope() { this->stats_.record(micros() - this->start_); }
+
+ protected:
+  ComponentTimingStats &stats_;
+  uint32_t start_;
+};
+#endif
+
 class Component {
  public:
   /** Where the component's initialization should happen.
@@ -91,6 +129,17 @@ class Component {
    */
   virtual float get_loop_priority() const;
 
+  /** How long (in ms) loop() can be skipped from now on when the application runs tickless.
+   *
+   * Only used if tickless idle is enabled (see Application::set_tickless()), in which case the main loop sleeps
+   * until the earliest next wake of all looping components or the next scheduler item. loop() may still be
+   * called more often than that. Components that only react to interrupts or network callbacks should return a
+   * large value and call App.wake_loop() (or defer()) from the callback instead.
+   *
+   * Defaults to the application loop interval, i.e. loop() is polled like without tickless idle.
+   */
+  virtual uint32_t next_wake_in();
+
   void call();
 
   virtual void on_shutdown() {}
@@ -128,6 +177,13 @@ class Component {
 
   bool has_overridden_loop() const;
 
+#ifdef USE_COMPONENT_PROFILER
+  /// Set the ID this component was generated with, used to attribute the profiling data.
+  void set_component_source(const char *source) { this->component_source_ = source; }
+  const char *get_component_source() const;
+  ComponentProfile &get_profile() { return this->profile_; }
+#endif
+
  protected:
   virtual void call_loop();
   virtual void call_setup();
@@ -147,6 +203,10 @@ class Component {
    * @see cancel_interval()
    */
   void set_interval(const std::string &name, uint32_t interval, std::function<void()> &&f);  // NOLINT
+  /// Same as above, for string literals (no std::string construction).
+  void set_interval(const char *name, uint32_t interval, std::function<void()> &&f);  // NOLINT
+  /// Same as above, with a precomputed name ID, see NameHash.
+  void set_interval(NameHash id, uint32_t interval, std::function<void()> &&f);  // NOLINT
 
   void set_interval(uint32_t interval, std::function<void()> &&f);  // NOLINT
 
@@ -156,6 +216,8 @@ class Component {
    * @return Whether an interval functions was deleted.
    */
   bool cancel_interval(const std::string &name);  // NOLINT
+  bool cancel_interval(const char *name);         // NOLINT
+  bool cancel_interval(NameHash id);              // NOLINT
 
   void set_timeout(uint32_t timeout, std::function<void()> &&f);  // NOLINT
 
@@ -174,6 +236,10 @@ class Component {
    * @see cancel_timeout()
    */
   void set_timeout(const std::string &name, uint32_t timeout, std::function<void()> &&f);  // NOLINT
+  /// Same as above, for string literals (no std::string construction).
+  void set_timeout(const char *name, uint32_t timeout, std::function<void()> &&f);  // NOLINT
+  /// Same as above, with a precomputed name ID, see NameHash.
+  void set_timeout(NameHash id, uint32_t timeout, std::function<void()> &&f);  // NOLINT
 
   /** Cancel a timeout function.
    *
@@ -181,24 +247,36 @@ class Component {
    * @return Whether a timeout functions was deleted.
    */
   bool cancel_timeout(const std::string &name);  // NOLINT
+  bool cancel_timeout(const char *name);         // NOLINT
+  bool cancel_timeout(NameHash id);              // NOLINT
 
   /** Defer a callback to the next loop() call.
    *
    * If name is specified and a defer() object with the same name exists, the old one is first removed.
    *
+   * Network callbacks use this to hand work to the main loop, so it also ends a tickless sleep.
+   *
    * @param name The name of the defer function.
    * @param f The callback.
    */
   void defer(const std::string &name, std::function<void()> &&f);  // NOLINT
+  void defer(const char *name, std::function<void()> &&f);         // NOLINT
+  void defer(NameHash id, std::function<void()> &&f);              // NOLINT
 
   /// Defer a callback to the next loop() call.
   void defer(std::function<void()> &&f);  // NOLINT
 
   /// Cancel a defer callback using the specified name, name must not be empty.
   bool cancel_defer(const std::string &name);  // NOLINT
+  bool cancel_defer(const char *name);         // NOLINT
+  bool cancel_defer(NameHash id);              // NOLINT
 
   uint32_t component_state_{0x0000};  ///< State of this component.
   float setup_priority_override_{NAN};
+#ifdef USE_COMPONENT_PROFILER
+  const char *component_source_{nullptr};
+  ComponentProfile profile_;
+#endif
 };
 
 /** This class simplifies creating components that periodically check a state.
@@ -19,6 +19,11 @@ namespace esphome {
 
 static const char *TAG = "esphal";
 
+#ifdef USE_HOST
+/// Simulated GPIO input/output register for host builds, writes are looped back to reads.
+static volatile uint32_t host_gpio_state = 0;
+#endif
+
 GPIOPin::GPIOPin(uint8_t pin, uint8_t mode, bool inverted)
     : pin_(pin),
       mode_(mode),
@@ -33,6 +38,10 @@ GPIOPin::GPIOPin(uint8_t pin, uint8_t mode, bool inverted)
       gpio_read_(pin < 32 ? &GPIO.in : &GPIO.in1.val),
       gpio_mask_(pin < 32 ? (1UL << pin) : (1UL << (pin - 32)))
 #endif
+#ifdef USE_HOST
+      gpio_read_(&host_gpio_state),
+      gpio_mask_(1UL << (pin % 32))
+#endif
 {
 }
 
@@ -147,6 +156,13 @@ void ICACHE_RAM_ATTR HOT GPIOPin::digital_write(bool value) {
     (*this->gpio_clear_) = this->gpio_mask_;
   }
 #endif
+#ifdef USE_HOST
+  if (value != this->inverted_) {
+    host_gpio_state |= this->gpio_mask_;
+  } else {
+    host_gpio_state &= ~this->gpio_mask_;
+  }
+#endif
 }
 void ICACHE_RAM_ATTR HOT ISRInternalGPIOPin::digital_write(bool value) {
 #ifdef ARDUINO_ARCH_ESP8266
@@ -171,6 +187,13 @@ void ICACHE_RAM_ATTR HOT ISRInternalGPIOPin::digital_write(bool value) {
     (*this->gpio_clear_) = this->gpio_mask_;
   }
 #endif
+#ifdef USE_HOST
+  if (value != this->inverted_) {
+    host_gpio_state |= this->gpio_mask_;
+  } else {
+    host_gpio_state &= ~this->gpio_mask_;
+  }
+#endif
 }
 ISRInternalGPIOPin::ISRInternalGPIOPin(uint8_t pin,
 #ifdef ARDUINO_ARCH_ESP32
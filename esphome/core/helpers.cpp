@@ -18,6 +18,9 @@ static const char *TAG = "helpers";
 std::string get_mac_address() {
   char tmp[20];
   uint8_t mac[6];
+#ifdef USE_HOST
+  memset(mac, 0, sizeof(mac));
+#endif
 #ifdef ARDUINO_ARCH_ESP32
   esp_efuse_mac_get_default(mac);
 #endif
@@ -31,6 +34,9 @@ std::string get_mac_address() {
 std::string get_mac_address_pretty() {
   char tmp[20];
   uint8_t mac[6];
+#ifdef USE_HOST
+  memset(mac, 0, sizeof(mac));
+#endif
 #ifdef ARDUINO_ARCH_ESP32
   esp_efuse_mac_get_default(mac);
 #endif
@@ -323,5 +329,9 @@ ICACHE_RAM_ATTR InterruptLock::~InterruptLock() { xt_wsr_ps(xt_state_); }
 ICACHE_RAM_ATTR InterruptLock::InterruptLock() { portDISABLE_INTERRUPTS(); }
 ICACHE_RAM_ATTR InterruptLock::~InterruptLock() { portENABLE_INTERRUPTS(); }
 #endif
+#ifdef USE_HOST
+InterruptLock::InterruptLock() {}
+InterruptLock::~InterruptLock() {}
+#endif
 
 }  // namespace esphome
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <string>
 #include <functional>
 #include <vector>
@@ -301,6 +302,50 @@ template<typename T> class Deduplicator {
   T last_value_{};
 };
 
+/** Set of objects whose latest state still has to be sent, for controllers with a congested connection.
+ *
+ * Only the object is stored, not its state: the current state is read from the object when flushing. So a slow
+ * client converges to the latest state instead of losing updates, and memory is bounded by the number of objects.
+ *
+ * @tparam T The object type, tag can be used to tell apart different kinds of objects.
+ */
+template<typename T> class DirtySet {
+ public:
+  /// Mark obj dirty, this is a no-op if it's already dirty.
+  void mark(T *obj, uint8_t tag = 0) {
+    for (auto &item : this->items_) {
+      if (item.obj == obj && item.tag == tag)
+        return;
+    }
+    this->items_.push_back(Item{obj, tag});
+  }
+  /** Call send(obj, tag) for the dirty objects in the order they were marked.
+   *
+   * Stops at the first object send() returns false for, that object and all following stay dirty.
+   * send() may mark objects dirty itself.
+   */
+  template<typename F> void flush(F &&send) {
+    size_t sent = 0;
+    while (sent < this->items_.size()) {
+      const Item item = this->items_[sent];
+      if (!send(item.obj, item.tag))
+        break;
+      sent++;
+    }
+    this->items_.erase(this->items_.begin(), this->items_.begin() + sent);
+  }
+  bool empty() const { return this->items_.empty(); }
+  size_t size() const { return this->items_.size(); }
+  void clear() { this->items_.clear(); }
+
+ protected:
+  struct Item {
+    T *obj;
+    uint8_t tag;
+  };
+  std::vector<Item> items_;
+};
+
 template<typename T> class Parented {
  public:
   Parented() {}
@@ -314,5 +359,21 @@ template<typename T> class Parented {
 };
 
 uint32_t fnv1_hash(const std::string &str);
+/// Calculate a FNV-1 hash of str, same result as the std::string overload. Can be evaluated at compile time.
+constexpr uint32_t fnv1_hash(const char *str, uint32_t hash = 2166136261UL) {
+  return *str == '\0' ? hash : fnv1_hash(str + 1, uint32_t(hash * 16777619UL) ^ *str);
+}
+
+/** A precomputed scheduler name ID, the fnv1_hash() of the name.
+ *
+ * A distinct type instead of a plain uint32_t, so that the ID overloads of set_timeout() etc. can't be confused with
+ * the name (a literal 0 would be ambiguous with a const char * name) or the timeout.
+ */
+struct NameHash {
+  constexpr explicit NameHash(uint32_t hash) : hash(hash) {}
+  constexpr explicit NameHash(const char *name) : hash(fnv1_hash(name)) {}
+
+  uint32_t hash;
+};
 
 }  // namespace esphome
@@ -1,6 +1,6 @@
-#include "log.h"
-#include "defines.h"
-#include "helpers.h"
+#include "esphome/core/log.h"
+#include "esphome/core/defines.h"
+#include "esphome/core/helpers.h"
 
 #ifdef USE_LOGGER
 #include "esphome/components/logger/logger.h"
@@ -288,6 +288,33 @@ void ESPPreferences::begin() {
   }
 }
 
+ESPPreferenceObject ESPPreferences::make_preference(size_t length, uint32_t type, bool in_flash) {
+  auto pref = ESPPreferenceObject(this->current_offset_, length, type);
+  this->current_offset_++;
+  return pref;
+}
+#endif
+
+#ifdef USE_HOST
+bool ESPPreferenceObject::save_internal_() {
+  auto &stored = global_preferences.host_storage_[this->offset_];
+  stored.assign(this->data_, this->data_ + this->length_words_ + 1);
+  return true;
+}
+bool ESPPreferenceObject::load_internal_() {
+  auto it = global_preferences.host_storage_.find(this->offset_);
+  if (it == global_preferences.host_storage_.end())
+    return false;
+  if (it->second.size() != this->length_words_ + 1) {
+    ESP_LOGVV(TAG, "Host storage length does not match. Assuming key changed");
+    return false;
+  }
+  std::copy(it->second.begin(), it->second.end(), this->data_);
+  return true;
+}
+ESPPreferences::ESPPreferences() : current_offset_(0) {}
+void ESPPreferences::begin() {}
+
 ESPPreferenceObject ESPPreferences::make_preference(size_t length, uint32_t type, bool in_flash) {
   auto pref = ESPPreferenceObject(this->current_offset_, length, type);
   this->current_offset_++;
@@ -1,6 +1,10 @@
 #pragma once
 
 #include <string>
+#ifdef USE_HOST
+#include <map>
+#include <vector>
+#endif
 
 #include "esphome/core/esphal.h"
 #include "esphome/core/defines.h"
@@ -49,6 +53,10 @@ static bool DEFAULT_IN_FLASH = false;
 static bool DEFAULT_IN_FLASH = true;
 #endif
 
+#ifdef USE_HOST
+static bool DEFAULT_IN_FLASH = true;
+#endif
+
 class ESPPreferences {
  public:
   ESPPreferences();
@@ -75,6 +83,9 @@ class ESPPreferences {
 #ifdef ARDUINO_ARCH_ESP32
   uint32_t nvs_handle_;
 #endif
+#ifdef USE_HOST
+  std::map<uint32_t, std::vector<uint32_t>> host_storage_;
+#endif
 #ifdef ARDUINO_ARCH_ESP8266
   void save_esp8266_flash_();
   bool prevent_write_{false};
@@ -8,240 +8,462 @@ namespace esphome {
 static const char *TAG = "scheduler";
 
 static const uint32_t SCHEDULER_DONT_RUN = 4294967295UL;
+static const uint32_t SCHEDULER_INITIAL_NAME_BUCKETS = 16;
+
+/// Distance from bit from to the next set bit of bits, wrapping around, or -1 if no bit is set.
+static inline int next_set_bit(uint32_t bits, uint8_t from) {
+  if (from != 0)
+    bits = (bits >> from) | (bits << (32 - from));
+  return bits == 0 ? -1 : __builtin_ctz(bits);
+}
 
 // Uncomment to debug scheduler
 // #define ESPHOME_DEBUG_SCHEDULER
 
-void HOT Scheduler::set_timeout(Component *component, const std::string &name, uint32_t timeout,
-                                std::function<void()> &&func) {
-  const uint32_t now = this->millis_();
+Scheduler::~Scheduler() {
+  for (auto &level : this->wheel_)
+    for (SchedulerItem *head : level)
+      delete_list_(head);
+  delete_list_(this->ready_);
+  delete_list_(this->to_add_);
+  delete_list_(this->free_items_);
+}
+Scheduler::Handle HOT Scheduler::set_timeout(Component *component, const std::string &name, uint32_t timeout,
+                                             std::function<void()> &&func) {
+  return this->set_timeout_(component, !name.empty(), fnv1_hash(name), timeout, std::move(func));
+}
+Scheduler::Handle HOT Scheduler::set_timeout(Component *component, const char *name, uint32_t timeout,
+                                             std::function<void()> &&func) {
+  const bool named = name != nullptr && *name != '\0';
+  return this->set_timeout_(component, named, named ? fnv1_hash(name) : 0, timeout, std::move(func));
+}
+Scheduler::Handle HOT Scheduler::set_timeout(Component *component, NameHash id, uint32_t timeout,
+                                             std::function<void()> &&func) {
+  return this->set_timeout_(component, true, id.hash, timeout, std::move(func));
+}
+Scheduler::Handle HOT Scheduler::set_timeout_(Component *component, bool named, uint32_t name_hash, uint32_t timeout,
+                                              std::function<void()> &&func) {
+  const uint64_t now = this->millis_();
 
-  if (!name.empty())
-    this->cancel_timeout(component, name);
+  if (named)
+    this->cancel_item_(component, name_hash, SchedulerItem::TIMEOUT);
 
   if (timeout == SCHEDULER_DONT_RUN)
-    return;
+    return {};
 
-  ESP_LOGVV(TAG, "set_timeout(name='%s', timeout=%u)", name.c_str(), timeout);
+  ESP_LOGVV(TAG, "set_timeout(name=0x%08X, timeout=%u)", name_hash, timeout);
 
-  auto item = make_unique<SchedulerItem>();
-  item->component = component;
-  item->name = name;
-  item->type = SchedulerItem::TIMEOUT;
-  item->timeout = timeout;
-  item->last_execution = now;
-  item->last_execution_major = this->millis_major_;
-  item->f = std::move(func);
-  item->remove = false;
-  this->push_(std::move(item));
+  return this->push_(component, named, name_hash, SchedulerItem::TIMEOUT, timeout, now + timeout, std::move(func));
 }
 bool HOT Scheduler::cancel_timeout(Component *component, const std::string &name) {
-  return this->cancel_item_(component, name, SchedulerItem::TIMEOUT);
+  return !name.empty() && this->cancel_item_(component, fnv1_hash(name), SchedulerItem::TIMEOUT);
+}
+bool HOT Scheduler::cancel_timeout(Component *component, const char *name) {
+  return name != nullptr && *name != '\0' && this->cancel_item_(component, fnv1_hash(name), SchedulerItem::TIMEOUT);
+}
+bool HOT Scheduler::cancel_timeout(Component *component, NameHash id) {
+  return this->cancel_item_(component, id.hash, SchedulerItem::TIMEOUT);
 }
-void HOT Scheduler::set_interval(Component *component, const std::string &name, uint32_t interval,
-                                 std::function<void()> &&func) {
-  const uint32_t now = this->millis_();
+Scheduler::Handle HOT Scheduler::set_interval(Component *component, const std::string &name, uint32_t interval,
+                                              std::function<void()> &&func) {
+  return this->set_interval_(component, !name.empty(), fnv1_hash(name), interval, std::move(func));
+}
+Scheduler::Handle HOT Scheduler::set_interval(Component *component, const char *name, uint32_t interval,
+                                              std::function<void()> &&func) {
+  const bool named = name != nullptr && *name != '\0';
+  return this->set_interval_(component, named, named ? fnv1_hash(name) : 0, interval, std::move(func));
+}
+Scheduler::Handle HOT Scheduler::set_interval(Component *component, NameHash id, uint32_t interval,
+                                              std::function<void()> &&func) {
+  return this->set_interval_(component, true, id.hash, interval, std::move(func));
+}
+Scheduler::Handle HOT Scheduler::set_interval_(Component *component, bool named, uint32_t name_hash,
+                                               uint32_t interval, std::function<void()> &&func) {
+  const uint64_t now = this->millis_();
 
-  if (!name.empty())
-    this->cancel_interval(component, name);
+  if (named)
+    this->cancel_item_(component, name_hash, SchedulerItem::INTERVAL);
 
   if (interval == SCHEDULER_DONT_RUN)
-    return;
+    return {};
 
   // only put offset in lower half
   uint32_t offset = 0;
   if (interval != 0)
     offset = (random_uint32() % interval) / 2;
 
-  ESP_LOGVV(TAG, "set_interval(name='%s', interval=%u, offset=%u)", name.c_str(), interval, offset);
+  ESP_LOGVV(TAG, "set_interval(name=0x%08X, interval=%u, offset=%u)", name_hash, interval, offset);
 
-  auto item = make_unique<SchedulerItem>();
-  item->component = component;
-  item->name = name;
-  item->type = SchedulerItem::INTERVAL;
-  item->interval = interval;
-  item->last_execution = now - offset - interval;
-  item->last_execution_major = this->millis_major_;
-  if (item->last_execution > now)
-    item->last_execution_major--;
-  item->f = std::move(func);
-  item->remove = false;
-  this->push_(std::move(item));
+  // First execution is right away, following ones are phase-shifted by offset.
+  // Right after boot now can be smaller than offset, don't let the 64-bit time underflow.
+  const uint64_t first = now > offset ? now - offset : 0;
+  return this->push_(component, named, name_hash, SchedulerItem::INTERVAL, interval, first, std::move(func));
 }
 bool HOT Scheduler::cancel_interval(Component *component, const std::string &name) {
-  return this->cancel_item_(component, name, SchedulerItem::INTERVAL);
+  return !name.empty() && this->cancel_item_(component, fnv1_hash(name), SchedulerItem::INTERVAL);
+}
+bool HOT Scheduler::cancel_interval(Component *component, const char *name) {
+  return name != nullptr && *name != '\0' && this->cancel_item_(component, fnv1_hash(name), SchedulerItem::INTERVAL);
+}
+bool HOT Scheduler::cancel_interval(Component *component, NameHash id) {
+  return this->cancel_item_(component, id.hash, SchedulerItem::INTERVAL);
+}
+bool HOT Scheduler::cancel(const Handle &handle) {
+  SchedulerItem *item = handle.item_;
+  if (item == nullptr || item->generation != handle.generation_ || item->remove)
+    return false;
+  this->cancel_item_(item);
+  return true;
 }
 optional<uint32_t> HOT Scheduler::next_schedule_in() {
-  if (this->empty_())
+  if (this->wheel_count_ == 0 && this->to_add_ == nullptr)
     return {};
-  auto &item = this->items_[0];
-  const uint32_t now = this->millis_();
-  uint32_t next_time = item->last_execution + item->interval;
-  if (next_time < now)
+
+  const uint64_t now = this->millis_();
+  uint64_t next_time = UINT64_MAX;
+  for (SchedulerItem *item = this->to_add_; item != nullptr; item = item->next)
+    next_time = std::min(next_time, item->next_execution);
+
+  if (this->wheel_count_ != 0) {
+    // Lowest level: each slot holds the items of exactly one millisecond
+    for (uint8_t k = 0; k < SCHEDULER_WHEEL_SLOTS; k++) {
+      if (this->wheel_[0][(this->wheel_time_ + k) & (SCHEDULER_WHEEL_SLOTS - 1)] != nullptr) {
+        next_time = std::min(next_time, this->wheel_time_ + k);
+        break;
+      }
+    }
+    // Higher levels: items are due no earlier than the start of their slot's span
+    for (uint8_t level = 1; level < SCHEDULER_WHEEL_LEVELS; level++) {
+      const uint8_t shift = level * SCHEDULER_WHEEL_BITS;
+      const uint64_t current = this->wheel_time_ >> shift;
+      // On a cascade boundary the current slot has not been cascaded yet, its items are due from wheel_time_ on
+      const uint8_t first = (this->wheel_time_ & ((1ULL << shift) - 1)) == 0 ? 0 : 1;
+      for (uint8_t k = first; k < first + SCHEDULER_WHEEL_SLOTS; k++) {
+        if (this->wheel_[level][(current + k) & (SCHEDULER_WHEEL_SLOTS - 1)] != nullptr) {
+          next_time = std::min(next_time, (current + k) << shift);
+          break;
+        }
+      }
+    }
+  }
+
+  if (next_time <= now)
     return 0;
-  return next_time - now;
+  return std::min<uint64_t>(next_time - now, UINT32_MAX);
 }
 void ICACHE_RAM_ATTR HOT Scheduler::call() {
-  const uint32_t now = this->millis_();
+  const uint64_t now = this->millis_();
   this->process_to_add();
 
 #ifdef ESPHOME_DEBUG_SCHEDULER
-  static uint32_t last_print = 0;
+  static uint64_t last_print = 0;
 
   if (now - last_print > 2000) {
     last_print = now;
-    std::vector<std::unique_ptr<SchedulerItem>> old_items;
-    ESP_LOGVV(TAG, "Items: count=%u, now=%u", this->items_.size(), now);
-    while (!this->empty_()) {
-      auto item = std::move(this->items_[0]);
-      const char *type = item->type == SchedulerItem::INTERVAL ? "interval" : "timeout";
-      ESP_LOGVV(TAG, "  %s '%s' interval=%u last_execution=%u (%u) next=%u (%u)", type, item->name.c_str(),
-                item->interval, item->last_execution, item->last_execution_major, item->next_execution(),
-                item->next_execution_major());
-
-      this->pop_raw_();
-      old_items.push_back(std::move(item));
+    ESP_LOGVV(TAG, "Items: count=%u, now=%u (%u)", this->wheel_count_, uint32_t(now), uint32_t(now >> 32));
+    for (uint8_t level = 0; level < SCHEDULER_WHEEL_LEVELS; level++) {
+      for (uint8_t slot = 0; slot < SCHEDULER_WHEEL_SLOTS; slot++) {
+        for (SchedulerItem *item = this->wheel_[level][slot]; item != nullptr; item = item->next) {
+          const char *type = item->type == SchedulerItem::INTERVAL ? "interval" : "timeout";
+          ESP_LOGVV(TAG, "  %s 0x%08X interval=%u next=%u (%u) level=%u slot=%u", type, item->name_hash,
+                    item->interval, uint32_t(item->next_execution), uint32_t(item->next_execution >> 32), level, slot);
+        }
+      }
     }
     ESP_LOGVV(TAG, "\n");
-    this->items_ = std::move(old_items);
   }
 #endif  // ESPHOME_DEBUG_SCHEDULER
 
-  while (!this->empty_()) {
-    // use scoping to indicate visibility of `item` variable
-    {
-      // Don't copy-by value yet
-      auto &item = this->items_[0];
-      if ((now - item->last_execution) < item->interval)
-        // Not reached timeout yet, done for this call
-        break;
-      uint8_t major = item->next_execution_major();
-      if (this->millis_major_ - major > 1)
-        break;
+  if (this->wheel_count_ == 0) {
+    // Nothing scheduled, fast-forward the wheel
+    this->wheel_time_ = now + 1;
+  }
 
-      // Don't run on failed components
-      if (item->component != nullptr && item->component->is_failed()) {
-        this->pop_raw_();
-        continue;
+  while (this->wheel_time_ <= now) {
+    const uint8_t index = this->wheel_time_ & (SCHEDULER_WHEEL_SLOTS - 1);
+    if (index == 0) {
+      // Move items from higher levels down once the lower level wrapped around
+      for (uint8_t level = 1; level < SCHEDULER_WHEEL_LEVELS; level++) {
+        this->cascade_(level);
+        if (((this->wheel_time_ >> (level * SCHEDULER_WHEEL_BITS)) & (SCHEDULER_WHEEL_SLOTS - 1)) != 0)
+          break;
       }
+    }
+
+    SchedulerItem *&slot = this->wheel_[0][index];
+    this->wheel_occupied_[0] &= ~(1UL << index);
+    if (slot != nullptr) {
+      // Move the whole slot to the ready list
+      this->ready_ = slot;
+      this->ready_->pprev = &this->ready_;
+      slot = nullptr;
+      this->run_ready_(now);
+    }
+
+    // Skip the empty slots, after a long blocking call or sleep the wheel can be many ticks behind
+    if (this->wheel_count_ == 0) {
+      this->wheel_time_ = now + 1;
+    } else {
+      this->wheel_time_ = this->next_wheel_event_(now + 1);
+    }
+  }
+
+  this->process_to_add();
+}
+void HOT Scheduler::run_ready_(uint64_t now) {
+  while (this->ready_ != nullptr) {
+    SchedulerItem *item = this->ready_;
+    // Unlink before calling, so that a cancel() from within f() does not release the item under our feet
+    unlink_(item);
+    item->in_wheel = false;
+    this->wheel_count_--;
+
+    // Don't run on failed components
+    if (item->component != nullptr && item->component->is_failed()) {
+      this->release_(item);
+      continue;
+    }
 
 #ifdef ESPHOME_LOG_HAS_VERY_VERBOSE
-      const char *type = item->type == SchedulerItem::INTERVAL ? "interval" : "timeout";
-      ESP_LOGVV(TAG, "Running %s '%s' with interval=%u last_execution=%u (now=%u)", type, item->name.c_str(),
-                item->interval, item->last_execution, now);
+    const char *type = item->type == SchedulerItem::INTERVAL ? "interval" : "timeout";
+    ESP_LOGVV(TAG, "Running %s 0x%08X with interval=%u next_execution=%u (now=%u)", type, item->name_hash,
+              item->interval, uint32_t(item->next_execution), uint32_t(now));
 #endif
 
-      // Warning: During f(), a lot of stuff can happen, including:
-      //  - timeouts/intervals get added, potentially invalidating vector pointers
-      //  - timeouts/intervals get cancelled
+    // Warning: During f(), a lot of stuff can happen, including:
+    //  - timeouts/intervals get added (those go to to_add_ and only run on the next call())
+    //  - timeouts/intervals get cancelled (including this one)
+#ifdef USE_COMPONENT_PROFILER
+    if (item->component != nullptr) {
+      ComponentProfileScope scope(item->component->get_profile().scheduler);
+      item->f();
+    } else {
       item->f();
     }
+#else
+    item->f();
+#endif
 
-    {
-      // new scope, item from before might have been moved in the vector
-      auto item = std::move(this->items_[0]);
-
-      // Only pop after function call, this ensures we were reachable
-      // during the function call and know if we were cancelled.
-      this->pop_raw_();
-
-      if (item->remove) {
-        // We were removed/cancelled in the function call, stop
-        continue;
-      }
+    if (item->remove || item->type == SchedulerItem::TIMEOUT) {
+      // We were removed/cancelled in the function call or are done
+      this->release_(item);
+      continue;
+    }
 
-      if (item->type == SchedulerItem::INTERVAL) {
-        if (item->interval != 0) {
-          const uint32_t before = item->last_execution;
-          const uint32_t amount = (now - item->last_execution) / item->interval;
-          item->last_execution += amount * item->interval;
-          if (item->last_execution < before)
-            item->last_execution_major++;
-        }
-        this->push_(std::move(item));
-      }
+    if (item->interval != 0) {
+      const uint64_t amount = (now - item->next_execution) / item->interval + 1;
+      item->next_execution += amount * item->interval;
+    } else {
+      item->next_execution = now;
     }
+    link_(&this->to_add_, item);
   }
-
-  this->process_to_add();
 }
 void HOT Scheduler::process_to_add() {
-  for (auto &it : this->to_add_) {
-    if (it->remove) {
-      continue;
-    }
+  if (this->to_add_ == nullptr)
+    return;
+  if (this->wheel_count_ == 0) {
+    // Empty wheel, we are free to move the wheel to the current time
+    this->wheel_time_ = this->millis_();
+  }
 
-    this->items_.push_back(std::move(it));
-    std::push_heap(this->items_.begin(), this->items_.end(), SchedulerItem::cmp);
+  while (this->to_add_ != nullptr) {
+    SchedulerItem *item = this->to_add_;
+    unlink_(item);
+    this->insert_(item);
   }
-  this->to_add_.clear();
 }
-void HOT Scheduler::cleanup_() {
-  while (!this->items_.empty()) {
-    auto &item = this->items_[0];
-    if (!item->remove)
-      return;
+void HOT Scheduler::insert_(SchedulerItem *item) {
+  uint64_t expires = std::max(item->next_execution, this->wheel_time_);
+  uint64_t delta = expires - this->wheel_time_;
+  uint8_t level = 0;
+  while (level + 1 < SCHEDULER_WHEEL_LEVELS && delta >= (1ULL << ((level + 1) * SCHEDULER_WHEEL_BITS)))
+    level++;
+  const uint64_t max_delta = (1ULL << (SCHEDULER_WHEEL_LEVELS * SCHEDULER_WHEEL_BITS)) - 1;
+  if (delta > max_delta) {
+    // Too far in the future, park in the highest level. It will be re-inserted on cascade.
+    expires = this->wheel_time_ + max_delta;
+  }
 
-    this->pop_raw_();
+  const uint8_t slot = (expires >> (level * SCHEDULER_WHEEL_BITS)) & (SCHEDULER_WHEEL_SLOTS - 1);
+  link_(&this->wheel_[level][slot], item);
+  this->wheel_occupied_[level] |= 1UL << slot;
+  item->in_wheel = true;
+  this->wheel_count_++;
+}
+void HOT Scheduler::cascade_(uint8_t level) {
+  const uint8_t index = (this->wheel_time_ >> (level * SCHEDULER_WHEEL_BITS)) & (SCHEDULER_WHEEL_SLOTS - 1);
+  SchedulerItem *&slot = this->wheel_[level][index];
+  while (slot != nullptr) {
+    SchedulerItem *item = slot;
+    unlink_(item);
+    item->in_wheel = false;
+    this->wheel_count_--;
+    this->insert_(item);
   }
+  this->wheel_occupied_[level] &= ~(1UL << index);
+}
+uint64_t HOT Scheduler::next_wheel_event_(uint64_t limit) {
+  uint64_t next = limit;
+  for (uint8_t level = 0; level < SCHEDULER_WHEEL_LEVELS; level++) {
+    const uint8_t shift = level * SCHEDULER_WHEEL_BITS;
+    // Level 0 slots are processed every tick, higher level slots are cascaded on their boundaries
+    const uint64_t first = ((this->wheel_time_ >> shift) + 1) << shift;
+    if (first >= next)
+      break;
+    const uint8_t from = (first >> shift) & (SCHEDULER_WHEEL_SLOTS - 1);
+    int distance;
+    while ((distance = next_set_bit(this->wheel_occupied_[level], from)) >= 0) {
+      const uint8_t slot = (from + distance) & (SCHEDULER_WHEEL_SLOTS - 1);
+      if (this->wheel_[level][slot] != nullptr) {
+        next = std::min(next, first + (uint64_t(distance) << shift));
+        break;
+      }
+      // Stale bit of a slot whose items were cancelled
+      this->wheel_occupied_[level] &= ~(1UL << slot);
+    }
+  }
+  return next;
+}
+Scheduler::Handle HOT Scheduler::push_(Component *component, bool named, uint32_t name_hash,
+                                       SchedulerItem::Type type, uint32_t interval, uint64_t next_execution,
+                                       std::function<void()> &&func) {
+  SchedulerItem *item = this->acquire_();
+  item->component = component;
+  item->name_hash = name_hash;
+  item->named = named;
+  item->type = type;
+  item->interval = interval;
+  item->next_execution = next_execution;
+  item->f = std::move(func);
+  item->remove = false;
+  if (named)
+    this->name_link_(item);
+  link_(&this->to_add_, item);
+  return {item, item->generation};
 }
-void HOT Scheduler::pop_raw_() {
-  std::pop_heap(this->items_.begin(), this->items_.end(), SchedulerItem::cmp);
-  this->items_.pop_back();
+Scheduler::SchedulerItem *HOT Scheduler::acquire_() {
+  SchedulerItem *item = this->free_items_;
+  if (item == nullptr)
+    return new SchedulerItem();
+  this->free_items_ = item->next;
+  item->pprev = nullptr;
+  return item;
 }
-void HOT Scheduler::push_(std::unique_ptr<Scheduler::SchedulerItem> item) { this->to_add_.push_back(std::move(item)); }
-bool HOT Scheduler::cancel_item_(Component *component, const std::string &name, Scheduler::SchedulerItem::Type type) {
+void HOT Scheduler::release_(SchedulerItem *item) {
+  this->name_unlink_(item);
+  // Destroy captured state now, don't keep it alive in the pool
+  item->f = nullptr;
+  item->remove = true;
+  item->generation++;
+  item->next = this->free_items_;
+  item->pprev = nullptr;
+  this->free_items_ = item;
+}
+void HOT Scheduler::cancel_item_(SchedulerItem *item) {
+  item->remove = true;
+  this->name_unlink_(item);
+  if (item->pprev == nullptr) {
+    // Currently running, will be released once f() returns
+    return;
+  }
+  unlink_(item);
+  if (item->in_wheel) {
+    item->in_wheel = false;
+    this->wheel_count_--;
+  }
+  this->release_(item);
+}
+bool HOT Scheduler::cancel_item_(Component *component, uint32_t name_hash, Scheduler::SchedulerItem::Type type) {
+  if (this->name_count_ == 0)
+    return false;
   bool ret = false;
-  for (auto &it : this->items_)
-    if (it->component == component && it->name == name && it->type == type) {
-      it->remove = true;
+  SchedulerItem *item = *this->name_bucket_(component, name_hash, type);
+  while (item != nullptr) {
+    SchedulerItem *next = item->name_next;
+    if (item->name_hash == name_hash && item->component == component && item->type == type) {
+      this->cancel_item_(item);
       ret = true;
     }
-  for (auto &it : this->to_add_)
-    if (it->component == component && it->name == name && it->type == type) {
-      it->remove = true;
-      ret = true;
+    item = next;
+  }
+  return ret;
+}
+Scheduler::SchedulerItem **Scheduler::name_bucket_(Component *component, uint32_t name_hash,
+                                                   SchedulerItem::Type type) {
+  uint32_t hash = name_hash ^ type;
+  hash ^= uint32_t(reinterpret_cast<uintptr_t>(component)) * 2654435761UL;
+  return &this->name_buckets_[hash & (this->name_buckets_.size() - 1)];
+}
+void Scheduler::name_link_(SchedulerItem *item) {
+  if (this->name_buckets_.empty()) {
+    this->name_buckets_.resize(SCHEDULER_INITIAL_NAME_BUCKETS, nullptr);
+  } else if (this->name_count_ >= this->name_buckets_.size() * 2) {
+    // Grow the hash table to keep chains short
+    std::vector<SchedulerItem *> old;
+    old.swap(this->name_buckets_);
+    this->name_buckets_.resize(old.size() * 2, nullptr);
+    for (SchedulerItem *head : old) {
+      while (head != nullptr) {
+        SchedulerItem *it = head;
+        head = it->name_next;
+        SchedulerItem **bucket = this->name_bucket_(it);
+        it->name_next = *bucket;
+        if (it->name_next != nullptr)
+          it->name_next->name_pprev = &it->name_next;
+        *bucket = it;
+        it->name_pprev = bucket;
+      }
     }
+  }
 
-  return ret;
+  SchedulerItem **head = this->name_bucket_(item);
+  item->name_next = *head;
+  if (item->name_next != nullptr)
+    item->name_next->name_pprev = &item->name_next;
+  *head = item;
+  item->name_pprev = head;
+  this->name_count_++;
 }
-uint32_t Scheduler::millis_() {
+void Scheduler::name_unlink_(SchedulerItem *item) {
+  if (item->name_pprev == nullptr)
+    return;
+  *item->name_pprev = item->name_next;
+  if (item->name_next != nullptr)
+    item->name_next->name_pprev = item->name_pprev;
+  item->name_pprev = nullptr;
+  item->name_next = nullptr;
+  this->name_count_--;
+}
+void HOT Scheduler::link_(SchedulerItem **head, SchedulerItem *item) {
+  item->next = *head;
+  if (item->next != nullptr)
+    item->next->pprev = &item->next;
+  *head = item;
+  item->pprev = head;
+}
+void Scheduler::delete_list_(SchedulerItem *head) {
+  while (head != nullptr) {
+    SchedulerItem *next = head->next;
+    delete head;
+    head = next;
+  }
+}
+void HOT Scheduler::unlink_(SchedulerItem *item) {
+  *item->pprev = item->next;
+  if (item->next != nullptr)
+    item->next->pprev = item->pprev;
+  item->pprev = nullptr;
+  item->next = nullptr;
+}
+uint64_t Scheduler::millis_() {
   const uint32_t now = millis();
   if (now < this->last_millis_) {
     ESP_LOGD(TAG, "Incrementing scheduler major");
     this->millis_major_++;
   }
   this->last_millis_ = now;
-  return now;
-}
-
-bool HOT Scheduler::SchedulerItem::cmp(const std::unique_ptr<SchedulerItem> &a,
-                                       const std::unique_ptr<SchedulerItem> &b) {
-  // min-heap
-  // return true if *a* will happen after *b*
-  uint32_t a_next_exec = a->next_execution();
-  uint8_t a_next_exec_major = a->next_execution_major();
-  uint32_t b_next_exec = b->next_execution();
-  uint8_t b_next_exec_major = b->next_execution_major();
-
-  if (a_next_exec_major != b_next_exec_major) {
-    // The "major" calculation is quite complicated.
-    // Basically, we need to check if the major value lies in the future or
-    //
-
-    // Here are some cases to think about:
-    // Format: a_major,b_major -> expected result (a-b, b-a)
-    // a=255,b=0 -> false (255, 1)
-    // a=0,b=1 -> false   (255, 1)
-    // a=1,b=0 -> true    (1, 255)
-    // a=0,b=255 -> true  (1, 255)
-
-    uint8_t diff1 = a_next_exec_major - b_next_exec_major;
-    uint8_t diff2 = b_next_exec_major - a_next_exec_major;
-    return diff1 < diff2;
-  }
-
-  return a_next_exec > b_next_exec;
+  return (uint64_t(this->millis_major_) << 32) | now;
 }
 
 }  // namespace esphome
@@ -8,12 +8,54 @@ namespace esphome {
 
 class Component;
 
+/** Timer wheel used by components to run delayed/periodic callbacks from the main loop.
+ *
+ * Items are stored in a hierarchical timing wheel (SCHEDULER_WHEEL_LEVELS levels with SCHEDULER_WHEEL_SLOTS
+ * slots each, 1ms resolution at the lowest level) in intrusive lists, so scheduling and cancelling are O(1).
+ * Items are recycled through a free list, so re-arming a timeout does not allocate once the pool is warm.
+ *
+ * Named items can additionally be cancelled by (component, name) through a small intrusive hash table.
+ * Names are never stored, only their 32-bit fnv1_hash() ID, so names given as std::string, string literal or
+ * precomputed ID all refer to the same item.
+ */
 class Scheduler {
+ protected:
+  struct SchedulerItem;
+
  public:
-  void set_timeout(Component *component, const std::string &name, uint32_t timeout, std::function<void()> &&func);
+  /// Opaque reference to a scheduled item, can be used to cancel it in O(1) with cancel().
+  class Handle {
+   public:
+    Handle() = default;
+
+   protected:
+    friend Scheduler;
+    Handle(SchedulerItem *item, uint32_t generation) : item_(item), generation_(generation) {}
+
+    SchedulerItem *item_{nullptr};
+    uint32_t generation_{0};
+  };
+
+  ~Scheduler();
+
+  Handle set_timeout(Component *component, const std::string &name, uint32_t timeout, std::function<void()> &&func);
+  /// Same as above, but doesn't construct a std::string for string literals.
+  Handle set_timeout(Component *component, const char *name, uint32_t timeout, std::function<void()> &&func);
+  /// Same as above, with a precomputed name ID, see NameHash.
+  Handle set_timeout(Component *component, NameHash id, uint32_t timeout, std::function<void()> &&func);
   bool cancel_timeout(Component *component, const std::string &name);
-  void set_interval(Component *component, const std::string &name, uint32_t interval, std::function<void()> &&func);
+  bool cancel_timeout(Component *component, const char *name);
+  bool cancel_timeout(Component *component, NameHash id);
+  Handle set_interval(Component *component, const std::string &name, uint32_t interval, std::function<void()> &&func);
+  /// Same as above, but doesn't construct a std::string for string literals.
+  Handle set_interval(Component *component, const char *name, uint32_t interval, std::function<void()> &&func);
+  /// Same as above, with a precomputed name ID, see NameHash.
+  Handle set_interval(Component *component, NameHash id, uint32_t interval, std::function<void()> &&func);
   bool cancel_interval(Component *component, const std::string &name);
+  bool cancel_interval(Component *component, const char *name);
+  bool cancel_interval(Component *component, NameHash id);
+  /// Cancel the item referenced by handle, returns false if it already ran (timeout) or was cancelled before.
+  bool cancel(const Handle &handle);
 
   optional<uint32_t> next_schedule_in();
 
@@ -24,43 +66,79 @@ class Scheduler {
  protected:
   struct SchedulerItem {
     Component *component;
-    std::string name;
-    enum Type { TIMEOUT, INTERVAL } type;
-    union {
-      uint32_t interval;
-      uint32_t timeout;
-    };
-    uint32_t last_execution;
-    std::function<void()> f;
+    /// fnv1_hash() of the name, only valid if named is set.
+    uint32_t name_hash;
+    enum Type : uint8_t { TIMEOUT, INTERVAL } type;
+    bool named;
     bool remove;
-    uint8_t last_execution_major;
-
-    inline uint32_t next_execution() { return this->last_execution + this->timeout; }
-    inline uint8_t next_execution_major() {
-      uint32_t next_exec = this->next_execution();
-      uint8_t next_exec_major = this->last_execution_major;
-      if (next_exec < this->last_execution)
-        next_exec_major++;
-      return next_exec_major;
-    }
-
-    static bool cmp(const std::unique_ptr<SchedulerItem> &a, const std::unique_ptr<SchedulerItem> &b);
+    /// Whether this item is in a wheel slot or the ready list (and counted in wheel_count_).
+    bool in_wheel;
+    uint32_t interval;
+    /// Absolute time (64-bit, including millis() rollovers) at which this item should run next.
+    uint64_t next_execution;
+    std::function<void()> f;
+    /// Incremented every time this item is recycled, invalidates outstanding handles.
+    uint32_t generation;
+
+    /// Links into the wheel slot, ready or to_add list (nullptr pprev if not in any list).
+    SchedulerItem *next;
+    SchedulerItem **pprev;
+    /// Links into the name hash table (only for named items).
+    SchedulerItem *name_next;
+    SchedulerItem **name_pprev;
   };
 
-  uint32_t millis_();
-  void cleanup_();
-  void pop_raw_();
-  void push_(std::unique_ptr<SchedulerItem> item);
-  bool cancel_item_(Component *component, const std::string &name, SchedulerItem::Type type);
-  bool empty_() {
-    this->cleanup_();
-    return this->items_.empty();
+  static void link_(SchedulerItem **head, SchedulerItem *item);
+  static void delete_list_(SchedulerItem *head);
+  static void unlink_(SchedulerItem *item);
+
+  uint64_t millis_();
+  SchedulerItem *acquire_();
+  void release_(SchedulerItem *item);
+  void cancel_item_(SchedulerItem *item);
+  bool cancel_item_(Component *component, uint32_t name_hash, SchedulerItem::Type type);
+  Handle set_timeout_(Component *component, bool named, uint32_t name_hash, uint32_t timeout,
+                      std::function<void()> &&func);
+  Handle set_interval_(Component *component, bool named, uint32_t name_hash, uint32_t interval,
+                       std::function<void()> &&func);
+  Handle push_(Component *component, bool named, uint32_t name_hash, SchedulerItem::Type type, uint32_t interval,
+               uint64_t next_execution, std::function<void()> &&func);
+  void insert_(SchedulerItem *item);
+  void cascade_(uint8_t level);
+  /// The first tick after wheel_time_ at which a wheel slot needs to be processed, or limit if that's earlier.
+  uint64_t next_wheel_event_(uint64_t limit);
+  void run_ready_(uint64_t now);
+
+  SchedulerItem **name_bucket_(Component *component, uint32_t name_hash, SchedulerItem::Type type);
+  SchedulerItem **name_bucket_(SchedulerItem *item) {
+    return this->name_bucket_(item->component, item->name_hash, item->type);
   }
+  void name_link_(SchedulerItem *item);
+  void name_unlink_(SchedulerItem *item);
+
+  static const uint8_t SCHEDULER_WHEEL_LEVELS = 5;
+  static const uint8_t SCHEDULER_WHEEL_BITS = 5;
+  static const uint8_t SCHEDULER_WHEEL_SLOTS = 1 << SCHEDULER_WHEEL_BITS;
+  static_assert(SCHEDULER_WHEEL_SLOTS <= 32, "wheel_occupied_ has one bit per slot");
 
-  std::vector<std::unique_ptr<SchedulerItem>> items_;
-  std::vector<std::unique_ptr<SchedulerItem>> to_add_;
+  SchedulerItem *wheel_[SCHEDULER_WHEEL_LEVELS][SCHEDULER_WHEEL_SLOTS]{};
+  /** Per level bitmap of the slots that may hold items, to skip over empty slots in call().
+   *
+   * Bits are set on insert and only cleared once a slot is found empty, so a set bit can be stale (cancelled items
+   * are unlinked without knowing their slot), but a slot with items always has its bit set.
+   */
+  uint32_t wheel_occupied_[SCHEDULER_WHEEL_LEVELS]{};
+  /// The next wheel tick (absolute ms) that has not been processed yet.
+  uint64_t wheel_time_{0};
+  /// Number of items in the wheel (including the ready list).
+  uint32_t wheel_count_{0};
+  SchedulerItem *ready_{nullptr};
+  SchedulerItem *to_add_{nullptr};
+  SchedulerItem *free_items_{nullptr};
+  std::vector<SchedulerItem *> name_buckets_;
+  uint32_t name_count_{0};
   uint32_t last_millis_{0};
-  uint8_t millis_major_{0};
+  uint32_t millis_major_{0};
 };
 
 }  // namespace esphome
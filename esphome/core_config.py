@@ -9,8 +9,8 @@ from esphome.const import ARDUINO_VERSION_ESP32_DEV, ARDUINO_VERSION_ESP8266_DEV
     CONF_ARDUINO_VERSION, CONF_BOARD, CONF_BOARD_FLASH_MODE, CONF_BUILD_PATH, \
     CONF_COMMENT, CONF_ESPHOME, CONF_INCLUDES, CONF_LIBRARIES, \
     CONF_NAME, CONF_ON_BOOT, CONF_ON_LOOP, CONF_ON_SHUTDOWN, CONF_PLATFORM, \
-    CONF_PLATFORMIO_OPTIONS, CONF_PRIORITY, CONF_TRIGGER_ID, \
-    CONF_ESP8266_RESTORE_FROM_FLASH, ARDUINO_VERSION_ESP8266_2_3_0, \
+    CONF_PLATFORMIO_OPTIONS, CONF_PRIORITY, CONF_PROFILE_COMPONENTS, CONF_TICKLESS, \
+    CONF_TRIGGER_ID, CONF_ESP8266_RESTORE_FROM_FLASH, ARDUINO_VERSION_ESP8266_2_3_0, \
     ARDUINO_VERSION_ESP8266_2_5_0, ARDUINO_VERSION_ESP8266_2_5_1, ARDUINO_VERSION_ESP8266_2_5_2
 from esphome.core import CORE, coroutine_with_priority
 from esphome.helpers import copy_file_if_changed, walk_files
@@ -139,6 +139,8 @@ CONFIG_SCHEMA = cv.Schema({
     cv.Optional(CONF_ON_LOOP): automation.validate_automation({
         cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(LoopTrigger),
     }),
+    cv.Optional(CONF_TICKLESS, default=False): cv.boolean,
+    cv.Optional(CONF_PROFILE_COMPONENTS, default=False): cv.boolean,
     cv.Optional(CONF_INCLUDES, default=[]): cv.ensure_list(valid_include),
     cv.Optional(CONF_LIBRARIES, default=[]): cv.ensure_list(cv.string_strict),
 
@@ -208,6 +210,11 @@ def add_includes(includes):
 def to_code(config):
     cg.add_global(cg.global_ns.namespace('esphome').using)
     cg.add(cg.App.pre_setup(config[CONF_NAME], cg.RawExpression('__DATE__ ", " __TIME__')))
+    if config[CONF_TICKLESS]:
+        cg.add(cg.App.set_tickless(True))
+    if config[CONF_PROFILE_COMPONENTS]:
+        # Must come before any register_component() call, see cpp_helpers.register_component
+        cg.add_define('USE_COMPONENT_PROFILER')
 
     for conf in config.get(CONF_ON_BOOT, []):
         trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID], conf.get(CONF_PRIORITY))
@@ -1,7 +1,7 @@
 from esphome.const import CONF_INVERTED, CONF_MODE, CONF_NUMBER, CONF_SETUP_PRIORITY, \
     CONF_UPDATE_INTERVAL, CONF_TYPE_ID
 # pylint: disable=unused-import
-from esphome.core import coroutine, ID, CORE, ConfigType
+from esphome.core import coroutine, ID, CORE, ConfigType, Define
 from esphome.cpp_generator import RawExpression, add, get_variable
 from esphome.cpp_types import App, GPIOPin
 from esphome.util import Registry, RegistryEntry
@@ -46,6 +46,8 @@ def register_component(var, config):
         add(var.set_setup_priority(config[CONF_SETUP_PRIORITY]))
     if CONF_UPDATE_INTERVAL in config:
         add(var.set_update_interval(config[CONF_UPDATE_INTERVAL]))
+    if Define('USE_COMPONENT_PROFILER') in CORE.defines:
+        add(var.set_component_source(id_))
     add(App.register_component(var))
     yield var
 
@@ -21,7 +21,7 @@ DESCRIPTOR = _descriptor.FileDescriptor(
   package='',
   syntax='proto2',
   serialized_options=None,
-  serialized_pb=_b('\n\x11\x61pi_options.proto\x1a google/protobuf/descriptor.proto\"\x06\n\x04void*F\n\rAPISourceType\x12\x0f\n\x0bSOURCE_BOTH\x10\x00\x12\x11\n\rSOURCE_SERVER\x10\x01\x12\x11\n\rSOURCE_CLIENT\x10\x02:E\n\x16needs_setup_connection\x12\x1e.google.protobuf.MethodOptions\x18\x8e\x08 \x01(\x08:\x04true:C\n\x14needs_authentication\x12\x1e.google.protobuf.MethodOptions\x18\x8f\x08 \x01(\x08:\x04true:/\n\x02id\x12\x1f.google.protobuf.MessageOptions\x18\x8c\x08 \x01(\r:\x01\x30:M\n\x06source\x12\x1f.google.protobuf.MessageOptions\x18\x8d\x08 \x01(\x0e\x32\x0e.APISourceType:\x0bSOURCE_BOTH:/\n\x05ifdef\x12\x1f.google.protobuf.MessageOptions\x18\x8e\x08 \x01(\t:3\n\x03log\x12\x1f.google.protobuf.MessageOptions\x18\x8f\x08 \x01(\x08:\x04true:9\n\x08no_delay\x12\x1f.google.protobuf.MessageOptions\x18\x90\x08 \x01(\x08:\x05\x66\x61lse')
+  serialized_pb=_b('\n\x11\x61pi_options.proto\x1a google/protobuf/descriptor.proto\"\x06\n\x04void*F\n\rAPISourceType\x12\x0f\n\x0bSOURCE_BOTH\x10\x00\x12\x11\n\rSOURCE_SERVER\x10\x01\x12\x11\n\rSOURCE_CLIENT\x10\x02:E\n\x16needs_setup_connection\x12\x1e.google.protobuf.MethodOptions\x18\x8e\x08 \x01(\x08:\x04true:C\n\x14needs_authentication\x12\x1e.google.protobuf.MethodOptions\x18\x8f\x08 \x01(\x08:\x04true:/\n\x02id\x12\x1f.google.protobuf.MessageOptions\x18\x8c\x08 \x01(\r:\x01\x30:M\n\x06source\x12\x1f.google.protobuf.MessageOptions\x18\x8d\x08 \x01(\x0e\x32\x0e.APISourceType:\x0bSOURCE_BOTH:/\n\x05ifdef\x12\x1f.google.protobuf.MessageOptions\x18\x8e\x08 \x01(\t:3\n\x03log\x12\x1f.google.protobuf.MessageOptions\x18\x8f\x08 \x01(\x08:\x04true:9\n\x08no_delay\x12\x1f.google.protobuf.MessageOptions\x18\x90\x08 \x01(\x08:\x05\x66\x61lse:=\n\x0cstate_update\x12\x1f.google.protobuf.MessageOptions\x18\x91\x08 \x01(\x08:\x05\x66\x61lse')
   ,
   dependencies=[google_dot_protobuf_dot_descriptor__pb2.DESCRIPTOR,])
 
@@ -112,6 +112,14 @@ no_delay = _descriptor.FieldDescriptor(
   message_type=None, enum_type=None, containing_type=None,
   is_extension=True, extension_scope=None,
   serialized_options=None, file=DESCRIPTOR)
+STATE_UPDATE_FIELD_NUMBER = 1041
+state_update = _descriptor.FieldDescriptor(
+  name='state_update', full_name='state_update', index=7,
+  number=1041, type=8, cpp_type=7, label=1,
+  has_default_value=True, default_value=False,
+  message_type=None, enum_type=None, containing_type=None,
+  is_extension=True, extension_scope=None,
+  serialized_options=None, file=DESCRIPTOR)
 
 
 _VOID = _descriptor.Descriptor(
@@ -146,6 +154,7 @@ DESCRIPTOR.extensions_by_name['source'] = source
 DESCRIPTOR.extensions_by_name['ifdef'] = ifdef
 DESCRIPTOR.extensions_by_name['log'] = log
 DESCRIPTOR.extensions_by_name['no_delay'] = no_delay
+DESCRIPTOR.extensions_by_name['state_update'] = state_update
 _sym_db.RegisterFileDescriptor(DESCRIPTOR)
 
 void = _reflection.GeneratedProtocolMessageType('void', (_message.Message,), dict(
@@ -163,5 +172,6 @@ google_dot_protobuf_dot_descriptor__pb2.MessageOptions.RegisterExtension(source)
 google_dot_protobuf_dot_descriptor__pb2.MessageOptions.RegisterExtension(ifdef)
 google_dot_protobuf_dot_descriptor__pb2.MessageOptions.RegisterExtension(log)
 google_dot_protobuf_dot_descriptor__pb2.MessageOptions.RegisterExtension(no_delay)
+google_dot_protobuf_dot_descriptor__pb2.MessageOptions.RegisterExtension(state_update)
 
 # @@protoc_insertion_point(module_scope)
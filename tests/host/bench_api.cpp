@@ -0,0 +1,80 @@
+#include "benchmark.h"
+#include "esphome/components/api/api_pb2_service.h"
+
+using namespace esphome;
+using namespace esphome::api;
+
+/// A connection that encodes messages exactly like APIConnection does, but discards them instead of sending.
+class BenchConnection : public APIServerConnectionBase {
+ public:
+  BenchConnection() { this->send_buffer_.reserve(64); }
+
+  bool is_authenticated() override { return true; }
+  bool is_connection_setup() override { return true; }
+  void on_fatal_error() override {}
+  void on_unauthenticated_access() override {}
+  void on_no_setup_connection() override {}
+  ProtoWriteBuffer create_buffer(uint32_t reserve_size) override {
+    this->send_buffer_.clear();
+    this->send_buffer_.reserve(HEADER_PADDING + reserve_size);
+    this->send_buffer_.resize(HEADER_PADDING);
+    return {&this->send_buffer_};
+  }
+  bool send_buffer(ProtoWriteBuffer buffer, uint32_t message_type) override {
+    std::vector<uint8_t> &data = *buffer.get_buffer();
+    const uint32_t msg_size = data.size() - HEADER_PADDING;
+    const uint8_t header_size = 1 + ProtoSize::varint(msg_size) + ProtoSize::varint(message_type);
+    uint8_t *header = &data[HEADER_PADDING - header_size];
+    header[0] = 0x00;
+    uint8_t pos = 1;
+    pos += ProtoVarInt(msg_size).encode_to(header + pos);
+    ProtoVarInt(message_type).encode_to(header + pos);
+    this->bytes_sent_ += msg_size + header_size;
+    return true;
+  }
+  void set_nodelay(bool nodelay) override {}
+
+  uint64_t get_bytes_sent() const { return this->bytes_sent_; }
+
+ protected:
+  static const uint8_t HEADER_PADDING = 1 + 5 + 2;
+
+  std::vector<uint8_t> send_buffer_;
+  uint64_t bytes_sent_{0};
+};
+
+/// Encoding and framing of the most common message, a sensor state update.
+static void BM_APISendSensorState(benchmark::State &state) {
+  BenchConnection conn;
+  SensorStateResponse resp;
+  resp.key = 0x12345678;
+  resp.missing_state = false;
+
+  uint32_t i = 0;
+  for (auto _ : state) {
+    resp.state = float(i++) / 16.0f;
+    conn.send_sensor_state_response(resp);
+  }
+  benchmark::DoNotOptimize(conn.get_bytes_sent());
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_APISendSensorState);
+
+/// Encoding and framing of a list_entities message with several string fields.
+static void BM_APISendListEntitiesSensor(benchmark::State &state) {
+  BenchConnection conn;
+  ListEntitiesSensorResponse resp;
+  resp.object_id = "living_room_temperature";
+  resp.key = 0x12345678;
+  resp.name = "Living Room Temperature";
+  resp.unique_id = "livingroomtemperaturesensor";
+  resp.icon = "mdi:thermometer";
+  resp.unit_of_measurement = "°C";
+  resp.accuracy_decimals = 1;
+
+  for (auto _ : state)
+    conn.send_list_entities_sensor_response(resp);
+  benchmark::DoNotOptimize(conn.get_bytes_sent());
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_APISendListEntitiesSensor);
@@ -0,0 +1,66 @@
+#include "benchmark.h"
+#include "esphome/core/application.h"
+
+using namespace esphome;
+
+class BenchLoopComponent : public Component {
+ public:
+  void loop() override { this->counter_++; }
+
+ protected:
+  uint32_t counter_{0};
+};
+
+/// Application::loop() with <range> trivially looping components.
+static void BM_ApplicationLoop(benchmark::State &state) {
+  host::set_simulated_time(true);
+  Application app;
+  std::vector<BenchLoopComponent> components(state.range(0));
+  for (auto &comp : components)
+    app.register_component(&comp);
+  app.setup();
+
+  for (auto _ : state)
+    app.loop();
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ApplicationLoop)->Arg(1)->Arg(10)->Arg(100);
+
+/// The linear scan Application::get_sensor_by_key() used before the key index, for comparison.
+static sensor::Sensor *find_sensor_linear(const std::vector<sensor::Sensor *> &sensors, uint32_t key) {
+  for (auto *obj : sensors)
+    if (obj->get_object_id_hash() == key && !obj->is_internal())
+      return obj;
+  return nullptr;
+}
+
+/// Look up each of <range> registered sensors by key, either by linear scan (arg 1 = 0) or the index (arg 1 = 1).
+static void BM_ApplicationGetSensorByKey(benchmark::State &state) {
+  Application app;
+  std::vector<std::unique_ptr<sensor::Sensor>> sensors;
+  std::vector<uint32_t> keys;
+  for (int64_t i = 0; i < state.range(0); i++) {
+    sensors.emplace_back(new sensor::Sensor("Bench Sensor " + to_string(i)));
+    app.register_sensor(sensors.back().get());
+    keys.push_back(sensors.back()->get_object_id_hash());
+  }
+  app.setup();
+  const bool indexed = state.range(1) != 0;
+
+  size_t i = 0;
+  for (auto _ : state) {
+    uint32_t key = keys[i++ % keys.size()];
+    if (indexed)
+      benchmark::DoNotOptimize(app.get_sensor_by_key(key));
+    else
+      benchmark::DoNotOptimize(find_sensor_linear(app.get_sensors(), key));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ApplicationGetSensorByKey)
+    ->Args({10, 0})
+    ->Args({10, 1})
+    ->Args({100, 0})
+    ->Args({100, 1})
+    ->Args({500, 0})
+    ->Args({500, 1});
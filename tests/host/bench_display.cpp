@@ -0,0 +1,144 @@
+#include "benchmark.h"
+#include "esphome/components/display/display_buffer.h"
+#include "esphome/components/ssd1306_base/ssd1306_base.h"
+
+using namespace esphome;
+using namespace esphome::display;
+
+/// An SSD1306 128x64 that renders into its buffer like the real driver, but doesn't transmit anything.
+class BenchSSD1306 : public ssd1306_base::SSD1306 {
+ public:
+  BenchSSD1306() { this->init_internal_(this->get_buffer_length_()); }
+  uint8_t get_first_byte() const { return this->buffer_[0]; }
+
+ protected:
+  void command(uint8_t value) override {}
+  void write_display_data(const uint8_t *data, size_t length) override {}
+};
+
+/// A 128x64 display with the same page layout that only implements the per-pixel interface.
+class BenchPixelDisplay : public DisplayBuffer {
+ public:
+  BenchPixelDisplay() { this->init_internal_(128 * 64 / 8); }
+  uint8_t get_first_byte() const { return this->buffer_[0]; }
+
+ protected:
+  int get_width_internal() override { return 128; }
+  int get_height_internal() override { return 64; }
+  void draw_absolute_pixel_internal(int x, int y, int color) override {
+    if (x >= 128 || x < 0 || y >= 64 || y < 0)
+      return;
+    const uint16_t pos = x + (y / 8) * 128;
+    if (color)
+      this->buffer_[pos] |= 1 << (y & 7);
+    else
+      this->buffer_[pos] &= ~(1 << (y & 7));
+  }
+};
+
+/// A monospace 8x12 font, every glyph is a filled box with a hole.
+static const uint8_t BENCH_GLYPH_DATA[] = {0x00, 0x7E, 0x7E, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x7E, 0x7E, 0x00};
+/// The same glyph stored for a display rotated by 90°, as the font component generates it with `rotation: 90`.
+static uint8_t bench_glyph_data_90[2 * 8]{};
+static Font *bench_font(DisplayRotation rotation) {
+  static const char *const CHARS[] = {" ", "0", "1", "2", "3", "4", "5", "6", "7", "8", "9", ":"};
+  // stored 12x8: pixel [x,y] of the glyph is at [11 - y, x]
+  for (int y = 0; y < 12; y++) {
+    for (int x = 0; x < 8; x++) {
+      if (BENCH_GLYPH_DATA[y] & (0x80 >> x))
+        bench_glyph_data_90[x * 2 + (11 - y) / 8] |= 0x80 >> ((11 - y) % 8);
+    }
+  }
+  const uint8_t *data = rotation == DISPLAY_ROTATION_0_DEGREES ? BENCH_GLYPH_DATA : bench_glyph_data_90;
+  std::vector<Glyph> glyphs;
+  for (const char *c : CHARS)
+    glyphs.emplace_back(c, data, 0, 0, 0, 8, 12, rotation);
+  return new Font(std::move(glyphs), 10, 12);
+}
+
+template<typename T> static void bench_filled_rectangle(benchmark::State &state) {
+  T display;
+  int color = 0;
+  for (auto _ : state)
+    display.filled_rectangle(0, 0, display.get_width(), display.get_height(), color ^= 1);
+  benchmark::DoNotOptimize(display.get_first_byte());
+  state.SetItemsProcessed(state.iterations());
+}
+/// Full-screen filled_rectangle(), the default implementation of fill().
+static void BM_DisplayFilledRectangleSSD1306(benchmark::State &state) { bench_filled_rectangle<BenchSSD1306>(state); }
+BENCHMARK(BM_DisplayFilledRectangleSSD1306);
+static void BM_DisplayFilledRectanglePixel(benchmark::State &state) { bench_filled_rectangle<BenchPixelDisplay>(state); }
+BENCHMARK(BM_DisplayFilledRectanglePixel);
+
+template<typename T> static void bench_print(benchmark::State &state) {
+  T display;
+  display.set_rotation(DisplayRotation(state.range(0)));
+  Font *font = bench_font(DisplayRotation(state.range(1)));
+  for (auto _ : state)
+    display.print(4, 4, font, "12:34:56");
+  benchmark::DoNotOptimize(display.get_first_byte());
+  state.SetItemsProcessed(state.iterations());
+}
+/// Print an 8 glyph string, args are the display rotation and the rotation the font is stored for.
+static void BM_DisplayPrintSSD1306(benchmark::State &state) { bench_print<BenchSSD1306>(state); }
+BENCHMARK(BM_DisplayPrintSSD1306)->Args({0, 0})->Args({90, 0})->Args({90, 90});
+static void BM_DisplayPrintPixel(benchmark::State &state) { bench_print<BenchPixelDisplay>(state); }
+BENCHMARK(BM_DisplayPrintPixel)->Args({0, 0})->Args({90, 0})->Args({90, 90});
+
+/// A 128x64 display with 16 gray levels in a packed buffer, like the SSD1325.
+class BenchGray4Display : public DisplayBuffer {
+ public:
+  BenchGray4Display() {
+    this->pixel_format_ = PIXEL_FORMAT_GRAY4;
+    this->init_internal_(this->get_packed_buffer_length_());
+  }
+  uint8_t get_first_byte() const { return this->buffer_[0]; }
+
+ protected:
+  int get_width_internal() override { return 128; }
+  int get_height_internal() override { return 64; }
+  void draw_absolute_pixel_internal(int x, int y, int color) override {
+    if (x >= 128 || x < 0 || y >= 64 || y < 0)
+      return;
+    this->set_packed_pixel_(x, y, color);
+  }
+  int get_absolute_pixel_internal(int x, int y) override { return this->get_packed_pixel_(x, y); }
+  void fill_span_internal(int x, int y, int width, int color) override { this->fill_packed_span_(x, y, width, color); }
+};
+
+/// The bench glyph as a 4 bit per pixel alpha mask, with half covered pixels around the box.
+static uint8_t bench_glyph_data_4bpp[4 * 12]{};
+static Font *bench_font_4bpp() {
+  static const char *const CHARS[] = {" ", "0", "1", "2", "3", "4", "5", "6", "7", "8", "9", ":"};
+  for (int y = 0; y < 12; y++) {
+    for (int x = 0; x < 8; x++) {
+      const uint8_t alpha = BENCH_GLYPH_DATA[y] & (0x80 >> x) ? 0x0F : (x == 0 || x == 7 ? 0x07 : 0x00);
+      bench_glyph_data_4bpp[y * 4 + x / 2] |= x % 2 ? alpha : alpha << 4;
+    }
+  }
+  std::vector<Glyph> glyphs;
+  for (const char *c : CHARS)
+    glyphs.emplace_back(c, bench_glyph_data_4bpp, 0, 0, 0, 8, 12, DISPLAY_ROTATION_0_DEGREES, 4);
+  return new Font(std::move(glyphs), 10, 12);
+}
+
+static void BM_DisplayFilledRectangleGray4(benchmark::State &state) {
+  BenchGray4Display display;
+  uint8_t level = 0;
+  for (auto _ : state)
+    display.filled_rectangle(0, 0, display.get_width(), display.get_height(), gray(level += 16));
+  benchmark::DoNotOptimize(display.get_first_byte());
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_DisplayFilledRectangleGray4);
+
+/// Print an 8 glyph string with a 1 bit per pixel and an anti-aliased font (arg is the bits per pixel).
+static void BM_DisplayPrintGray4(benchmark::State &state) {
+  BenchGray4Display display;
+  Font *font = state.range(0) == 4 ? bench_font_4bpp() : bench_font(DISPLAY_ROTATION_0_DEGREES);
+  for (auto _ : state)
+    display.print(4, 4, font, gray(200), "12:34:56");
+  benchmark::DoNotOptimize(display.get_first_byte());
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_DisplayPrintGray4)->Arg(1)->Arg(4);
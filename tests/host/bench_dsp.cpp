@@ -0,0 +1,50 @@
+#include "benchmark.h"
+#include "esphome/components/voltage_sampler/dsp.h"
+
+#include <cmath>
+#include <vector>
+
+using namespace esphome;
+using namespace esphome::voltage_sampler;
+
+/// A block of a 50Hz sine sampled at 4kHz around a 1.65V mid-point, like a CT clamp on an ADC.
+static std::vector<float> sine_block(size_t count, float amplitude, float phase) {
+  std::vector<float> block(count);
+  for (size_t i = 0; i < count; i++)
+    block[i] = 1.65f + amplitude * std::sin(2.0f * float(M_PI) * 50.0f * i / 4000.0f + phase);
+  return block;
+}
+
+static void BM_DSPSumSquaresFloat(benchmark::State &state) {
+  const auto block = sine_block(state.range(0), 0.5f, 0.0f);
+  for (auto _ : state)
+    benchmark::DoNotOptimize(block_sum_squares_float(block.data(), block.size(), 1.65f));
+  state.SetItemsProcessed(state.iterations() * block.size());
+}
+BENCHMARK(BM_DSPSumSquaresFloat)->Arg(64)->Arg(256);
+
+static void BM_DSPSumSquaresFixed(benchmark::State &state) {
+  const auto block = sine_block(state.range(0), 0.5f, 0.0f);
+  for (auto _ : state)
+    benchmark::DoNotOptimize(block_sum_squares_fixed(block.data(), block.size(), 1.65f));
+  state.SetItemsProcessed(state.iterations() * block.size());
+}
+BENCHMARK(BM_DSPSumSquaresFixed)->Arg(64)->Arg(256);
+
+static void BM_DSPPowerFloat(benchmark::State &state) {
+  const auto voltage = sine_block(state.range(0), 0.8f, 0.0f);
+  const auto current = sine_block(state.range(0), 0.5f, 0.3f);
+  for (auto _ : state)
+    benchmark::DoNotOptimize(block_power_float(voltage.data(), current.data(), voltage.size()));
+  state.SetItemsProcessed(state.iterations() * voltage.size());
+}
+BENCHMARK(BM_DSPPowerFloat)->Arg(64)->Arg(256);
+
+static void BM_DSPPowerFixed(benchmark::State &state) {
+  const auto voltage = sine_block(state.range(0), 0.8f, 0.0f);
+  const auto current = sine_block(state.range(0), 0.5f, 0.3f);
+  for (auto _ : state)
+    benchmark::DoNotOptimize(block_power_fixed(voltage.data(), current.data(), voltage.size()));
+  state.SetItemsProcessed(state.iterations() * voltage.size());
+}
+BENCHMARK(BM_DSPPowerFixed)->Arg(64)->Arg(256);
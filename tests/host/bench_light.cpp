@@ -0,0 +1,158 @@
+#include "benchmark.h"
+#include "esphome/components/light/addressable_light.h"
+#include "esphome/components/light/addressable_light_effect.h"
+#include "esphome/components/light/light_output.h"
+#include "esphome/components/light/light_state.h"
+
+using namespace esphome;
+using namespace esphome::light;
+
+/// An RGB strip with a GRB output buffer like the NeoPixelBus driver, showing only writes the buffer.
+class BenchAddressableLight : public AddressableLight {
+ public:
+  explicit BenchAddressableLight(int32_t size) : size_(size), pixels_(new uint8_t[size * 3]()) {
+    this->correction_.calculate_gamma_table(2.8f);
+    this->correction_.set_local_brightness(200);
+    this->init_frame_();
+  }
+  ~BenchAddressableLight() { delete[] this->pixels_; }
+  int32_t size() const override { return this->size_; }
+  LightTraits get_traits() override {
+    auto traits = LightTraits();
+    traits.set_supports_brightness(true);
+    traits.set_supports_rgb(true);
+    return traits;
+  }
+  void show() { this->mark_shown_(); }
+  uint8_t get_first_byte() const { return this->pixels_[0]; }
+
+ protected:
+  void write_frame_internal() override {
+    static const uint8_t OFFSETS[3] = {1, 0, 2};
+    this->write_frame_(this->pixels_, 3, OFFSETS);
+  }
+
+  int32_t size_;
+  uint8_t *pixels_;
+};
+
+/// One frame of an effect on a strip of state.range(0) LEDs, including writing the corrected frame to the strip.
+template<typename T> static void bench_effect(benchmark::State &state, T &effect) {
+  BenchAddressableLight light(state.range(0));
+  const ESPColor color(255, 160, 40, 0);
+  light.fill(color);
+  host::set_simulated_time(true);
+  for (auto _ : state) {
+    host::advance_time_us(16667);
+    effect.apply(light, color);
+    light.show();
+  }
+  host::set_simulated_time(false);
+  benchmark::DoNotOptimize(light.get_first_byte());
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_AddressableShow(benchmark::State &state) {
+  BenchAddressableLight light(state.range(0));
+  light.fill(ESPColor(255, 160, 40, 0));
+  for (auto _ : state)
+    light.show();
+  benchmark::DoNotOptimize(light.get_first_byte());
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AddressableShow)->Arg(1000);
+
+static void BM_AddressableRainbow(benchmark::State &state) {
+  AddressableRainbowLightEffect effect("Rainbow");
+  bench_effect(state, effect);
+}
+BENCHMARK(BM_AddressableRainbow)->Arg(1000);
+
+static void BM_AddressableColorWipe(benchmark::State &state) {
+  AddressableColorWipeEffect effect("Color Wipe");
+  effect.set_colors({{255, 0, 0, 0, false, 10}, {0, 0, 255, 0, false, 10}});
+  effect.set_add_led_interval(0);
+  bench_effect(state, effect);
+}
+BENCHMARK(BM_AddressableColorWipe)->Arg(1000);
+
+static void BM_AddressableTwinkle(benchmark::State &state) {
+  AddressableTwinkleEffect effect("Twinkle");
+  effect.set_twinkle_probability(0.5f);
+  bench_effect(state, effect);
+}
+BENCHMARK(BM_AddressableTwinkle)->Arg(1000);
+
+static void BM_AddressableFireworks(benchmark::State &state) {
+  AddressableFireworksEffect effect("Fireworks");
+  effect.set_update_interval(0);
+  effect.set_spark_probability(0.1f);
+  effect.set_fade_out_rate(120);
+  bench_effect(state, effect);
+}
+BENCHMARK(BM_AddressableFireworks)->Arg(1000);
+
+static void BM_AddressableFlicker(benchmark::State &state) {
+  AddressableFlickerEffect effect("Flicker");
+  effect.set_update_interval(0);
+  effect.set_intensity(0.05f);
+  bench_effect(state, effect);
+}
+BENCHMARK(BM_AddressableFlicker)->Arg(1000);
+
+/// An RGBWW light that only stores the values, like the rgbww platform with five float outputs.
+class BenchRGBWWLightOutput : public LightOutput {
+ public:
+  LightTraits get_traits() override {
+    auto traits = LightTraits();
+    traits.set_supports_brightness(true);
+    traits.set_supports_rgb(true);
+    traits.set_supports_rgb_white_value(true);
+    traits.set_supports_color_temperature(true);
+    traits.set_min_mireds(153.0f);
+    traits.set_max_mireds(500.0f);
+    return traits;
+  }
+  void write_state(LightState *state) override {
+    state->current_values_as_rgbww(&this->values[0], &this->values[1], &this->values[2], &this->values[3],
+                                   &this->values[4]);
+  }
+
+  float values[5];
+};
+
+/// One loop() of an RGBWW light during a transition: interpolation, conversion and gamma correction.
+static void bench_transition(benchmark::State &state, bool fixed_point) {
+  BenchRGBWWLightOutput output;
+  LightState light("Bench", &output);
+  light.set_gamma_correct(2.8f);
+  light.set_fixed_point(fixed_point);
+  host::set_simulated_time(true);
+  light.make_call()
+      .set_state(true)
+      .set_brightness(0.2f)
+      .set_rgbw(1.0f, 0.5f, 0.1f, 0.8f)
+      .set_color_temperature(200.0f)
+      .set_transition_length(0)
+      .perform();
+  light.loop();
+  light.make_call()
+      .set_brightness(0.9f)
+      .set_rgbw(0.1f, 0.6f, 1.0f, 0.3f)
+      .set_color_temperature(450.0f)
+      .set_transition_length(24 * 60 * 60 * 1000)
+      .perform();
+  for (auto _ : state) {
+    host::advance_time_us(10);
+    light.loop();
+  }
+  host::set_simulated_time(false);
+  benchmark::DoNotOptimize(output.values[0]);
+  state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_LightTransitionFloat(benchmark::State &state) { bench_transition(state, false); }
+BENCHMARK(BM_LightTransitionFloat);
+
+static void BM_LightTransitionQ16(benchmark::State &state) { bench_transition(state, true); }
+BENCHMARK(BM_LightTransitionQ16);
@@ -0,0 +1,142 @@
+#include "benchmark.h"
+#include "esphome/core/scheduler.h"
+#include "esphome/core/helpers.h"
+
+using namespace esphome;
+
+static std::vector<std::string> make_names(int64_t count) {
+  std::vector<std::string> names;
+  for (int64_t i = 0; i < count; i++)
+    names.push_back("timer_" + to_string(int(i)));
+  return names;
+}
+
+/// Re-arm a single named debounce timeout while <range> other timeouts are pending.
+static void BM_SchedulerRearmTimeout(benchmark::State &state) {
+  host::set_simulated_time(true);
+  Scheduler scheduler;
+  auto names = make_names(state.range(0));
+  for (auto &name : names)
+    scheduler.set_timeout(nullptr, name, 3600000, []() {});
+  scheduler.process_to_add();
+
+  for (auto _ : state) {
+    scheduler.set_timeout(nullptr, "debounce", 50, []() {});
+    scheduler.call();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SchedulerRearmTimeout)->Arg(10)->Arg(100)->Arg(1000);
+
+/// Same as BM_SchedulerRearmTimeout, with the name passed as std::string and as precomputed ID.
+static void BM_SchedulerRearmTimeoutString(benchmark::State &state) {
+  host::set_simulated_time(true);
+  Scheduler scheduler;
+  const std::string name = "debounce_binary_sensor";
+  for (auto _ : state) {
+    scheduler.set_timeout(nullptr, name, 50, []() {});
+    scheduler.call();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SchedulerRearmTimeoutString);
+
+static void BM_SchedulerRearmTimeoutId(benchmark::State &state) {
+  host::set_simulated_time(true);
+  Scheduler scheduler;
+  static const NameHash DEBOUNCE_ID("debounce_binary_sensor");
+  for (auto _ : state) {
+    scheduler.set_timeout(nullptr, DEBOUNCE_ID, 50, []() {});
+    scheduler.call();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SchedulerRearmTimeoutId);
+
+/// Cancel and re-add one of <range> named timeouts.
+static void BM_SchedulerCancelTimeout(benchmark::State &state) {
+  host::set_simulated_time(true);
+  Scheduler scheduler;
+  auto names = make_names(state.range(0));
+  for (auto &name : names)
+    scheduler.set_timeout(nullptr, name, 3600000, []() {});
+  scheduler.process_to_add();
+
+  size_t i = 0;
+  for (auto _ : state) {
+    auto &name = names[i++ % names.size()];
+    benchmark::DoNotOptimize(scheduler.cancel_timeout(nullptr, name));
+    scheduler.set_timeout(nullptr, name, 3600000, []() {});
+    scheduler.call();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SchedulerCancelTimeout)->Arg(10)->Arg(100)->Arg(1000);
+
+/// Scheduler::call() with <range> live intervals of which none are due.
+static void BM_SchedulerCallIdle(benchmark::State &state) {
+  host::set_simulated_time(true);
+  Scheduler scheduler;
+  for (int64_t i = 0; i < state.range(0); i++)
+    scheduler.set_interval(nullptr, "", 3600000, []() {});
+  scheduler.process_to_add();
+
+  for (auto _ : state)
+    scheduler.call();
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SchedulerCallIdle)->Arg(10)->Arg(100)->Arg(1000);
+
+/// Scheduler::call() with <range> intervals spread so that about one fires per millisecond.
+static void BM_SchedulerCallFiring(benchmark::State &state) {
+  host::set_simulated_time(true);
+  Scheduler scheduler;
+  uint32_t fired = 0;
+  for (int64_t i = 0; i < state.range(0); i++)
+    scheduler.set_interval(nullptr, "", uint32_t(state.range(0)), [&fired]() { fired++; });
+  scheduler.process_to_add();
+
+  for (auto _ : state) {
+    host::advance_time_us(1000);
+    scheduler.call();
+  }
+  benchmark::DoNotOptimize(fired);
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SchedulerCallFiring)->Arg(10)->Arg(100)->Arg(1000);
+
+/// Cancel and re-add one of <range> timeouts through the handle returned by set_timeout().
+static void BM_SchedulerCancelHandle(benchmark::State &state) {
+  host::set_simulated_time(true);
+  Scheduler scheduler;
+  std::vector<Scheduler::Handle> handles;
+  for (int64_t i = 0; i < state.range(0); i++)
+    handles.push_back(scheduler.set_timeout(nullptr, "", 3600000, []() {}));
+  scheduler.process_to_add();
+
+  size_t i = 0;
+  for (auto _ : state) {
+    auto &handle = handles[i++ % handles.size()];
+    benchmark::DoNotOptimize(scheduler.cancel(handle));
+    handle = scheduler.set_timeout(nullptr, "", 3600000, []() {});
+    scheduler.call();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SchedulerCancelHandle)->Arg(10)->Arg(100)->Arg(1000);
+
+/// Scheduler::call() after the loop slept or blocked for <range> ms, with a few idle intervals scheduled.
+static void BM_SchedulerCallAfterSleep(benchmark::State &state) {
+  host::set_simulated_time(true);
+  Scheduler scheduler;
+  for (int i = 0; i < 10; i++)
+    scheduler.set_interval(nullptr, "", 3600000, []() {});
+  scheduler.process_to_add();
+
+  for (auto _ : state) {
+    host::advance_time_us(uint64_t(state.range(0)) * 1000);
+    scheduler.call();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SchedulerCallAfterSleep)->Arg(16)->Arg(1000)->Arg(60000);
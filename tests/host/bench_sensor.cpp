@@ -0,0 +1,130 @@
+#include "benchmark.h"
+#include "esphome/components/sensor/sensor.h"
+#include "esphome/components/sensor/filter.h"
+
+using namespace esphome;
+using namespace esphome::sensor;
+
+static float sample(uint32_t i) { return float((i * 2654435761UL) >> 20) / 16.0f; }
+
+/// Sensor::publish_state() with no filters and a single state subscriber.
+static void BM_SensorPublishState(benchmark::State &state) {
+  Sensor sensor("Bench Sensor");
+  float sink = 0.0f;
+  sensor.add_on_state_callback([&sink](float value) { sink += value; });
+
+  uint32_t i = 0;
+  for (auto _ : state)
+    sensor.publish_state(sample(i++));
+  benchmark::DoNotOptimize(sink);
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SensorPublishState);
+
+/// A typical calibration chain: offset -> multiply -> lambda -> sliding average(15, 15).
+static void BM_SensorFilterChain(benchmark::State &state) {
+  Sensor sensor("Bench Sensor");
+  sensor.set_filters({
+      new OffsetFilter(1.5f),
+      new MultiplyFilter(0.25f),
+      new LambdaFilter([](float x) -> optional<float> { return x * x; }),
+      new SlidingWindowMovingAverageFilter(15, 15, 1),
+  });
+  float sink = 0.0f;
+  sensor.add_on_state_callback([&sink](float value) { sink += value; });
+
+  uint32_t i = 0;
+  for (auto _ : state)
+    sensor.publish_state(sample(i++));
+  benchmark::DoNotOptimize(sink);
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SensorFilterChain);
+
+/// The same chain as BM_SensorFilterChain, with the stateless filters fused like codegen does.
+static void BM_SensorFusedFilterChain(benchmark::State &state) {
+  Sensor sensor("Bench Sensor");
+  sensor.set_filters({
+      make_fused_filter([=](float x) -> optional<float> {
+        x = x + 1.5f;
+        x = x * 0.25f;
+        {
+          optional<float> result = ([=](float x) -> optional<float> { return x * x; })(x);
+          if (!result.has_value())
+            return {};
+          x = *result;
+        }
+        return x;
+      }),
+      new SlidingWindowMovingAverageFilter(15, 15, 1),
+  });
+  float sink = 0.0f;
+  sensor.add_on_state_callback([&sink](float value) { sink += value; });
+
+  uint32_t i = 0;
+  for (auto _ : state)
+    sensor.publish_state(sample(i++));
+  benchmark::DoNotOptimize(sink);
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SensorFusedFilterChain);
+
+/// MedianFilter with window size <range>, emitting on every sample.
+static void BM_SensorMedianFilter(benchmark::State &state) {
+  Sensor sensor("Bench Sensor");
+  sensor.set_filters({new MedianFilter(state.range(0), 1, 1)});
+  float sink = 0.0f;
+  sensor.add_on_state_callback([&sink](float value) { sink += value; });
+
+  uint32_t i = 0;
+  for (auto _ : state)
+    sensor.publish_state(sample(i++));
+  benchmark::DoNotOptimize(sink);
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SensorMedianFilter)->Arg(5)->Arg(25)->Arg(100)->Arg(500);
+
+/// QuantileFilter (90th percentile) with window size <range>, emitting on every sample.
+static void BM_SensorQuantileFilter(benchmark::State &state) {
+  Sensor sensor("Bench Sensor");
+  sensor.set_filters({new QuantileFilter(state.range(0), 1, 1, 0.9f)});
+  float sink = 0.0f;
+  sensor.add_on_state_callback([&sink](float value) { sink += value; });
+
+  uint32_t i = 0;
+  for (auto _ : state)
+    sensor.publish_state(sample(i++));
+  benchmark::DoNotOptimize(sink);
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SensorQuantileFilter)->Arg(5)->Arg(25)->Arg(100)->Arg(500);
+
+/// SlidingWindowMaxFilter with window size <range>, emitting on every sample.
+static void BM_SensorSlidingWindowMaxFilter(benchmark::State &state) {
+  Sensor sensor("Bench Sensor");
+  sensor.set_filters({new SlidingWindowMaxFilter(state.range(0), 1, 1)});
+  float sink = 0.0f;
+  sensor.add_on_state_callback([&sink](float value) { sink += value; });
+
+  uint32_t i = 0;
+  for (auto _ : state)
+    sensor.publish_state(sample(i++));
+  benchmark::DoNotOptimize(sink);
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SensorSlidingWindowMaxFilter)->Arg(5)->Arg(25)->Arg(100)->Arg(500);
+
+/// SlidingWindowMovingAverageFilter with window size <range>, emitting on every sample.
+static void BM_SensorMovingAverageFilter(benchmark::State &state) {
+  Sensor sensor("Bench Sensor");
+  sensor.set_filters({new SlidingWindowMovingAverageFilter(state.range(0), 1, 1)});
+  float sink = 0.0f;
+  sensor.add_on_state_callback([&sink](float value) { sink += value; });
+
+  uint32_t i = 0;
+  for (auto _ : state)
+    sensor.publish_state(sample(i++));
+  benchmark::DoNotOptimize(sink);
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SensorMovingAverageFilter)->Arg(5)->Arg(25)->Arg(100);
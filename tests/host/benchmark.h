@@ -0,0 +1,129 @@
+#pragma once
+
+// A tiny, dependency-free subset of the Google Benchmark API for the host build.
+//
+// Usage mirrors Google Benchmark so suites can be moved to the real library later:
+//
+//   static void BM_Something(benchmark::State &state) {
+//     setup(state.range(0));
+//     for (auto _ : state)
+//       benchmark::DoNotOptimize(do_something());
+//     state.SetItemsProcessed(state.iterations());
+//   }
+//   BENCHMARK(BM_Something)->Arg(10)->Arg(100)->Arg(1000);
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace benchmark {
+
+class State {
+ public:
+  State(uint64_t max_iterations, const std::vector<int64_t> &args) : max_iterations_(max_iterations), args_(args) {}
+
+  /// Marked unused so that `for (auto _ : state)` does not trigger unused variable warnings.
+  struct __attribute__((unused)) Value {};
+  class Iterator {
+   public:
+    explicit Iterator(State *parent) : parent_(parent) {}
+    Value operator*() const { return {}; }
+    Iterator &operator++() {
+      this->remaining_--;
+      return *this;
+    }
+    bool operator!=(const Iterator &) {
+      if (this->remaining_ != 0)
+        return true;
+      this->parent_->finish_();
+      return false;
+    }
+
+   protected:
+    friend State;
+    State *parent_;
+    uint64_t remaining_{0};
+  };
+
+  Iterator begin() {
+    Iterator it(this);
+    it.remaining_ = this->max_iterations_;
+    this->start_();
+    return it;
+  }
+  Iterator end() { return Iterator(nullptr); }
+
+  int64_t range(size_t index = 0) const { return index < this->args_.size() ? this->args_[index] : 0; }
+  uint64_t iterations() const { return this->max_iterations_; }
+
+  /// Exclude the following code from the measured time (e.g. re-seeding state).
+  void PauseTiming();   // NOLINT
+  void ResumeTiming();  // NOLINT
+  void SetItemsProcessed(int64_t items) { this->items_processed_ = items; }  // NOLINT
+  void SetLabel(const std::string &label) { this->label_ = label; }         // NOLINT
+
+  uint64_t elapsed_ns() const { return this->elapsed_ns_; }
+  int64_t items_processed() const { return this->items_processed_; }
+  const std::string &label() const { return this->label_; }
+
+ protected:
+  void start_();
+  void finish_();
+
+  uint64_t max_iterations_;
+  std::vector<int64_t> args_;
+  uint64_t start_ns_{0};
+  uint64_t elapsed_ns_{0};
+  int64_t items_processed_{0};
+  std::string label_;
+  bool running_{false};
+};
+
+using Function = void (*)(State &);
+
+namespace internal {
+
+class Benchmark {
+ public:
+  Benchmark(const char *name, Function func) : name_(name), func_(func) {}
+  Benchmark *Arg(int64_t arg) {  // NOLINT
+    this->args_.push_back({arg});
+    return this;
+  }
+  Benchmark *Args(const std::vector<int64_t> &args) {  // NOLINT
+    this->args_.push_back(args);
+    return this;
+  }
+
+  const std::string &name() const { return this->name_; }
+  Function func() const { return this->func_; }
+  const std::vector<std::vector<int64_t>> &args() const { return this->args_; }
+
+ protected:
+  std::string name_;
+  Function func_;
+  std::vector<std::vector<int64_t>> args_;
+};
+
+Benchmark *register_benchmark(const char *name, Function func);
+
+}  // namespace internal
+
+template<typename T> inline void DoNotOptimize(T const &value) {  // NOLINT
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+template<typename T> inline void DoNotOptimize(T &value) {  // NOLINT
+  asm volatile("" : "+r,m"(value) : : "memory");
+}
+inline void ClobberMemory() { asm volatile("" : : : "memory"); }  // NOLINT
+
+/// Run all registered benchmarks, honoring --benchmark_filter=, --benchmark_min_time= and --benchmark_format=.
+int run_all(int argc, char **argv);
+
+}  // namespace benchmark
+
+#define BENCHMARK_CONCAT_(a, b) a##b
+#define BENCHMARK_CONCAT(a, b) BENCHMARK_CONCAT_(a, b)
+#define BENCHMARK(func) \
+  static ::benchmark::internal::Benchmark *BENCHMARK_CONCAT(benchmark_registration_, __LINE__) = \
+      ::benchmark::internal::register_benchmark(#func, func)
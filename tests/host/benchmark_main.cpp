@@ -0,0 +1,140 @@
+#include "benchmark.h"
+#include "test.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <regex>
+
+namespace benchmark {
+
+static uint64_t now_ns() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+void State::start_() {
+  this->elapsed_ns_ = 0;
+  this->running_ = true;
+  this->start_ns_ = now_ns();
+}
+void State::finish_() {
+  if (this->running_)
+    this->elapsed_ns_ += now_ns() - this->start_ns_;
+  this->running_ = false;
+}
+void State::PauseTiming() {
+  if (!this->running_)
+    return;
+  this->elapsed_ns_ += now_ns() - this->start_ns_;
+  this->running_ = false;
+}
+void State::ResumeTiming() {
+  if (this->running_)
+    return;
+  this->running_ = true;
+  this->start_ns_ = now_ns();
+}
+
+namespace internal {
+
+static std::vector<std::unique_ptr<Benchmark>> &registry() {
+  static std::vector<std::unique_ptr<Benchmark>> benchmarks;
+  return benchmarks;
+}
+
+Benchmark *register_benchmark(const char *name, Function func) {
+  registry().emplace_back(new Benchmark(name, func));
+  return registry().back().get();
+}
+
+}  // namespace internal
+
+static bool parse_flag(const char *arg, const char *name, const char **value) {
+  size_t len = strlen(name);
+  if (strncmp(arg, name, len) != 0 || arg[len] != '=')
+    return false;
+  *value = arg + len + 1;
+  return true;
+}
+
+int run_all(int argc, char **argv) {
+  std::string filter = ".";
+  double min_time = 0.5;
+  bool csv = false;
+  for (int i = 1; i < argc; i++) {
+    const char *value;
+    if (parse_flag(argv[i], "--benchmark_filter", &value)) {
+      filter = value;
+    } else if (parse_flag(argv[i], "--benchmark_min_time", &value)) {
+      min_time = atof(value);
+    } else if (parse_flag(argv[i], "--benchmark_format", &value)) {
+      csv = strcmp(value, "csv") == 0;
+    } else {
+      fprintf(stderr, "Unknown argument '%s'\n", argv[i]);
+      return 1;
+    }
+  }
+  const std::regex filter_re(filter);
+
+  if (csv) {
+    printf("name,iterations,ns_per_iter,items_per_second,label\n");
+  } else {
+    printf("%-52s %14s %12s %16s\n", "Benchmark", "Time", "Iterations", "Items/s");
+    printf("%s\n", std::string(97, '-').c_str());
+  }
+
+  for (auto &bench : internal::registry()) {
+    std::vector<std::vector<int64_t>> arg_sets = bench->args();
+    if (arg_sets.empty())
+      arg_sets.emplace_back();
+
+    for (auto &args : arg_sets) {
+      std::string name = bench->name();
+      for (auto arg : args)
+        name += "/" + std::to_string(arg);
+      if (!std::regex_search(name, filter_re))
+        continue;
+
+      // Grow the iteration count until the measured time is significant, like Google Benchmark does.
+      uint64_t iterations = 1;
+      while (true) {
+        State state(iterations, args);
+        bench->func()(state);
+        double seconds = state.elapsed_ns() / 1e9;
+        if (seconds >= min_time || iterations >= 1000000000ULL) {
+          double ns_per_iter = double(state.elapsed_ns()) / double(iterations);
+          double items_per_sec = seconds > 0 ? state.items_processed() / seconds : 0;
+          if (csv) {
+            printf("%s,%llu,%.3f,%.1f,%s\n", name.c_str(), (unsigned long long) iterations, ns_per_iter,
+                   items_per_sec, state.label().c_str());
+          } else {
+            printf("%-52s %11.1f ns %12llu %16.0f %s\n", name.c_str(), ns_per_iter, (unsigned long long) iterations,
+                   items_per_sec, state.label().c_str());
+          }
+          fflush(stdout);
+          break;
+        }
+        double multiplier = seconds > 0 ? (min_time * 1.4) / seconds : 10.0;
+        if (multiplier > 10.0)
+          multiplier = 10.0;
+        if (multiplier < 2.0)
+          multiplier = 2.0;
+        iterations = uint64_t(double(iterations) * multiplier);
+      }
+    }
+  }
+  return 0;
+}
+
+}  // namespace benchmark
+
+int main(int argc, char **argv) {
+  // The host program runs the benchmarks by default, and the tests with --test as the first argument.
+  if (argc > 1 && strcmp(argv[1], "--test") == 0)
+    return testing::run_all(argc - 1, argv + 1);
+  return benchmark::run_all(argc, argv);
+}
@@ -0,0 +1,72 @@
+#include "Arduino.h"
+
+#include <chrono>
+#include <thread>
+#include <random>
+
+static uint64_t simulated_us = 0;
+static bool use_simulated = false;
+
+static uint64_t now_us() {
+  if (use_simulated)
+    return simulated_us;
+  static const auto START = std::chrono::steady_clock::now();
+  auto elapsed = std::chrono::steady_clock::now() - START;
+  return std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count() + simulated_us;
+}
+
+unsigned long millis() { return static_cast<uint32_t>(now_us() / 1000ULL); }  // NOLINT
+unsigned long micros() { return static_cast<uint32_t>(now_us()); }            // NOLINT
+void delay(unsigned long ms) {                                                 // NOLINT
+  if (use_simulated) {
+    simulated_us += uint64_t(ms) * 1000ULL;
+    return;
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+void delayMicroseconds(unsigned int us) {  // NOLINT
+  if (use_simulated) {
+    simulated_us += us;
+    return;
+  }
+  std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+void yield() {}
+
+static uint8_t pin_modes[64];
+static uint64_t pin_values = 0;
+
+void pinMode(uint8_t pin, uint8_t mode) { pin_modes[pin & 63] = mode; }  // NOLINT
+int digitalRead(uint8_t pin) { return (pin_values >> (pin & 63)) & 1; }  // NOLINT
+void digitalWrite(uint8_t pin, uint8_t val) {                            // NOLINT
+  if (val) {
+    pin_values |= 1ULL << (pin & 63);
+  } else {
+    pin_values &= ~(1ULL << (pin & 63));
+  }
+}
+
+uint32_t os_random() {  // NOLINT
+  static std::mt19937 rng(0x45535048);
+  return rng();
+}
+
+char *dtostrf(double number, signed char width, unsigned char prec, char *s) {  // NOLINT
+  sprintf(s, "%*.*f", width, prec, number);
+  return s;
+}
+
+void EspClass::restart() { std::exit(0); }
+
+EspClass ESP;  // NOLINT
+
+namespace host {
+
+void advance_time_us(uint64_t us) { simulated_us += us; }
+void set_simulated_time(bool simulated) {
+  if (simulated && !use_simulated)
+    simulated_us = now_us();
+  use_simulated = simulated;
+}
+
+}  // namespace host
@@ -0,0 +1,79 @@
+#pragma once
+
+// Minimal Arduino API shim so that esphome/core and selected components can be compiled
+// and benchmarked on the build host (see [env:host] in platformio.ini).
+//
+// Only the subset of the Arduino/ESP API that the host build actually uses is provided here.
+// Time is backed by a monotonic host clock, GPIOs by an in-memory register.
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <cstdio>
+#include <cmath>
+#include <algorithm>
+
+using std::isnan;
+using std::isinf;
+
+#define ICACHE_RAM_ATTR
+#define ICACHE_RODATA_ATTR
+#define PROGMEM
+#define pgm_read_byte(addr) (*reinterpret_cast<const uint8_t *>(addr))
+
+static const uint8_t HIGH = 0x1;
+static const uint8_t LOW = 0x0;
+
+static const uint8_t INPUT = 0x01;
+static const uint8_t OUTPUT = 0x02;
+static const uint8_t PULLUP = 0x04;
+static const uint8_t INPUT_PULLUP = 0x05;
+static const uint8_t PULLDOWN = 0x08;
+static const uint8_t INPUT_PULLDOWN = 0x09;
+static const uint8_t OPEN_DRAIN = 0x10;
+static const uint8_t OUTPUT_OPEN_DRAIN = 0x12;
+static const uint8_t SPECIAL = 0xF0;
+static const uint8_t FUNCTION_1 = 0x00;
+static const uint8_t FUNCTION_2 = 0x20;
+static const uint8_t FUNCTION_3 = 0x40;
+static const uint8_t FUNCTION_4 = 0x60;
+static const uint8_t ANALOG = 0xC0;
+
+static const uint8_t RISING = 0x01;
+static const uint8_t FALLING = 0x02;
+static const uint8_t CHANGE = 0x03;
+
+unsigned long millis();     // NOLINT
+unsigned long micros();     // NOLINT
+void delay(unsigned long ms);  // NOLINT
+void delayMicroseconds(unsigned int us);  // NOLINT
+void yield();
+
+void pinMode(uint8_t pin, uint8_t mode);  // NOLINT
+int digitalRead(uint8_t pin);  // NOLINT
+void digitalWrite(uint8_t pin, uint8_t val);  // NOLINT
+
+uint32_t os_random();  // NOLINT
+char *dtostrf(double number, signed char width, unsigned char prec, char *s);  // NOLINT
+
+inline double pow10(double x) { return pow(10.0, x); }     // NOLINT
+inline float pow10f(float x) { return powf(10.0f, x); }  // NOLINT
+
+class EspClass {
+ public:
+  void restart();
+  void wdtFeed() {}
+  uint32_t getFreeHeap() { return 0; }
+};
+
+extern EspClass ESP;  // NOLINT
+
+/// Host-only hooks used by the benchmark harness to drive the simulated clock.
+namespace host {
+
+/// Advance the value returned by millis()/micros() without sleeping.
+void advance_time_us(uint64_t us);
+/// Switch between the real monotonic clock (default) and a purely simulated one.
+void set_simulated_time(bool simulated);
+
+}  // namespace host
@@ -0,0 +1,5 @@
+#pragma once
+// Defines for the host benchmark build ([env:host] in platformio.ini).
+// Shadows the IDE copy in esphome/core/defines.h, exactly like a generated build would.
+
+#define USE_SENSOR
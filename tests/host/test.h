@@ -0,0 +1,54 @@
+#pragma once
+
+// A tiny, dependency-free subset of the GoogleTest API for the host build.
+//
+// Host tests cover C++ code that the python unit tests can't reach, e.g. that an optimized code path matches the
+// reference implementation it replaces. They're part of the host program, run them with script/host_test:
+//
+//   TEST(Suite, Name) {
+//     EXPECT_EQ(do_something(), 42);
+//   }
+
+#include <string>
+
+namespace testing {
+
+namespace internal {
+
+using Function = void (*)();
+
+bool register_test(const char *name, Function func);
+/// Mark the running test as failed and print the failed check.
+void fail(const char *file, int line, const std::string &message);
+
+}  // namespace internal
+
+/// Run all registered tests, honoring --gtest_filter=. Returns the exit code for the program.
+int run_all(int argc, char **argv);
+
+}  // namespace testing
+
+#define TEST(suite, name) \
+  static void suite##_##name##_test(); \
+  static bool suite##_##name##_registered __attribute__((unused)) = \
+      ::testing::internal::register_test(#suite "." #name, suite##_##name##_test); \
+  static void suite##_##name##_test()
+
+#define EXPECT_TRUE(condition) \
+  do { \
+    if (!(condition)) \
+      ::testing::internal::fail(__FILE__, __LINE__, "Expected: " #condition); \
+  } while (0)
+
+#define TEST_EXPECT_CMP_(a, b, op) \
+  do { \
+    const auto va = (a); \
+    const auto vb = (b); \
+    if (!(va op vb)) \
+      ::testing::internal::fail(__FILE__, __LINE__, \
+                                "Expected: " #a " " #op " " #b ", actual: " + std::to_string(va) + " vs " + \
+                                    std::to_string(vb)); \
+  } while (0)
+
+#define EXPECT_EQ(a, b) TEST_EXPECT_CMP_(a, b, ==)
+#define EXPECT_LE(a, b) TEST_EXPECT_CMP_(a, b, <=)
@@ -0,0 +1,37 @@
+#include "test.h"
+#include "esphome/components/api/proto.h"
+
+#include <limits>
+
+using namespace esphome::api;
+
+template<typename T>
+static uint32_t field_size(void (*add)(uint32_t &, uint32_t, T, bool), uint32_t field_id, T value,
+                           bool force = false) {
+  uint32_t total = 0;
+  add(total, field_id, value, force);
+  return total;
+}
+
+TEST(ProtoSize, FixedWidthFields) {
+  EXPECT_EQ(field_size(ProtoSize::add_double_field, 1, 0.0), 0u);
+  EXPECT_EQ(field_size(ProtoSize::add_double_field, 1, 0.0, true), 9u);
+  EXPECT_EQ(field_size(ProtoSize::add_double_field, 16, 1.5), 10u);
+  EXPECT_EQ(field_size<uint64_t>(ProtoSize::add_fixed64_field, 1, 0), 0u);
+  EXPECT_EQ(field_size<uint64_t>(ProtoSize::add_fixed64_field, 1, UINT64_MAX), 9u);
+  EXPECT_EQ(field_size<int32_t>(ProtoSize::add_sfixed32_field, 1, 0), 0u);
+  EXPECT_EQ(field_size<int32_t>(ProtoSize::add_sfixed32_field, 1, -1), 5u);
+  EXPECT_EQ(field_size<int64_t>(ProtoSize::add_sfixed64_field, 1, 0, true), 9u);
+  EXPECT_EQ(field_size<int64_t>(ProtoSize::add_sfixed64_field, 1, -1), 9u);
+}
+
+TEST(ProtoSize, SInt64Field) {
+  // ZigZag encoding: 0, -1, 1, -2, ... map to 0, 1, 2, 3, ...
+  EXPECT_EQ(field_size<int64_t>(ProtoSize::add_sint64_field, 1, 0), 0u);
+  EXPECT_EQ(field_size<int64_t>(ProtoSize::add_sint64_field, 1, -1), 2u);
+  EXPECT_EQ(field_size<int64_t>(ProtoSize::add_sint64_field, 1, -64), 2u);
+  EXPECT_EQ(field_size<int64_t>(ProtoSize::add_sint64_field, 1, 64), 3u);
+  EXPECT_EQ(field_size<int64_t>(ProtoSize::add_sint64_field, 1, int64_t(1) << 34), 7u);
+  EXPECT_EQ(field_size<int64_t>(ProtoSize::add_sint64_field, 1, std::numeric_limits<int64_t>::min()), 11u);
+  EXPECT_EQ(field_size<int64_t>(ProtoSize::add_sint64_field, 1, std::numeric_limits<int64_t>::max()), 11u);
+}
@@ -0,0 +1,98 @@
+#include "test.h"
+#include "esphome/components/voltage_sampler/block_sampler.h"
+
+#include <vector>
+
+using namespace esphome;
+using namespace esphome::voltage_sampler;
+
+/// Returns the number of the sample (starting at 1) and records the time it was taken at.
+class RecordingSource : public VoltageSampler {
+ public:
+  float sample() override {
+    this->times.push_back(micros());
+    return float(this->times.size());
+  }
+
+  std::vector<uint32_t> times;
+};
+
+/// Runs a block sampler at 2kHz from loop() for one second, with a main loop iteration every 20us and a slow
+/// component blocking the loop for stall_us every 100 iterations. Checks the gap flag of every block against the
+/// actual sample times and returns the fraction of sample slots that were hit.
+static float run_block_sampler(uint32_t stall_us) {
+  const uint32_t period_us = 500;
+  RecordingSource source;
+  BlockSampler sampler(&source, 1000000 / period_us, 64);
+  sampler.setup();
+  int blocks = 0;
+  sampler.add_on_block_callback([&](const float *samples, size_t count, bool gaps) {
+    blocks++;
+    bool actual_gaps = false;
+    for (size_t i = 1; i < count; i++) {
+      const uint32_t delta = source.times[int(samples[i]) - 1] - source.times[int(samples[i - 1]) - 1];
+      // Samples are taken on the first loop iteration after they're due, so up to 20us late
+      EXPECT_LE(period_us - 20, delta);
+      if (delta > period_us + 20)
+        actual_gaps = true;
+    }
+    EXPECT_EQ(gaps, actual_gaps);
+  });
+
+  host::set_simulated_time(true);
+  const uint32_t start = micros();
+  sampler.start();
+  for (int i = 0; micros() - start < 1000000; i++) {
+    sampler.loop();
+    host::advance_time_us(i % 100 == 99 ? stall_us : 20);
+  }
+  sampler.stop();
+  host::set_simulated_time(false);
+
+  EXPECT_EQ(sampler.get_dropped_blocks(), 0u);
+  EXPECT_LE(blocks, 2000 / 64);
+  return source.times.size() / 2000.0f;
+}
+
+TEST(BlockSampler, FastLoopHitsEverySlot) { EXPECT_LE(0.999f, run_block_sampler(20)); }
+
+TEST(BlockSampler, SlowComponentCausesGaps) {
+  // A component blocking for 2ms every 100 iterations (4ms) leaves time for only 4 of the 8 slots in that time
+  const float duty = run_block_sampler(2000);
+  EXPECT_LE(0.48f, duty);
+  EXPECT_LE(duty, 0.52f);
+}
+
+TEST(BlockSampler, RestartDiscardsPartialBlock) {
+  RecordingSource source;
+  BlockSampler sampler(&source, 1000, 8);
+  sampler.setup();
+  std::vector<std::vector<float>> blocks;
+  sampler.add_on_block_callback(
+      [&](const float *samples, size_t count, bool gaps) { blocks.emplace_back(samples, samples + count); });
+
+  host::set_simulated_time(true);
+  sampler.start();
+  for (int i = 0; i < 5; i++) {
+    sampler.loop();
+    host::advance_time_us(1000);
+  }
+  sampler.stop();
+  // No samples while stopped
+  host::advance_time_us(10000);
+  sampler.loop();
+  EXPECT_EQ(source.times.size(), 5u);
+
+  sampler.start();
+  for (int i = 0; i < 8; i++) {
+    sampler.loop();
+    host::advance_time_us(1000);
+  }
+  sampler.stop();
+  host::set_simulated_time(false);
+
+  // The first block has the 8 samples after the restart, not the 5 from before
+  EXPECT_EQ(blocks.size(), 1u);
+  for (size_t i = 0; i < blocks[0].size(); i++)
+    EXPECT_EQ(blocks[0][i], float(6 + i));
+}
@@ -0,0 +1,482 @@
+#include "test.h"
+#include "esphome/components/display/display_buffer.h"
+#include "esphome/components/ssd1306_base/ssd1306_base.h"
+#include "esphome/core/helpers.h"
+
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace esphome;
+using namespace esphome::display;
+
+static uint32_t random_below(uint32_t n) { return (uint64_t(fast_random_32()) * n) >> 32; }
+static int random_in(int lo, int hi) { return lo + int(random_below(hi - lo + 1)); }
+
+/** The checks need the protected state of both displays, and the reference a way to draw blended pixels.
+ *
+ * Every display is drawn twice: once with the driver's fast paths and once (fast = false) only through
+ * draw_absolute_pixel_internal(), with the reference pixels drawn by draw_pixel_at().
+ */
+template<typename Base> class TestDisplay : public Base {
+ public:
+  bool dirty_span(int band, int *x1, int *x2) { return this->get_dirty_span_(band, x1, x2); }
+  bool dirty_region(int *x1, int *y1, int *x2, int *y2) { return this->get_dirty_region_(x1, y1, x2, y2); }
+  int get_bands() { return (this->get_height_internal() + Base::DIRTY_BAND_HEIGHT - 1) / Base::DIRTY_BAND_HEIGHT; }
+  /// Start a new frame like the drivers do in update(), then pretend it was sent.
+  void frame() { this->do_update_(); }
+  void sent() { this->clear_dirty_(); }
+  /// Mark the rectangle (rotated coordinates) as drawn without drawing it.
+  void mark_box(int x, int y, int width, int height) {
+    if (width <= 0 || height <= 0)
+      return;
+    this->unrotate_rect_(&x, &y, &width, &height);
+    this->mark_dirty_(x, y, x + width - 1, y + height - 1);
+  }
+  /// draw_pixel_at() with color blended into the pixel by alpha (1 to 14), on displays with gray levels or colors.
+  void draw_blended_pixel_at(int x, int y, int color, uint8_t alpha) {
+    this->blend_alpha_ = alpha;
+    this->draw_pixel_at(x, y, color);
+    this->blend_alpha_ = 0;
+  }
+
+ protected:
+  bool fast_{true};
+  uint8_t blend_alpha_{0};
+};
+
+/// A display with a packed buffer in any pixel format, the fast paths are the ones of the SSD1325.
+class PackedDisplay : public TestDisplay<DisplayBuffer> {
+ public:
+  PackedDisplay(PixelFormat format, int width, int height, bool fast) : width_(width), height_(height) {
+    this->fast_ = fast;
+    this->pixel_format_ = format;
+    this->init_internal_(this->get_packed_buffer_length_());
+    // the bits after the last pixel of each row are never drawn, but they're compared
+    memset(this->buffer_, 0, this->get_packed_buffer_length_());
+  }
+  ~PackedDisplay() { delete[] this->buffer_; }
+  const uint8_t *data() const { return this->buffer_; }
+  size_t length() { return this->get_packed_buffer_length_(); }
+
+ protected:
+  int get_width_internal() override { return this->width_; }
+  int get_height_internal() override { return this->height_; }
+  void draw_absolute_pixel_internal(int x, int y, int color) override {
+    if (x >= this->width_ || x < 0 || y >= this->height_ || y < 0)
+      return;
+    if (this->blend_alpha_ != 0)
+      color = this->blend_native_(this->get_packed_pixel_(x, y), color, this->blend_alpha_);
+    this->set_packed_pixel_(x, y, color);
+  }
+  int get_absolute_pixel_internal(int x, int y) override { return this->get_packed_pixel_(x, y); }
+  void fill_span_internal(int x, int y, int width, int color) override {
+    if (this->fast_)
+      this->fill_packed_span_(x, y, width, color);
+    else
+      DisplayBuffer::fill_span_internal(x, y, width, color);
+  }
+
+  int width_;
+  int height_;
+};
+
+/// An SSD1306 that renders into its buffer like the real driver, but doesn't transmit anything.
+class PagedDisplay : public TestDisplay<ssd1306_base::SSD1306> {
+ public:
+  PagedDisplay(ssd1306_base::SSD1306Model model, bool fast) {
+    this->fast_ = fast;
+    this->model_ = model;
+    this->init_internal_(this->get_buffer_length_());
+  }
+  ~PagedDisplay() { delete[] this->buffer_; }
+  const uint8_t *data() const { return this->buffer_; }
+  size_t length() { return this->get_buffer_length_(); }
+
+  void fill(int color) override {
+    if (this->fast_)
+      SSD1306::fill(color);
+    else
+      DisplayBuffer::fill(color);
+  }
+
+ protected:
+  void command(uint8_t value) override {}
+  void write_display_data(const uint8_t *data, size_t length) override {}
+  void fill_rect_internal(int x, int y, int width, int height, int color) override {
+    if (this->fast_)
+      SSD1306::fill_rect_internal(x, y, width, height, color);
+    else
+      DisplayBuffer::fill_rect_internal(x, y, width, height, color);
+  }
+  void blit_1bpp_internal(int x, int y, int width, int height, const uint8_t *data, int stride, int src_x, int src_y,
+                          int color, bool opaque) override {
+    if (this->fast_)
+      SSD1306::blit_1bpp_internal(x, y, width, height, data, stride, src_x, src_y, color, opaque);
+    else
+      DisplayBuffer::blit_1bpp_internal(x, y, width, height, data, stride, src_x, src_y, color, opaque);
+  }
+};
+
+/// The pixels of an image or glyph as they appear on the display: bits, 4 bit alpha or 8 bit gray levels.
+struct Bitmap {
+  int width;
+  int height;
+  std::vector<uint8_t> levels;
+
+  uint8_t at(int x, int y) const { return this->levels[y * this->width + x]; }
+};
+
+static Bitmap random_bitmap(int width, int height, uint8_t max_level) {
+  Bitmap bitmap{width, height, std::vector<uint8_t>(width * height)};
+  // Runs of the same level, with the extremes more likely, to get long RLE runs and both opaque and blended pixels
+  uint8_t level = 0;
+  for (auto &pixel : bitmap.levels) {
+    if (random_below(4) == 0) {
+      const uint32_t kind = random_below(4);
+      level = kind == 0 ? 0 : kind == 1 ? max_level : random_in(0, max_level);
+    }
+    pixel = level;
+  }
+  return bitmap;
+}
+
+/// Where pixel [x,y] of the bitmap is stored for a display with rotation, the same mapping as draw_pixel_at().
+static void stored_position(DisplayRotation rotation, const Bitmap &bitmap, int x, int y, int *stored_x,
+                            int *stored_y) {
+  switch (rotation) {
+    case DISPLAY_ROTATION_0_DEGREES:
+      *stored_x = x;
+      *stored_y = y;
+      break;
+    case DISPLAY_ROTATION_90_DEGREES:
+      *stored_x = bitmap.height - y - 1;
+      *stored_y = x;
+      break;
+    case DISPLAY_ROTATION_180_DEGREES:
+      *stored_x = bitmap.width - x - 1;
+      *stored_y = bitmap.height - y - 1;
+      break;
+    case DISPLAY_ROTATION_270_DEGREES:
+      *stored_x = y;
+      *stored_y = bitmap.width - x - 1;
+      break;
+  }
+}
+static int stored_width(DisplayRotation rotation, const Bitmap &bitmap) {
+  return rotation == DISPLAY_ROTATION_90_DEGREES || rotation == DISPLAY_ROTATION_270_DEGREES ? bitmap.height
+                                                                                              : bitmap.width;
+}
+
+/// The bitmap as rows of whole bytes with bpp bits per pixel, most significant bits first, stored for rotation.
+static std::vector<uint8_t> pack_bitmap(const Bitmap &bitmap, DisplayRotation rotation, int bpp) {
+  const int width = stored_width(rotation, bitmap), height = bitmap.width * bitmap.height / width;
+  const int stride = (width * bpp + 7) / 8;
+  std::vector<uint8_t> data(stride * height);
+  for (int y = 0; y < bitmap.height; y++) {
+    for (int x = 0; x < bitmap.width; x++) {
+      int stored_x = x, stored_y = y;
+      stored_position(rotation, bitmap, x, y, &stored_x, &stored_y);
+      const int bit = stored_x * bpp;
+      const int value = bpp == 1 ? bitmap.at(x, y) != 0 : bitmap.at(x, y);
+      data[stored_y * stride + bit / 8] |= value << (8 - bpp - bit % 8);
+    }
+  }
+  return data;
+}
+
+/// The bitmap run length encoded, stored for rotation. Runs continue across rows.
+static std::vector<uint8_t> encode_rle(const Bitmap &bitmap, DisplayRotation rotation) {
+  const int width = stored_width(rotation, bitmap);
+  std::vector<bool> pixels(bitmap.levels.size());
+  for (int y = 0; y < bitmap.height; y++) {
+    for (int x = 0; x < bitmap.width; x++) {
+      int stored_x = x, stored_y = y;
+      stored_position(rotation, bitmap, x, y, &stored_x, &stored_y);
+      pixels[stored_y * width + stored_x] = bitmap.at(x, y) != 0;
+    }
+  }
+  std::vector<uint8_t> data;
+  for (size_t pos = 0; pos < pixels.size();) {
+    size_t end = pos + 1;
+    while (end < pixels.size() && end - pos < 128 && pixels[end] == pixels[pos])
+      end++;
+    data.push_back((pixels[pos] ? 0x80 : 0x00) | (end - pos - 1));
+    pos = end;
+  }
+  return data;
+}
+
+struct TestImage {
+  Bitmap bitmap;
+  ImageType type;
+  std::unique_ptr<Image> image;
+};
+
+struct TestGlyph {
+  Bitmap alpha;
+  int offset_x;
+  int offset_y;
+};
+
+struct TestFont {
+  int bpp;
+  std::vector<TestGlyph> glyphs;
+  std::unique_ptr<Font> font;
+};
+
+static const char *const FONT_CHARS[] = {"a", "b", "c", "d", "e", "f"};
+
+/// Owns the data of the random images and fonts, the components keep pointers to it.
+class Assets {
+ public:
+  TestImage *random_image() {
+    auto *image = new TestImage();
+    this->images_.emplace_back(image);
+    image->type = ImageType(random_below(3));
+    const DisplayRotation rotation = DisplayRotation(90 * random_below(4));
+    image->bitmap = random_bitmap(random_in(1, 40), random_in(1, 30), image->type == IMAGE_TYPE_GRAYSCALE ? 255 : 1);
+    switch (image->type) {
+      case IMAGE_TYPE_BINARY:
+        this->data_.push_back(pack_bitmap(image->bitmap, rotation, 1));
+        break;
+      case IMAGE_TYPE_BINARY_RLE:
+        this->data_.push_back(encode_rle(image->bitmap, rotation));
+        break;
+      case IMAGE_TYPE_GRAYSCALE:
+        this->data_.push_back(pack_bitmap(image->bitmap, rotation, 8));
+        break;
+    }
+    image->image.reset(
+        new Image(this->data_.back().data(), image->bitmap.width, image->bitmap.height, rotation, image->type));
+    return image;
+  }
+  TestFont *random_font() {
+    auto *font = new TestFont();
+    this->fonts_.emplace_back(font);
+    font->bpp = random_below(2) ? 4 : 1;
+    const DisplayRotation rotation = DisplayRotation(90 * random_below(4));
+    std::vector<Glyph> glyphs;
+    for (const char *c : FONT_CHARS) {
+      TestGlyph glyph{random_bitmap(random_in(1, 11), random_in(1, 13), font->bpp == 4 ? 15 : 1), random_in(-1, 2),
+                      random_in(0, 3)};
+      this->data_.push_back(pack_bitmap(glyph.alpha, rotation, font->bpp));
+      glyphs.emplace_back(c, this->data_.back().data(), 0, glyph.offset_x, glyph.offset_y, glyph.alpha.width,
+                          glyph.alpha.height, rotation, font->bpp);
+      font->glyphs.push_back(std::move(glyph));
+    }
+    font->font.reset(new Font(std::move(glyphs), 10, 16));
+    return font;
+  }
+
+ protected:
+  std::deque<std::vector<uint8_t>> data_;
+  std::vector<std::unique_ptr<TestImage>> images_;
+  std::vector<std::unique_ptr<TestFont>> fonts_;
+};
+
+static int random_color() {
+  switch (random_below(4)) {
+    case 0:
+      return COLOR_OFF;
+    case 1:
+      return COLOR_ON;
+    case 2:
+      return gray(random_below(256));
+    default:
+      return rgb(random_below(256), random_below(256), random_below(256));
+  }
+}
+
+template<typename T> static void reference_rectangle(T &display, int x, int y, int width, int height, int color) {
+  for (int j = 0; j < height; j++) {
+    for (int i = 0; i < width; i++)
+      display.draw_pixel_at(x + i, y + j, color);
+  }
+}
+
+template<typename T> static void reference_image(T &display, int x, int y, const TestImage &image) {
+  for (int j = 0; j < image.bitmap.height; j++) {
+    for (int i = 0; i < image.bitmap.width; i++) {
+      const uint8_t level = image.bitmap.at(i, j);
+      if (image.type == IMAGE_TYPE_GRAYSCALE)
+        display.draw_pixel_at(x + i, y + j, gray(level));
+      else
+        display.draw_pixel_at(x + i, y + j, level ? COLOR_ON : COLOR_OFF);
+    }
+  }
+}
+
+template<typename T>
+static void reference_print(T &display, int x, int y, TestFont &font, int color, TextAlign align,
+                            const std::string &text) {
+  int x_start, y_start, width, height;
+  display.get_text_bounds(x, y, text.c_str(), font.font.get(), align, &x_start, &y_start, &width, &height);
+  const bool mono = display.get_pixel_format() == PIXEL_FORMAT_MONO;
+  for (char c : text) {
+    const TestGlyph &glyph = font.glyphs[c - 'a'];
+    const int glyph_x = x_start + glyph.offset_x, glyph_y = y_start + glyph.offset_y;
+    for (int j = 0; j < glyph.alpha.height; j++) {
+      for (int i = 0; i < glyph.alpha.width; i++) {
+        const uint8_t alpha = glyph.alpha.at(i, j);
+        if (alpha == 0 || (font.bpp == 4 && mono && alpha < 8))
+          continue;
+        if (font.bpp == 1 || mono || alpha == 0x0F)
+          display.draw_pixel_at(glyph_x + i, glyph_y + j, color);
+        else
+          display.draw_blended_pixel_at(glyph_x + i, glyph_y + j, color, alpha);
+      }
+    }
+    // The fast paths mark the whole glyph as drawn, including the pixels they leave unchanged
+    display.mark_box(glyph_x, glyph_y, glyph.alpha.width, glyph.alpha.height);
+    x_start += glyph.alpha.width + glyph.offset_x;
+  }
+}
+
+/// Whether both displays have the same buffer and dirty bands.
+template<typename T> static bool same_contents(T &fast, T &reference) {
+  EXPECT_EQ(fast.length(), reference.length());
+  if (memcmp(fast.data(), reference.data(), fast.length()) != 0) {
+    for (size_t i = 0; i < fast.length(); i++) {
+      if (fast.data()[i] != reference.data()[i]) {
+        EXPECT_EQ(fast.data()[i], reference.data()[i]);
+        break;
+      }
+    }
+    return false;
+  }
+  bool same = true;
+  for (int band = 0; band < fast.get_bands(); band++) {
+    int fast_x1 = -1, fast_x2 = -1, reference_x1 = -1, reference_x2 = -1;
+    const bool fast_dirty = fast.dirty_span(band, &fast_x1, &fast_x2);
+    const bool reference_dirty = reference.dirty_span(band, &reference_x1, &reference_x2);
+    EXPECT_EQ(fast_dirty, reference_dirty);
+    same = same && fast_dirty == reference_dirty;
+    if (!fast_dirty || !reference_dirty)
+      continue;
+    EXPECT_EQ(fast_x1, reference_x1);
+    EXPECT_EQ(fast_x2, reference_x2);
+    same = same && fast_x1 == reference_x1 && fast_x2 == reference_x2;
+  }
+  int fast_region[4]{}, reference_region[4]{};
+  EXPECT_EQ(fast.dirty_region(&fast_region[0], &fast_region[1], &fast_region[2], &fast_region[3]),
+            reference.dirty_region(&reference_region[0], &reference_region[1], &reference_region[2],
+                                   &reference_region[3]));
+  for (int i = 0; i < 4; i++)
+    EXPECT_EQ(fast_region[i], reference_region[i]);
+  return same && memcmp(fast_region, reference_region, sizeof(fast_region)) == 0;
+}
+
+/** Draw the same random primitives, text and images on both displays, the fast one through the public API and the
+ * reference pixel by pixel with draw_pixel_at(), and check that they match after every step.
+ */
+template<typename T> static void draw_random(T &fast, T &reference, int steps) {
+  Assets assets;
+  std::vector<TestFont *> fonts;
+  for (int i = 0; i < 4; i++)
+    fonts.push_back(assets.random_font());
+  EXPECT_TRUE(same_contents(fast, reference));
+
+  for (int step = 0; step < steps; step++) {
+    if (random_below(20) == 0) {
+      const DisplayRotation rotation = DisplayRotation(90 * random_below(4));
+      fast.set_rotation(rotation);
+      reference.set_rotation(rotation);
+    }
+    const int width = fast.get_width(), height = fast.get_height();
+    // Partly off the display now and then, to cover clipping
+    const int x = random_in(-20, width + 5), y = random_in(-20, height + 5);
+    const int w = random_in(-2, width + 10), h = random_in(-2, height + 10);
+    const int color = random_color();
+    switch (random_below(12)) {
+      case 0:
+        fast.filled_rectangle(x, y, w, h, color);
+        reference_rectangle(reference, x, y, w, h, color);
+        break;
+      case 1:
+        fast.horizontal_line(x, y, w, color);
+        reference_rectangle(reference, x, y, w, 1, color);
+        break;
+      case 2:
+        fast.vertical_line(x, y, h, color);
+        reference_rectangle(reference, x, y, 1, h, color);
+        break;
+      case 3:
+        fast.rectangle(x, y, w, h, color);
+        reference_rectangle(reference, x, y, w, 1, color);
+        reference_rectangle(reference, x, y + h - 1, w, 1, color);
+        reference_rectangle(reference, x, y, 1, h, color);
+        reference_rectangle(reference, x + w - 1, y, 1, h, color);
+        break;
+      case 4:
+        if (random_below(5) == 0) {
+          fast.fill(color);
+          reference_rectangle(reference, 0, 0, width, height, color);
+        }
+        break;
+      case 5: {
+        // Drawn pixel by pixel by both, filled_circle() also fills spans
+        const int radius = random_in(0, 20);
+        fast.filled_circle(x, y, radius, color);
+        reference.filled_circle(x, y, radius, color);
+        fast.line(x, y, x + w, y - h, color);
+        reference.line(x, y, x + w, y - h, color);
+        break;
+      }
+      case 6:
+      case 7: {
+        TestImage *image = assets.random_image();
+        fast.image(x, y, image->image.get());
+        reference_image(reference, x, y, *image);
+        break;
+      }
+      case 8:
+      case 9:
+      case 10: {
+        TestFont *font = fonts[random_below(fonts.size())];
+        std::string text;
+        for (uint32_t n = random_in(1, 6); n > 0; n--)
+          text += FONT_CHARS[random_below(6)];
+        const auto align = TextAlign(random_below(3) | (random_below(3) << 3));
+        fast.print(x, y, font->font.get(), color, align, text.c_str());
+        reference_print(reference, x, y, *font, color, align, text);
+        break;
+      }
+      case 11:
+        // A new frame and a transmission, the dirty bands carry over from the last frame
+        fast.frame();
+        reference.frame();
+        if (random_below(2)) {
+          fast.sent();
+          reference.sent();
+        }
+        break;
+    }
+    if (!same_contents(fast, reference))
+      return;
+  }
+}
+
+TEST(DisplayBuffer, FastPathsMatchDrawPixelAt) {
+  fast_random_set_seed(17);
+  // Odd sizes, so that rows end within a byte and the last band is partial
+  for (PixelFormat format : {PIXEL_FORMAT_MONO, PIXEL_FORMAT_GRAY4, PIXEL_FORMAT_GRAY8, PIXEL_FORMAT_RGB565}) {
+    for (int width : {37, 64}) {
+      PackedDisplay fast(format, width, 29, true);
+      PackedDisplay reference(format, width, 29, false);
+      draw_random(fast, reference, 2000);
+    }
+  }
+}
+
+TEST(DisplayBuffer, SSD1306FastPathsMatchDrawPixelAt) {
+  fast_random_set_seed(18);
+  for (auto model : {ssd1306_base::SSD1306_MODEL_128_64, ssd1306_base::SSD1306_MODEL_96_16,
+                     ssd1306_base::SSD1306_MODEL_64_48}) {
+    PagedDisplay fast(model, true);
+    PagedDisplay reference(model, false);
+    draw_random(fast, reference, 2000);
+  }
+}
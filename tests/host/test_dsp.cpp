@@ -0,0 +1,159 @@
+#include "test.h"
+#include "esphome/components/voltage_sampler/dsp.h"
+#include "esphome/core/helpers.h"
+
+#include <cmath>
+#include <vector>
+
+using namespace esphome;
+using namespace esphome::voltage_sampler;
+
+/// Sine with the given amplitude, DC offset and phase, with a little noise, over a few periods of the block.
+static std::vector<float> make_signal(size_t count, float amplitude, float offset, float phase) {
+  std::vector<float> samples(count);
+  for (size_t i = 0; i < count; i++) {
+    const float noise = (random_float() - 0.5f) * amplitude * 0.01f;
+    samples[i] = offset + amplitude * sinf(2.0f * float(M_PI) * 5.0f * i / count + phase) + noise;
+  }
+  return samples;
+}
+
+static double reference_mean(const std::vector<float> &x) {
+  double sum = 0.0;
+  for (float value : x)
+    sum += value;
+  return sum / x.size();
+}
+static double reference_sum_squares(const std::vector<float> &x, double offset) {
+  double sum = 0.0;
+  for (float value : x)
+    sum += (value - offset) * (value - offset);
+  return sum;
+}
+static double reference_covariance(const std::vector<float> &x, const std::vector<float> &y) {
+  const double mean_x = reference_mean(x), mean_y = reference_mean(y);
+  double sum = 0.0;
+  for (size_t i = 0; i < x.size(); i++)
+    sum += (x[i] - mean_x) * (y[i] - mean_y);
+  return sum / x.size();
+}
+
+/// Relative error of actual against expected, absolute below the given noise floor.
+static double error(double actual, double expected, double floor) {
+  return std::abs(actual - expected) / std::max(std::abs(expected), floor);
+}
+
+struct SignalParams {
+  float amplitude;
+  float offset;
+};
+
+// Small ADC voltages, a CT clamp biased to half the supply and mains voltage on top of a large DC offset
+static const SignalParams SIGNALS[] = {{0.5f, 0.0f}, {0.5f, 1.65f}, {20.0f, 60.0f}, {325.0f, 0.0f}, {50.0f, -400.0f}};
+static const size_t COUNTS[] = {1, 2, 17, 64, 256, 1000, 1024};
+
+TEST(DSP, MeanMatchesReference) {
+  fast_random_set_seed(6);
+  for (const auto &params : SIGNALS) {
+    for (size_t count : COUNTS) {
+      const auto x = make_signal(count, params.amplitude, params.offset, random_float());
+      const double expected = reference_mean(x);
+      // Relative to the amplitude, the mean of a signal without DC offset is ~0
+      EXPECT_LE(error(block_mean_float(x.data(), count), expected, params.amplitude), 1e-5);
+      EXPECT_LE(error(block_mean_fixed(x.data(), count), expected, params.amplitude), 1e-4);
+    }
+  }
+}
+
+TEST(DSP, SumSquaresMatchesReference) {
+  fast_random_set_seed(7);
+  for (const auto &params : SIGNALS) {
+    for (size_t count : COUNTS) {
+      const auto x = make_signal(count, params.amplitude, params.offset, random_float());
+      // Around the exact DC offset like ct_clamp once settled, and around zero
+      for (float offset : {params.offset, 0.0f}) {
+        const double expected = reference_sum_squares(x, offset);
+        const double floor = 1e-6 * count;
+        EXPECT_LE(error(block_sum_squares_float(x.data(), count, offset), expected, floor), 1e-4);
+        // Rounding to Q16 is up to 1e-4 relative for samples of 0.3V
+        EXPECT_LE(error(block_sum_squares_fixed(x.data(), count, offset), expected, floor), 1e-3);
+        EXPECT_LE(error(block_rms(x.data(), count, offset), std::sqrt(expected / count), 1e-3), 1e-4);
+      }
+    }
+  }
+}
+
+TEST(DSP, PowerMatchesReference) {
+  fast_random_set_seed(8);
+  for (const auto &voltage_params : SIGNALS) {
+    for (const auto &current_params : SIGNALS) {
+      for (size_t count : COUNTS) {
+        const auto v = make_signal(count, voltage_params.amplitude, voltage_params.offset, 0.0f);
+        const auto c = make_signal(count, current_params.amplitude, current_params.offset, random_float());
+        const double voltage_rms = std::sqrt(reference_covariance(v, v));
+        const double current_rms = std::sqrt(reference_covariance(c, c));
+        const double real_power = reference_covariance(v, c);
+        // A few Q16 steps (15uV) of absolute error, for the blocks where the samples happen to be at zero crossings
+        const double rms_floor = 0.1;
+        for (const PowerMeasurement &power :
+             {block_power_float(v.data(), c.data(), count), block_power_fixed(v.data(), c.data(), count)}) {
+          EXPECT_LE(error(power.voltage_rms, voltage_rms, rms_floor), 1e-3);
+          EXPECT_LE(error(power.current_rms, current_rms, rms_floor), 1e-3);
+          EXPECT_LE(error(power.real_power, real_power, (voltage_rms + rms_floor) * (current_rms + rms_floor)), 1e-3);
+          EXPECT_LE(error(power.apparent_power, voltage_rms * current_rms,
+                          (voltage_rms + rms_floor) * (current_rms + rms_floor)),
+                    1e-3);
+        }
+      }
+    }
+  }
+}
+
+TEST(DSP, PowerWithLargeDCOffset) {
+  // 1024 samples of a 20V sine on 60V DC, the single pass fixed-point sums used to overflow (Vrms 65.54)
+  std::vector<float> v(1024), c(1024);
+  for (size_t i = 0; i < v.size(); i++) {
+    v[i] = 60.0f + 20.0f * sinf(2.0f * float(M_PI) * 10.0f * i / v.size());
+    c[i] = 2.0f + 1.0f * sinf(2.0f * float(M_PI) * 10.0f * i / v.size());
+  }
+  const PowerMeasurement power = block_power_fixed(v.data(), c.data(), v.size());
+  EXPECT_LE(std::abs(power.voltage_rms - 14.1421f), 1e-3f);
+  EXPECT_LE(std::abs(power.current_rms - 0.7071f), 1e-3f);
+  EXPECT_LE(std::abs(power.real_power - 10.0f), 1e-3f);
+  EXPECT_LE(std::abs(power.power_factor() - 1.0f), 1e-4f);
+}
+
+TEST(DSP, NaNSampleGivesNaN) {
+  for (size_t count : {1, 64, 1024}) {
+    for (size_t position : {size_t(0), count / 2, count - 1}) {
+      for (float bad : {NAN, INFINITY, -INFINITY}) {
+        auto x = make_signal(count, 0.5f, 1.65f, 0.0f);
+        const auto y = make_signal(count, 0.5f, 1.65f, 0.0f);
+        x[position] = bad;
+        // The float kernels propagate infinity as infinity (or NaN), the fixed-point ones can't represent it
+        EXPECT_TRUE(std::isnan(block_mean_fixed(x.data(), count)));
+        EXPECT_TRUE(std::isnan(block_sum_squares_fixed(x.data(), count, 1.65f)));
+        EXPECT_TRUE(!std::isfinite(block_mean_float(x.data(), count)));
+        EXPECT_TRUE(!std::isfinite(block_sum_squares_float(x.data(), count, 1.65f)));
+        EXPECT_TRUE(!std::isfinite(block_rms(x.data(), count, 1.65f)));
+        if (std::isnan(bad)) {
+          EXPECT_TRUE(std::isnan(block_mean_float(x.data(), count)));
+          EXPECT_TRUE(std::isnan(block_sum_squares_float(x.data(), count, 1.65f)));
+          EXPECT_TRUE(std::isnan(block_rms(x.data(), count, 1.65f)));
+        }
+        for (const PowerMeasurement &power :
+             {block_power_float(x.data(), y.data(), count), block_power_fixed(x.data(), y.data(), count),
+              block_power_float(y.data(), x.data(), count), block_power_fixed(y.data(), x.data(), count)}) {
+          EXPECT_TRUE(!std::isfinite(power.real_power));
+          EXPECT_TRUE(!std::isfinite(power.apparent_power));
+        }
+        const PowerMeasurement fixed = block_power_fixed(x.data(), y.data(), count);
+        EXPECT_TRUE(std::isnan(fixed.voltage_rms));
+        EXPECT_TRUE(std::isnan(fixed.real_power));
+      }
+    }
+  }
+  // A NaN offset (no calibration yet) doesn't reach the integer conversion either
+  const auto x = make_signal(64, 0.5f, 1.65f, 0.0f);
+  EXPECT_TRUE(std::isnan(block_sum_squares_fixed(x.data(), x.size(), NAN)));
+}
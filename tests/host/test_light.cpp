@@ -0,0 +1,351 @@
+#include "test.h"
+#include "esphome/components/light/addressable_light_effect.h"
+#include "esphome/components/light/light_color_values_q16.h"
+#include "esphome/components/light/light_output.h"
+#include "esphome/components/light/light_state.h"
+#include "esphome/components/light/light_transformer.h"
+#include "esphome/components/partition/light_partition.h"
+
+#include <cmath>
+#include <vector>
+
+using namespace esphome;
+using namespace esphome::light;
+
+/// Difference between a and b when written to an output with the given resolution in bits.
+static int lsb_difference(float a, float b, int bits) {
+  const float max = float((1UL << bits) - 1);
+  return std::abs(int(lroundf(a * max)) - int(lroundf(b * max)));
+}
+
+static LightColorValues random_color_values() {
+  const float state = (fast_random_8() & 1) ? 1.0f : 0.0f;
+  return {state,        random_float(), random_float(), random_float(), random_float(), random_float(),
+          153.0f + random_float() * 347.0f};
+}
+
+/// Records the outputs of an RGBWW light.
+class TestRGBWWLightOutput : public LightOutput {
+ public:
+  LightTraits get_traits() override {
+    auto traits = LightTraits();
+    traits.set_supports_brightness(true);
+    traits.set_supports_rgb(true);
+    traits.set_supports_rgb_white_value(true);
+    traits.set_supports_color_temperature(true);
+    traits.set_min_mireds(153.0f);
+    traits.set_max_mireds(500.0f);
+    return traits;
+  }
+  void write_state(LightState *state) override {
+    state->current_values_as_rgbww(&this->values[0], &this->values[1], &this->values[2], &this->values[3],
+                                   &this->values[4]);
+  }
+
+  float values[5];
+};
+
+/// An RGB strip that records the corrected output, frames are rendered and shown on request.
+class TestAddressableLight : public AddressableLight {
+ public:
+  explicit TestAddressableLight(int32_t size) : size_(size), pixels(size * 3) {
+    this->correction_.calculate_gamma_table(1.0f);
+    this->init_frame_();
+  }
+  int32_t size() const override { return this->size_; }
+  LightTraits get_traits() override {
+    auto traits = LightTraits();
+    traits.set_supports_brightness(true);
+    traits.set_supports_rgb(true);
+    return traits;
+  }
+  bool render() { return this->begin_frame_(); }
+  void show() { this->mark_shown_(); }
+  bool is_show_pending() const { return this->should_show_(); }
+
+  std::vector<uint8_t> pixels;
+
+ protected:
+  void write_frame_internal() override {
+    static const uint8_t OFFSETS[3] = {0, 1, 2};
+    this->write_frame_(this->pixels.data(), 3, OFFSETS);
+  }
+
+  int32_t size_;
+};
+
+class TestPartitionLightOutput : public partition::PartitionLightOutput {
+ public:
+  explicit TestPartitionLightOutput(std::vector<partition::AddressableSegment> segments)
+      : PartitionLightOutput(std::move(segments)) {
+    this->correction_.calculate_gamma_table(1.0f);
+    this->init_frame_();
+  }
+};
+
+TEST(LightColorValuesQ16, Mul) {
+  for (uint32_t a = 0; a <= 0xFFFF; a++) {
+    for (uint32_t b = a % 251; b <= 0xFFFF; b += 251)
+      EXPECT_EQ(LightColorValuesQ16::mul(a, b), uint16_t((a * b * 2ULL + 0xFFFF) / (2 * 0xFFFF)));
+  }
+}
+
+TEST(LightColorValuesQ16, SmoothedProgress) {
+  for (uint32_t x = 0; x <= 0xFFFF; x++) {
+    const float expected = LightTransitionTransformer::smoothed_progress(LightColorValuesQ16::to_float(x));
+    EXPECT_LE(std::abs(LightColorValuesQ16::smoothed_progress(x) - expected * 0xFFFF), 1.0f);
+  }
+}
+
+TEST(GammaTableQ16, MatchesGammaCorrect) {
+  for (float gamma : {0.0f, 1.0f, 2.2f, 2.8f}) {
+    const GammaTableQ16 *table = GammaTableQ16::get(gamma);
+    EXPECT_TRUE(table == GammaTableQ16::get(gamma));
+    for (uint32_t x = 0; x <= 0xFFFF; x++) {
+      const float expected = gamma_correct(LightColorValuesQ16::to_float(x), gamma);
+      const float actual = LightColorValuesQ16::to_float(table->correct(x));
+      for (int bits : {8, 10, 12, 16})
+        EXPECT_LE(lsb_difference(expected, actual, bits), 1);
+    }
+    fast_random_set_seed(3);
+    for (int i = 0; i < 100000; i++) {
+      const float value = random_float();
+      const float actual = LightColorValuesQ16::to_float(table->correct_float(value));
+      EXPECT_LE(lsb_difference(gamma_correct(value, gamma), actual, 16), 1);
+    }
+  }
+}
+
+TEST(LightColorValuesQ16, TransitionMatchesFloat) {
+  const GammaTableQ16 *gamma = GammaTableQ16::get(2.8f);
+  const uint32_t cw = LightColorValuesQ16::mireds_from_float(153.0f);
+  const uint32_t ww = LightColorValuesQ16::mireds_from_float(500.0f);
+  fast_random_set_seed(1);
+  host::set_simulated_time(true);
+  for (int i = 0; i < 1000; i++) {
+    const uint32_t length = 1 + fast_random_32() % 100000;
+    LightTransitionTransformer transition(millis(), length, random_color_values(), random_color_values());
+    for (int step = 0; step <= 20; step++) {
+      float expected[5];
+      transition.get_values().as_rgbww(153.0f, 500.0f, &expected[0], &expected[1], &expected[2], &expected[3],
+                                       &expected[4]);
+      uint16_t actual[5];
+      transition.get_values_q16().as_rgbww(cw, ww, &actual[0], &actual[1], &actual[2], &actual[3], &actual[4]);
+      for (int c = 0; c < 5; c++) {
+        const float corrected = LightColorValuesQ16::to_float(gamma->correct(actual[c]));
+        for (int bits : {8, 10, 12})
+          EXPECT_LE(lsb_difference(gamma_correct(expected[c], 2.8f), corrected, bits), 1);
+        // Up to 1.5 Q16 steps of rounding before the gamma correction (slope 2.8), plus the table error
+        EXPECT_LE(lsb_difference(gamma_correct(expected[c], 2.8f), corrected, 16), 6);
+      }
+      host::advance_time_us(length * 50);
+    }
+  }
+  host::set_simulated_time(false);
+}
+
+TEST(LightState, FixedPointMatchesFloat) {
+  TestRGBWWLightOutput float_output, fixed_output;
+  LightState float_light("float", &float_output), fixed_light("fixed", &fixed_output);
+  float_light.set_gamma_correct(2.8f);
+  fixed_light.set_gamma_correct(2.8f);
+  fixed_light.set_fixed_point(true);
+
+  fast_random_set_seed(2);
+  host::set_simulated_time(true);
+  for (int i = 0; i < 100; i++) {
+    const LightColorValues target = random_color_values();
+    for (auto *light : {&float_light, &fixed_light}) {
+      light->make_call()
+          .set_state(target.is_on())
+          .set_brightness(target.get_brightness())
+          .set_rgbw(target.get_red(), target.get_green(), target.get_blue(), target.get_white())
+          .set_color_temperature(target.get_color_temperature())
+          .set_transition_length(1000)
+          .perform();
+    }
+    for (int step = 0; step <= 25; step++) {
+      float_light.loop();
+      fixed_light.loop();
+      for (int c = 0; c < 5; c++)
+        EXPECT_LE(lsb_difference(float_output.values[c], fixed_output.values[c], 12), 1);
+      host::advance_time_us(41000);
+    }
+    // Both end up at exactly the target values
+    EXPECT_TRUE(float_light.current_values == fixed_light.current_values);
+  }
+  host::set_simulated_time(false);
+}
+
+TEST(LightState, NoGammaPassesValuesThrough) {
+  TestRGBWWLightOutput output;
+  LightState light("linear", &output);
+  light.set_gamma_correct(0.0f);
+  fast_random_set_seed(5);
+  for (int i = 0; i < 100; i++) {
+    const LightColorValues target = random_color_values();
+    light.make_call()
+        .set_state(true)
+        .set_brightness(target.get_brightness())
+        .set_rgbw(target.get_red(), target.get_green(), target.get_blue(), target.get_white())
+        .set_color_temperature(target.get_color_temperature())
+        .set_transition_length(0)
+        .perform();
+    light.loop();
+    float expected[5];
+    light.current_values.as_rgbww(153.0f, 500.0f, &expected[0], &expected[1], &expected[2], &expected[3],
+                                  &expected[4]);
+    // Exactly, without the rounding of a table
+    for (int c = 0; c < 5; c++)
+      EXPECT_EQ(output.values[c], expected[c]);
+  }
+}
+
+TEST(LightState, GammaTableMatchesPowf) {
+  for (float gamma : {0.5f, 2.8f}) {
+    TestRGBWWLightOutput output;
+    LightState light("gamma", &output);
+    light.set_gamma_correct(gamma);
+    fast_random_set_seed(4);
+    for (int i = 0; i < 1000; i++) {
+      const LightColorValues target = random_color_values();
+      light.make_call()
+          .set_state(true)
+          .set_brightness(target.get_brightness())
+          .set_rgbw(target.get_red(), target.get_green(), target.get_blue(), target.get_white())
+          .set_color_temperature(target.get_color_temperature())
+          .set_transition_length(0)
+          .perform();
+      light.loop();
+      float expected[5];
+      light.current_values.as_rgbww(153.0f, 500.0f, &expected[0], &expected[1], &expected[2], &expected[3],
+                                    &expected[4]);
+      for (int c = 0; c < 5; c++)
+        EXPECT_LE(lsb_difference(gamma_correct(expected[c], gamma), output.values[c], 16), 1);
+    }
+  }
+}
+
+TEST(AddressableLight, PartitionCorrectionOnlyForItsFrames) {
+  TestAddressableLight strip(10);
+  LightState strip_state("strip", &strip);
+  TestPartitionLightOutput partition({partition::AddressableSegment(&strip_state, 2, 4)});
+  partition.set_correction(0.5f, 0.5f, 0.5f);
+
+  partition.fill(ESPColor(255, 255, 255));
+  partition.schedule_show();
+  partition.loop();
+  strip.show();
+  // The LEDs written by the partition are shown with its correction, the others with the one of the strip
+  for (int32_t i = 0; i < 10; i++)
+    EXPECT_EQ(strip.pixels[i * 3], (i >= 2 && i < 6) ? 128 : 0);
+
+  // Once the strip renders a frame itself, its correction applies to all LEDs
+  EXPECT_TRUE(strip.render());
+  strip.fill(ESPColor(255, 255, 255));
+  strip.show();
+  for (int32_t i = 0; i < 10; i++)
+    EXPECT_EQ(strip.pixels[i * 3], 255);
+}
+
+/// Runs the main loop every loop_us for duration_us, rendering and showing frames like an effect and a driver would.
+/// The LEDs take show_us to show a frame, during which no frame can be rendered. Returns the number of frames.
+static int run_frames(TestAddressableLight &strip, uint32_t duration_us, uint32_t loop_us, uint32_t show_us = 0,
+                      AddressableLightEffect *effect = nullptr) {
+  int frames = 0;
+  uint32_t show_at = micros();
+  strip.set_effect_active(true);
+  const uint32_t start = micros();
+  while (micros() - start < duration_us) {
+    if (strip.is_show_pending() && int32_t(micros() - show_at) >= 0)
+      strip.show();
+    if (strip.render()) {
+      frames++;
+      if (effect != nullptr)
+        effect->apply(strip, ESPColor::WHITE);
+      strip.schedule_show();
+      show_at = micros() + show_us;
+    }
+    host::advance_time_us(loop_us);
+  }
+  return frames;
+}
+
+TEST(AddressableLight, FramePacing) {
+  host::set_simulated_time(true);
+  TestAddressableLight strip(10);
+  strip.set_max_framerate(100.0f);
+  // A fast loop renders exactly at the frame rate
+  EXPECT_EQ(run_frames(strip, 1000000, 100), 100);
+  EXPECT_EQ(strip.get_dropped_frames(), 0u);
+  // A loop slower than the frame period renders every loop, the whole frame periods in between count as dropped
+  EXPECT_EQ(run_frames(strip, 1000000, 25000), 40);
+  EXPECT_LE(39u, strip.get_dropped_frames());
+  EXPECT_LE(strip.get_dropped_frames(), 40u);
+
+  // Without a frame rate limit a frame is rendered every loop in which the LEDs aren't busy, and waiting for them
+  // doesn't count as dropped frames
+  TestAddressableLight unlimited(10);
+  EXPECT_EQ(run_frames(unlimited, 100000, 100, 350), 250);
+  EXPECT_EQ(unlimited.get_dropped_frames(), 0u);
+  // With a limit, a frame is dropped for every frame period the LEDs are busy for
+  TestAddressableLight busy(10);
+  busy.set_max_framerate(100.0f);
+  EXPECT_EQ(run_frames(busy, 1000000, 100, 15000), 50);
+  EXPECT_LE(49u, busy.get_dropped_frames());
+  EXPECT_LE(busy.get_dropped_frames(), 51u);
+  host::set_simulated_time(false);
+}
+
+TEST(AddressableLight, CatchUpAfterStall) {
+  host::set_simulated_time(true);
+  TestAddressableLight strip(10);
+  strip.set_max_framerate(100.0f);
+  run_frames(strip, 100000, 100);
+  // After a stall of 3.5 frame periods one frame is rendered right away, not a burst of the missed ones
+  host::advance_time_us(35000);
+  EXPECT_TRUE(strip.render());
+  strip.show();
+  EXPECT_EQ(strip.get_dropped_frames(), 3u);
+  EXPECT_TRUE(!strip.render());
+  // and the frame rate continues from there
+  host::advance_time_us(9999);
+  EXPECT_TRUE(!strip.render());
+  host::advance_time_us(1);
+  EXPECT_TRUE(strip.render());
+  strip.show();
+  // A gap of more than a second is a pause without effects, not dropped frames
+  host::advance_time_us(5000000);
+  EXPECT_TRUE(strip.render());
+  strip.show();
+  EXPECT_EQ(strip.get_dropped_frames(), 3u);
+
+  // An effect started after more than half the micros() range renders right away
+  strip.set_effect_active(false);
+  host::advance_time_us(3000000000UL);
+  strip.set_effect_active(true);
+  EXPECT_TRUE(strip.render());
+  host::set_simulated_time(false);
+}
+
+TEST(AddressableLight, WipeSpeedDoesntDependOnFrameRate) {
+  host::set_simulated_time(true);
+  for (float fps : {0.0f, 30.0f, 60.0f, 250.0f}) {
+    for (uint32_t loop_us : {100, 7000}) {
+      TestAddressableLight strip(200);
+      strip.set_max_framerate(fps);
+      AddressableColorWipeEffect wipe("Wipe");
+      wipe.set_colors({AddressableColorWipeEffectColor{255, 255, 255, 0, false, 1000}});
+      wipe.set_add_led_interval(20);
+      run_frames(strip, 2000000, loop_us, 0, &wipe);
+      strip.show();
+      int lit = 0;
+      for (int32_t i = 0; i < strip.size(); i++)
+        lit += strip.pixels[i * 3] != 0;
+      // The first LED right away and one every 20ms for 2s, the last frame may be up to 1.5 steps before the end
+      EXPECT_LE(99, lit);
+      EXPECT_LE(lit, 101);
+    }
+  }
+  host::set_simulated_time(false);
+}
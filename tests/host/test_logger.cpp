@@ -0,0 +1,111 @@
+#include "test.h"
+#include "esphome/components/logger/log_ring_buffer.h"
+#include "esphome/core/helpers.h"
+
+#include <cstring>
+#include <deque>
+#include <string>
+
+using namespace esphome;
+using namespace esphome::logger;
+
+static uint32_t random_below(uint32_t n) { return (uint64_t(fast_random_32()) * n) >> 32; }
+
+struct LogRecord {
+  int level;
+  std::string tag;
+  std::string message;
+};
+
+/// Bytes a record takes in the ring buffer: length, level and both strings with null terminator.
+static size_t record_size(const LogRecord &record) { return 3 + record.tag.size() + 1 + record.message.size() + 1; }
+
+/// Pops the oldest record and checks it against the expected one.
+static void expect_front(LogRingBuffer &buffer, const LogRecord &expected) {
+  int level;
+  const char *tag;
+  const char *message;
+  EXPECT_TRUE(buffer.front(level, tag, message));
+  EXPECT_EQ(level, expected.level);
+  EXPECT_TRUE(expected.tag == tag);
+  EXPECT_TRUE(expected.message == message);
+  buffer.pop();
+}
+
+TEST(LogRingBuffer, MatchesQueue) {
+  static const char *const TAGS[] = {"", "api", "sensor", "a_much_longer_component_tag"};
+  static const size_t MAX_RECORD_SIZE = 3 + strlen(TAGS[3]) + 1 + 59 + 1;
+  fast_random_set_seed(10);
+  for (size_t capacity : {64, 100, 256}) {
+    LogRingBuffer buffer(capacity);
+    EXPECT_LE(capacity, buffer.get_capacity());
+    std::deque<LogRecord> expected;
+    size_t stored = 0, pushed = 0;
+    uint32_t dropped = 0;
+    for (int i = 0; i < 20000; i++) {
+      if (random_below(2) == 0) {
+        LogRecord record{int(random_below(8)), TAGS[random_below(4)], std::string(random_below(60), 'a' + i % 26)};
+        // Only the message length is passed, the string doesn't have to be terminated
+        const std::string padded = record.message + "garbage";
+        if (buffer.push(record.level, record.tag.c_str(), padded.c_str(), record.message.size())) {
+          stored += record_size(record);
+          pushed += record_size(record);
+          expected.push_back(record);
+        } else {
+          // Dropped only if it doesn't fit, the padding skipped at the end of the buffer by an earlier record and the
+          // padding needed by this one are each shorter than a record
+          EXPECT_LE(buffer.get_capacity(), stored + 2 * record_size(record) + MAX_RECORD_SIZE);
+          dropped++;
+        }
+        EXPECT_EQ(buffer.get_dropped(), dropped);
+      } else {
+        for (uint32_t n = random_below(4); n > 0 && !expected.empty(); n--) {
+          expect_front(buffer, expected.front());
+          stored -= record_size(expected.front());
+          expected.pop_front();
+        }
+      }
+      EXPECT_EQ(buffer.empty(), expected.empty());
+    }
+    // Wrapped around many times and both pushes and drops happened
+    EXPECT_LE(100 * buffer.get_capacity(), pushed);
+    EXPECT_LE(1u, dropped);
+
+    while (!expected.empty()) {
+      expect_front(buffer, expected.front());
+      expected.pop_front();
+    }
+    int level;
+    const char *tag;
+    const char *message;
+    EXPECT_TRUE(!buffer.front(level, tag, message));
+    EXPECT_TRUE(buffer.empty());
+  }
+}
+
+TEST(LogRingBuffer, DropsWhenFull) {
+  LogRingBuffer buffer(64);
+  // 15 bytes per record, 4 fit
+  for (int i = 0; i < 6; i++)
+    EXPECT_EQ(buffer.push(i, "tag", "message", 7), i < 4);
+  EXPECT_EQ(buffer.get_dropped(), 2u);
+  // Records larger than the buffer are dropped, even when it's empty
+  LogRingBuffer small(64);
+  const std::string large(64, 'x');
+  EXPECT_TRUE(!small.push(1, "tag", large.c_str(), large.size()));
+  EXPECT_EQ(small.get_dropped(), 1u);
+  EXPECT_TRUE(small.empty());
+
+  for (int i = 0; i < 4; i++)
+    expect_front(buffer, LogRecord{i, "tag", "message"});
+  EXPECT_TRUE(buffer.empty());
+  // At position 60 a record doesn't fit before the end of the buffer, it goes to the start instead
+  EXPECT_TRUE(buffer.push(5, "tag", "message that's longer", 21));
+  EXPECT_TRUE(buffer.push(6, "tag", "message that's longer", 21));
+  expect_front(buffer, LogRecord{5, "tag", "message that's longer"});
+  EXPECT_TRUE(buffer.push(7, "tag", "message that's longer", 21));
+  expect_front(buffer, LogRecord{6, "tag", "message that's longer"});
+  expect_front(buffer, LogRecord{7, "tag", "message that's longer"});
+  EXPECT_TRUE(buffer.empty());
+  EXPECT_EQ(buffer.get_dropped(), 2u);
+}
@@ -0,0 +1,70 @@
+#include "test.h"
+
+#include <cstdio>
+#include <cstring>
+#include <regex>
+#include <vector>
+
+namespace testing {
+
+namespace internal {
+
+struct Test {
+  const char *name;
+  Function func;
+};
+
+static std::vector<Test> &registry() {
+  static std::vector<Test> tests;
+  return tests;
+}
+
+static bool current_failed = false;
+
+bool register_test(const char *name, Function func) {
+  registry().push_back(Test{name, func});
+  return true;
+}
+
+void fail(const char *file, int line, const std::string &message) {
+  printf("%s:%d: Failure\n%s\n", file, line, message.c_str());
+  current_failed = true;
+}
+
+}  // namespace internal
+
+int run_all(int argc, char **argv) {
+  std::string filter = ".";
+  for (int i = 1; i < argc; i++) {
+    const char *prefix = "--gtest_filter=";
+    if (strncmp(argv[i], prefix, strlen(prefix)) == 0) {
+      filter = argv[i] + strlen(prefix);
+    } else {
+      fprintf(stderr, "Unknown argument '%s'\n", argv[i]);
+      return 1;
+    }
+  }
+  const std::regex filter_re(filter);
+
+  int run = 0;
+  std::vector<const char *> failed;
+  for (auto &test : internal::registry()) {
+    if (!std::regex_search(test.name, filter_re))
+      continue;
+    printf("[ RUN      ] %s\n", test.name);
+    internal::current_failed = false;
+    test.func();
+    printf("%s %s\n", internal::current_failed ? "[  FAILED  ]" : "[       OK ]", test.name);
+    fflush(stdout);
+    if (internal::current_failed)
+      failed.push_back(test.name);
+    run++;
+  }
+
+  printf("%d tests run, %d failed\n", run, int(failed.size()));
+  for (auto *name : failed)
+    printf("[  FAILED  ] %s\n", name);
+  return failed.empty() ? 0 : 1;
+}
+
+}  // namespace testing
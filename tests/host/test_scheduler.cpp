@@ -0,0 +1,118 @@
+#include "test.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/scheduler.h"
+
+#include <algorithm>
+#include <set>
+
+using namespace esphome;
+
+/// Random number below n, from the high bits of fast_random_32() (its low bits have short periods).
+static uint32_t random_below(uint32_t n) { return (uint64_t(fast_random_32()) * n) >> 32; }
+
+/// Exposes the wheel internals to compute the next deadline by brute force.
+class TestScheduler : public Scheduler {
+ public:
+  /// Absolute time (ms) at which the earliest pending item can run, by looking at every item.
+  optional<uint64_t> earliest_execution() {
+    uint64_t earliest = UINT64_MAX;
+    auto visit = [&earliest](SchedulerItem *head, uint64_t not_before) {
+      for (SchedulerItem *item = head; item != nullptr; item = item->next)
+        earliest = std::min(earliest, std::max(item->next_execution, not_before));
+    };
+    // Items in the wheel can't run before the wheel gets to them
+    for (auto &level : this->wheel_) {
+      for (SchedulerItem *head : level)
+        visit(head, this->wheel_time_);
+    }
+    visit(this->to_add_, 0);
+    if (earliest == UINT64_MAX)
+      return {};
+    return earliest;
+  }
+  /// Items added since the last call(), they only run from the next wheel tick on.
+  std::set<const void *> pending_adds() {
+    std::set<const void *> items;
+    for (SchedulerItem *item = this->to_add_; item != nullptr; item = item->next)
+      items.insert(item);
+    return items;
+  }
+  /** Number of items in the wheel that were due at time now, except for the given (just added) items.
+   *
+   * Items can't run before the wheel time they were inserted at, so only items that were due at the wheel time
+   * before the call() (not_before) count.
+   */
+  int count_due(uint64_t now, uint64_t not_before, const std::set<const void *> &except) {
+    int count = 0;
+    for (auto &level : this->wheel_) {
+      for (SchedulerItem *head : level) {
+        for (SchedulerItem *item = head; item != nullptr; item = item->next)
+          count += std::max(item->next_execution, not_before) <= now && except.count(item) == 0;
+      }
+    }
+    return count;
+  }
+  uint64_t wheel_time() const { return this->wheel_time_; }
+  uint64_t now() { return this->millis_(); }
+};
+
+TEST(Scheduler, NextScheduleInIsNeverLate) {
+  TestScheduler scheduler;
+  fast_random_set_seed(5);
+  host::set_simulated_time(true);
+  // Start right before a millis() rollover, so the wheel time passes 2^32 like on a long running node
+  host::advance_time_us((uint64_t(UINT32_MAX) - millis() - 5000) * 1000);
+  int late = 0, overdue = 0;
+  for (int i = 0; i < 200000; i++) {
+    const uint32_t op = random_below(8);
+    // Few names, so that the earliest item is often in one of the higher levels
+    const NameHash id(random_below(8));
+    // Log-uniform delays, so that all wheel levels are populated
+    const uint32_t delay = random_below(2UL << random_below(22));
+    if (op < 3) {
+      scheduler.set_timeout(nullptr, id, delay, []() {});
+    } else if (op == 3) {
+      scheduler.set_interval(nullptr, id, delay + 1, []() {});
+    } else if (op == 4) {
+      scheduler.cancel_timeout(nullptr, id);
+    } else {
+      // Mostly short steps, sometimes up to 1000s like after a long tickless sleep
+      uint32_t step = random_below(1UL << random_below(12));
+      if (random_below(64) == 0)
+        step = random_below(1000000);
+      host::advance_time_us(uint64_t(step) * 1000);
+      const auto added = scheduler.pending_adds();
+      const uint64_t wheel_time = scheduler.wheel_time();
+      scheduler.call();
+      // Skipping empty slots must not skip an item, everything that was due has run
+      overdue += scheduler.count_due(scheduler.now(), wheel_time, added);
+    }
+
+    const optional<uint32_t> next = scheduler.next_schedule_in();
+    const optional<uint64_t> earliest = scheduler.earliest_execution();
+    EXPECT_EQ(next.has_value(), earliest.has_value());
+    if (!next.has_value() || !earliest.has_value())
+      continue;
+    const uint64_t now = scheduler.now();
+    const uint64_t expected = *earliest > now ? *earliest - now : 0;
+    if (*next > expected)
+      late++;
+  }
+  EXPECT_EQ(late, 0);
+  EXPECT_EQ(overdue, 0);
+  host::set_simulated_time(false);
+}
+
+TEST(Scheduler, NameFormsReferToSameItem) {
+  Scheduler scheduler;
+  const std::string name = "update";
+  scheduler.set_timeout(nullptr, "update", 1000, []() {});
+  EXPECT_TRUE(scheduler.cancel_timeout(nullptr, NameHash("update")));
+  scheduler.set_timeout(nullptr, NameHash(fnv1_hash(name)), 1000, []() {});
+  EXPECT_TRUE(scheduler.cancel_timeout(nullptr, name));
+  scheduler.set_interval(nullptr, name, 1000, []() {});
+  EXPECT_TRUE(scheduler.cancel_interval(nullptr, "update"));
+  // A literal 0 is a null name (unnamed, can't be cancelled), not an ambiguous call
+  scheduler.set_timeout(nullptr, 0, 1000, []() {});
+  EXPECT_TRUE(!scheduler.cancel_timeout(nullptr, 0));
+}
@@ -0,0 +1,248 @@
+#include "test.h"
+#include "esphome/components/sensor/filter.h"
+#include "esphome/core/helpers.h"
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <vector>
+
+using namespace esphome;
+using namespace esphome::sensor;
+
+static uint32_t random_below(uint32_t n) { return (uint64_t(fast_random_32()) * n) >> 32; }
+
+/// A random sensor value, often repeating to cover equal values, sometimes NaN if allowed.
+static float random_value(bool allow_nan) {
+  const uint32_t kind = random_below(8);
+  if (kind == 0 && allow_nan)
+    return NAN;
+  if (kind < 4)
+    return float(random_below(10));
+  return (random_float() - 0.5f) * 1000.0f;
+}
+
+/// The last values of a sensor, the reference the windowed filters are compared against.
+class NaiveWindow {
+ public:
+  explicit NaiveWindow(size_t window_size) : window_size_(window_size) {}
+
+  void push(float value) {
+    if (std::isnan(value))
+      return;
+    this->values_.push_back(value);
+    this->trim_();
+  }
+  void set_window_size(size_t window_size) {
+    this->window_size_ = window_size;
+    this->trim_();
+  }
+  std::vector<float> sorted() const {
+    std::vector<float> sorted(this->values_.begin(), this->values_.end());
+    std::sort(sorted.begin(), sorted.end());
+    return sorted;
+  }
+  float median() const {
+    const auto sorted = this->sorted();
+    const size_t size = sorted.size();
+    if (size % 2)
+      return sorted[size / 2];
+    return (sorted[size / 2] + sorted[(size / 2) - 1]) / 2.0f;
+  }
+  float quantile(float q) const {
+    const auto sorted = this->sorted();
+    const float pos = q * (sorted.size() - 1);
+    const size_t rank = pos;
+    const float fraction = pos - rank;
+    if (fraction <= 0.0f || rank + 1 >= sorted.size())
+      return sorted[rank];
+    return sorted[rank] + (sorted[rank + 1] - sorted[rank]) * fraction;
+  }
+
+  const std::deque<float> &values() const { return this->values_; }
+  bool empty() const { return this->values_.empty(); }
+
+ protected:
+  void trim_() {
+    while (this->values_.size() > this->window_size_)
+      this->values_.pop_front();
+  }
+
+  size_t window_size_;
+  std::deque<float> values_;
+};
+
+TEST(SortedWindow, MatchesSort) {
+  fast_random_set_seed(11);
+  for (size_t capacity : {1, 2, 3, 16, 100, 1000}) {
+    SortedWindow window(capacity);
+    NaiveWindow expected(capacity);
+    for (int i = 0; i < 3000; i++) {
+      const float value = random_value(false);
+      window.push(value);
+      expected.push(value);
+      if (random_below(500) == 0) {
+        capacity = 1 + random_below(200);
+        window.set_capacity(capacity);
+        expected.set_window_size(capacity);
+        EXPECT_EQ(window.capacity(), capacity);
+      }
+      if (random_below(1000) == 0) {
+        window.clear();
+        expected.set_window_size(0);
+        expected.set_window_size(capacity);
+      }
+
+      EXPECT_EQ(window.size(), expected.values().size());
+      if (window.empty())
+        continue;
+      const auto sorted = expected.sorted();
+      // Checking every rank is quadratic, do it only now and then
+      if (i % 17 == 0 || sorted.size() < 20) {
+        for (size_t rank = 0; rank < sorted.size(); rank++)
+          EXPECT_EQ(window.at(rank), sorted[rank]);
+      }
+      EXPECT_EQ(window.median(), expected.median());
+      for (float q : {0.0f, 0.1f, 0.5f, 0.9f, 0.99f, 1.0f})
+        EXPECT_EQ(window.quantile(q), expected.quantile(q));
+    }
+  }
+}
+
+TEST(SortedWindow, MedianAndQuantileFiltersSkipNaN) {
+  fast_random_set_seed(12);
+  size_t window_size = 7;
+  MedianFilter median(window_size, 1, 1);
+  QuantileFilter quantile(window_size, 1, 1, 0.9f);
+  NaiveWindow expected(window_size);
+  // Only NaN so far, the filters send 0
+  EXPECT_EQ(*median.new_value(NAN), 0.0f);
+  EXPECT_EQ(*quantile.new_value(NAN), 0.0f);
+  for (int i = 0; i < 5000; i++) {
+    const float value = random_value(true);
+    expected.push(value);
+    EXPECT_EQ(*median.new_value(value), expected.median());
+    EXPECT_EQ(*quantile.new_value(value), expected.quantile(0.9f));
+    if (random_below(200) == 0) {
+      window_size = 1 + random_below(50);
+      median.set_window_size(window_size);
+      quantile.set_window_size(window_size);
+      expected.set_window_size(window_size);
+    }
+  }
+}
+
+TEST(RingBuffer, MatchesDeque) {
+  fast_random_set_seed(13);
+  RingBuffer<int> buffer(5);
+  std::deque<int> expected;
+  size_t capacity = 5;
+  for (int i = 0; i < 20000; i++) {
+    const uint32_t op = random_below(16);
+    if (op < 8) {
+      buffer.push(i);
+      expected.push_back(i);
+      if (expected.size() > capacity)
+        expected.pop_front();
+    } else if (op < 11 && !expected.empty()) {
+      buffer.pop_front();
+      expected.pop_front();
+    } else if (op < 13 && !expected.empty()) {
+      buffer.pop_back();
+      expected.pop_back();
+    } else if (op == 13) {
+      // keeps the newest values
+      capacity = 1 + random_below(12);
+      buffer.set_capacity(capacity);
+      while (expected.size() > capacity)
+        expected.pop_front();
+    } else if (op == 14 && random_below(16) == 0) {
+      buffer.clear();
+      expected.clear();
+    }
+
+    EXPECT_EQ(buffer.capacity(), capacity);
+    EXPECT_EQ(buffer.size(), expected.size());
+    EXPECT_EQ(buffer.empty(), expected.empty());
+    EXPECT_EQ(buffer.full(), expected.size() == capacity);
+    if (expected.empty())
+      continue;
+    EXPECT_EQ(buffer.front(), expected.front());
+    EXPECT_EQ(buffer.back(), expected.back());
+    for (size_t j = 0; j < expected.size(); j++)
+      EXPECT_EQ(buffer[j], expected[j]);
+  }
+}
+
+TEST(RingBuffer, MovingAverageMatchesSum) {
+  fast_random_set_seed(14);
+  size_t window_size = 10;
+  SlidingWindowMovingAverageFilter filter(window_size, 1, 1);
+  NaiveWindow expected(window_size);
+  for (int i = 0; i < 20000; i++) {
+    const float value = random_value(true);
+    expected.push(value);
+    double sum = 0.0;
+    for (float x : expected.values())
+      sum += x;
+    const float average = expected.empty() ? 0.0f : sum / expected.values().size();
+    const float actual = *filter.new_value(value);
+    // The running sum is off by a few roundings of values up to 500
+    EXPECT_LE(std::abs(actual - average), 1e-3f);
+    if (random_below(100) == 0) {
+      // Resize, a NaN right after shrinking the window must give the average of the values that were kept
+      window_size = 1 + random_below(30);
+      filter.set_window_size(window_size);
+      expected.set_window_size(window_size);
+    }
+  }
+}
+
+TEST(MonotonicWindow, MatchesMinMax) {
+  fast_random_set_seed(15);
+  for (bool max : {true, false}) {
+    size_t window_size = 1;
+    MonotonicWindow window(window_size, max);
+    NaiveWindow expected(window_size);
+    EXPECT_TRUE(window.empty());
+    for (int i = 0; i < 20000; i++) {
+      const float value = random_value(false);
+      window.push(value);
+      expected.push(value);
+      const auto &values = expected.values();
+      EXPECT_EQ(window.get(), max ? *std::max_element(values.begin(), values.end())
+                                  : *std::min_element(values.begin(), values.end()));
+      if (random_below(300) == 0) {
+        window_size = 1 + random_below(100);
+        window.set_window_size(window_size);
+        expected.set_window_size(window_size);
+        EXPECT_EQ(window.get(), max ? *std::max_element(values.begin(), values.end())
+                                    : *std::min_element(values.begin(), values.end()));
+      }
+    }
+  }
+}
+
+TEST(MonotonicWindow, SlidingWindowFiltersSkipNaN) {
+  fast_random_set_seed(16);
+  size_t window_size = 5;
+  SlidingWindowMaxFilter max_filter(window_size, 1, 1);
+  SlidingWindowMinFilter min_filter(window_size, 1, 1);
+  NaiveWindow expected(window_size);
+  // Only NaN so far, the filters send 0
+  EXPECT_EQ(*max_filter.new_value(NAN), 0.0f);
+  EXPECT_EQ(*min_filter.new_value(NAN), 0.0f);
+  for (int i = 0; i < 20000; i++) {
+    const float value = random_value(true);
+    expected.push(value);
+    const auto &values = expected.values();
+    EXPECT_EQ(*max_filter.new_value(value), *std::max_element(values.begin(), values.end()));
+    EXPECT_EQ(*min_filter.new_value(value), *std::min_element(values.begin(), values.end()));
+    if (random_below(200) == 0) {
+      window_size = 1 + random_below(50);
+      max_filter.set_window_size(window_size);
+      min_filter.set_window_size(window_size);
+      expected.set_window_size(window_size);
+    }
+  }
+}